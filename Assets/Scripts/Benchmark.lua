@@ -0,0 +1,24 @@
+--
+-- > Notice: Amélie Heinrich @ 2025
+-- > Create Time: 2025-03-08 10:34:17
+--
+
+-- Used by the benchmark stress scene: bobs the entity up and down so ScriptSystem::Update does real work.
+return function(entityID)
+    local self = {}
+
+    function self.awake()
+        self.transform = Entity.GetTransform(entityID)
+        self.time = 0.0
+    end
+
+    function self.update(dt)
+        self.time = self.time + dt
+        self.transform.position.y = self.transform.position.y + math.sin(self.time) * dt
+    end
+
+    function self.quit()
+    end
+
+    return self
+end
@@ -0,0 +1,50 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-12 10:21:47
+//
+
+// Matches PackedVertex in Asset/Mesh.hpp
+struct Vertex
+{
+    uint Normal;
+    uint Tangent;
+    uint UV;
+};
+
+// Matches PackedPosition, in the unit cube of the primitive's bounding box. The push constant transform maps it back.
+float3 UnpackPosition(uint2 packed)
+{
+    return float3(packed.x & 0xFFFF, packed.x >> 16, packed.y & 0xFFFF) / 65535.0;
+}
+
+float2 UnpackSnorm2x16(uint packed)
+{
+    int2 extended = int2(packed << 16, packed) >> 16;
+    return max(float2(extended) / 32767.0, -1.0);
+}
+
+float3 DecodeOctahedral(float2 encoded)
+{
+    float3 n = float3(encoded.x, encoded.y, 1.0 - abs(encoded.x) - abs(encoded.y));
+    float t = saturate(-n.z);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+float3 UnpackNormal(uint packed)
+{
+    return DecodeOctahedral(UnpackSnorm2x16(packed));
+}
+
+// The lowest bit of the second component is the bitangent sign, clear it before decoding
+float3 UnpackTangent(uint packed, out float bitangentSign)
+{
+    bitangentSign = (packed & 0x10000) ? -1.0 : 1.0;
+    return DecodeOctahedral(UnpackSnorm2x16(packed & ~0x10000u));
+}
+
+float2 UnpackUV(uint packed)
+{
+    return float2(f16tof32(packed), f16tof32(packed >> 16));
+}
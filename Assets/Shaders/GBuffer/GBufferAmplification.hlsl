@@ -44,6 +44,9 @@ struct PushConstants
     int ShowMeshlets;
     int MeshletBounds;
 
+    int PositionBuffer;
+    int3 Pad;
+
     column_major float4x4 Transform;
     column_major float4x4 InvTransform;
 };
@@ -40,7 +40,10 @@ struct PushConstants
     int PBRTexture;
     int LinearSampler;
     int ShowMeshlets;
-    int Padding;
+    int MeshletBounds;
+
+    int PositionBuffer;
+    int3 Pad;
 
     column_major float4x4 Transform;
     column_major float4x4 InvTransform;
@@ -4,15 +4,7 @@
 //
 
 #include "Assets/Shaders/Common/Math.hlsl"
-
-struct Vertex
-{
-    float3 Position : POSITION;
-    float2 TexCoords : TEXCOORD;
-    float3 Normals : NORMAL;
-    float3 Tangent : TANGENT;
-    float3 Bitangent : BITANGENT;
-};
+#include "Assets/Shaders/Common/Vertex.hlsl"
 
 struct Meshlet
 {
@@ -55,9 +47,12 @@ struct PushConstants
     int PBRTexture;
     int LinearSampler;
     int ShowMeshlets;
-    int Padding;
+    int MeshletBounds;
+
+    int PositionBuffer;
+    int3 Pad;
 
-    column_major float4x4 Transform;
+    column_major float4x4 Transform; // Includes the primitive's dequantization
     column_major float4x4 InvTransform;
 };
 
@@ -70,22 +65,24 @@ ConstantBuffer<PushConstants> Constants : register(b0);
 
 VertexOut GetVertexAttributes(uint meshletIndex, uint vertexIndex)
 {
+    StructuredBuffer<uint2> Positions = ResourceDescriptorHeap[Constants.PositionBuffer];
     StructuredBuffer<Vertex> Vertices = ResourceDescriptorHeap[Constants.VertexBuffer];
     ConstantBuffer<CameraMatrices> Matrices = ResourceDescriptorHeap[Constants.Matrices];
 
     // -------- //
     Vertex v = Vertices[vertexIndex];
-    float4 pos = float4(v.Position, 1.0);
+    float4 pos = float4(UnpackPosition(Positions[vertexIndex]), 1.0);
 
+    float bitangentSign;
     float3x3 normalMatrix = (float3x3)transpose(Constants.InvTransform);
-    float3 T = normalize(mul(normalMatrix, v.Tangent));
-    float3 B = normalize(mul(normalMatrix, v.Bitangent));
-    float3 N = normalize(mul(normalMatrix, v.Normals));
+    float3 T = normalize(mul(normalMatrix, UnpackTangent(v.Tangent, bitangentSign)));
+    float3 N = normalize(mul(normalMatrix, UnpackNormal(v.Normal)));
+    float3 B = cross(N, T) * bitangentSign;
 
     VertexOut Output = (VertexOut)0;
     Output.Position = mul(Matrices.Projection, mul(Matrices.View, mul(Constants.Transform, pos)));
     Output.WorldPosition = mul(Constants.Transform, pos);
-    Output.UV = v.TexCoords;
+    Output.UV = UnpackUV(v.UV);
     Output.Normals = N;
     Output.Tangent = T;
     Output.Bitangent = B;
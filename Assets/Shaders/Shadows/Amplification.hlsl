@@ -10,7 +10,7 @@ struct Payload
 
 struct PushConstants
 {
-    int VertexBuffer;
+    int PositionBuffer;
     int IndexBuffer;
     int MeshletBuffer;
     int MeshletVertices;
@@ -3,14 +3,7 @@
 // > Create Time: 2025-02-18 09:10:06
 //
 
-struct Vertex
-{
-    float3 Position : POSITION;
-    float2 TexCoords : TEXCOORD;
-    float3 Normals : NORMAL;
-    float3 Tangent : TANGENT;
-    float3 Bitangent : BITANGENT;
-};
+#include "Assets/Shaders/Common/Vertex.hlsl"
 
 struct Meshlet
 {
@@ -33,14 +26,14 @@ struct VertexOut
 
 struct PushConstants
 {
-    int VertexBuffer;
+    int PositionBuffer;
     int IndexBuffer;
     int MeshletBuffer;
     int MeshletVertices;
     int MeshletTriangleBuffer;
     int3 Pad;
 
-    column_major float4x4 Transform;
+    column_major float4x4 Transform; // Includes the primitive's dequantization
     column_major float4x4 LightView;
     column_major float4x4 LightProj;
 };
@@ -54,14 +47,13 @@ ConstantBuffer<PushConstants> Constants : register(b0);
 
 VertexOut GetVertexAttributes(uint meshletIndex, uint vertexIndex)
 {
-    StructuredBuffer<Vertex> Vertices = ResourceDescriptorHeap[Constants.VertexBuffer];
+    StructuredBuffer<uint2> Positions = ResourceDescriptorHeap[Constants.PositionBuffer];
 
     // -------- //
-    Vertex v = Vertices[vertexIndex];
-    float4 pos = float4(v.Position, 1.0);
+    float4 pos = float4(UnpackPosition(Positions[vertexIndex]), 1.0);
 
     VertexOut Output = (VertexOut)0;
-    float4 worldPosition = mul(Constants.Transform, float4(v.Position, 1.0f));
+    float4 worldPosition = mul(Constants.Transform, pos);
     float4 lightViewPosition = mul(Constants.LightView, worldPosition);
     Output.Clip = mul(Constants.LightProj, lightViewPosition);
     return Output;
@@ -0,0 +1,91 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-08 10:09:12
+//
+
+#include "BenchmarkReport.hpp"
+
+#include <Core/File.hpp>
+#include <Core/Logger.hpp>
+
+BenchmarkReport::Data BenchmarkReport::sData;
+
+void BenchmarkReport::AddTime(const String& name, Float64 milliseconds)
+{
+    sData.Results.push_back({ name, milliseconds, "ms", true });
+}
+
+void BenchmarkReport::AddThroughput(const String& name, Float64 value, const String& unit)
+{
+    sData.Results.push_back({ name, value, unit, false });
+}
+
+void BenchmarkReport::AddAllocations(const String& name, Float64 allocations, UInt64 budget)
+{
+    sData.Results.push_back({ name, allocations, "allocs", true });
+    if (budget != UINT64_MAX && allocations > budget) {
+        sData.BudgetFailures++;
+        LOG_ERROR("[Report] {0} makes {1:.1f} allocations per iteration, over its budget of {2}", name, allocations, budget);
+    }
+}
+
+void BenchmarkReport::Write(const String& path)
+{
+    nlohmann::json root;
+    root["results"] = nlohmann::json::array();
+    for (const BenchmarkResult& result : sData.Results) {
+        root["results"].push_back({
+            { "name", result.Name },
+            { "value", result.Value },
+            { "unit", result.Unit },
+            { "lowerIsBetter", result.LowerIsBetter }
+        });
+    }
+
+    File::WriteJSON(root, path);
+    LOG_INFO("[Report] Wrote {0} results to {1}", sData.Results.size(), path);
+}
+
+UInt32 BenchmarkReport::Compare(const String& path, Float64 tolerance)
+{
+    if (!File::Exists(path)) {
+        LOG_WARN("[Report] No baseline at {0}, skipping comparison", path);
+        return 0;
+    }
+
+    UnorderedMap<String, Float64> baseline;
+    nlohmann::json root = File::LoadJSON(path);
+    if (!root.contains("results")) {
+        LOG_WARN("[Report] Baseline {0} has no results, skipping comparison", path);
+        return 0;
+    }
+    for (const auto& result : root["results"]) {
+        baseline[result["name"].get<String>()] = result["value"].get<Float64>();
+    }
+
+    UInt32 regressions = 0;
+    LOG_INFO("[Report] Comparing against {0} (tolerance {1:.1f}%)", path, tolerance);
+    for (const BenchmarkResult& result : sData.Results) {
+        auto it = baseline.find(result.Name);
+        if (it == baseline.end() || it->second == 0.0) {
+            LOG_INFO("[Report] {0:40} {1:12.3f} {2} (new)", result.Name, result.Value, result.Unit);
+            continue;
+        }
+
+        Float64 change = (result.Value - it->second) / it->second * 100.0;
+        Float64 worse = result.LowerIsBetter ? change : -change;
+        if (worse > tolerance) {
+            regressions++;
+            LOG_ERROR("[Report] {0:40} {1:12.3f} {2} (baseline {3:.3f}, {4:+.1f}%) REGRESSION", result.Name, result.Value, result.Unit, it->second, change);
+        } else {
+            LOG_INFO("[Report] {0:40} {1:12.3f} {2} (baseline {3:.3f}, {4:+.1f}%)", result.Name, result.Value, result.Unit, it->second, change);
+        }
+    }
+
+    if (regressions) {
+        LOG_ERROR("[Report] {0} regression(s) over {1:.1f}%", regressions, tolerance);
+    } else {
+        LOG_INFO("[Report] No regressions");
+    }
+    return regressions;
+}
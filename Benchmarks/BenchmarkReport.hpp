@@ -0,0 +1,52 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-08 10:02:37
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+/// @brief A single measurement of the suite.
+struct BenchmarkResult
+{
+    String Name; ///< Unique name of the measurement, used to match it against the baseline.
+    Float64 Value = 0.0; ///< Measured value.
+    String Unit; ///< Unit of the value, for display.
+    bool LowerIsBetter = true; ///< Timings are better when lower, throughputs when higher.
+};
+
+/// @brief Collects the results of every benchmark, writes them as JSON and compares them against a baseline.
+///
+/// The JSON file holds a "results" array of { name, value, unit, lowerIsBetter } objects. A baseline is
+/// simply the output of an earlier run, committed or kept around to catch regressions.
+class BenchmarkReport
+{
+public:
+    /// @brief Adds a timing, in milliseconds.
+    static void AddTime(const String& name, Float64 milliseconds);
+
+    /// @brief Adds a throughput, where a higher value is better.
+    static void AddThroughput(const String& name, Float64 value, const String& unit);
+
+    /// @brief Adds a number of heap allocations per iteration, and fails the run if it's over budget.
+    /// @param budget Highest accepted value, UINT64_MAX to only report it.
+    static void AddAllocations(const String& name, Float64 allocations, UInt64 budget = UINT64_MAX);
+
+    /// @brief Gets the number of results that went over their budget.
+    static UInt32 GetBudgetFailures() { return sData.BudgetFailures; }
+
+    /// @brief Writes every result to a JSON file.
+    static void Write(const String& path);
+
+    /// @brief Compares the results against a previous run and logs the differences.
+    /// @param path Path of the baseline JSON file.
+    /// @param tolerance Relative change, in percent, above which a worse result counts as a regression.
+    /// @return The number of regressions.
+    static UInt32 Compare(const String& path, Float64 tolerance);
+private:
+    static struct Data {
+        Vector<BenchmarkResult> Results;
+        UInt32 BudgetFailures = 0;
+    } sData;
+};
@@ -0,0 +1,80 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-02 16:40:25
+//
+
+#include "JobSystemBenchmark.hpp"
+#include "BenchmarkReport.hpp"
+
+#include <Core/JobSystem.hpp>
+#include <Core/Logger.hpp>
+#include <Core/Timer.hpp>
+
+#include <cmath>
+
+constexpr UInt32 THROUGHPUT_JOB_COUNT = 1 << 20;
+constexpr UInt32 THROUGHPUT_BATCH_SIZE = 2048;
+constexpr UInt32 PARALLEL_FOR_COUNT = 1 << 20;
+constexpr UInt32 BENCHMARK_ITERATIONS = 8;
+
+static Vector<Float32> sParallelForOutput(PARALLEL_FOR_COUNT);
+
+void JobSystemBenchmark::Run()
+{
+    UInt32 hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    LOG_INFO("[JobSystem] {0} hardware threads", hardwareThreads);
+    LOG_INFO("[JobSystem] threads | jobs/s        | parallel for (ms) | speedup");
+
+    Float64 baseline = 0.0;
+    for (UInt32 threads = 1; threads <= hardwareThreads; threads++) {
+        JobSystem::Init(threads - 1);
+
+        Float64 throughput = MeasureThroughput();
+        Float64 parallelFor = MeasureParallelFor();
+        if (threads == 1)
+            baseline = parallelFor;
+
+        LOG_INFO("[JobSystem] {0:7} | {1:13.0f} | {2:17.3f} | {3:.2f}x", JobSystem::GetThreadCount(), throughput, parallelFor, baseline / parallelFor);
+
+        // Only the two ends of the sweep are reported, the thread count in between depends on the machine.
+        if (threads == 1 || threads == hardwareThreads) {
+            String suffix = threads == 1 ? " (1 thread)" : " (all threads)";
+            BenchmarkReport::AddThroughput("JobSystem Throughput" + suffix, throughput, "jobs/s");
+            BenchmarkReport::AddTime("JobSystem ParallelFor" + suffix, parallelFor);
+        }
+        JobSystem::Exit();
+    }
+}
+
+Float64 JobSystemBenchmark::MeasureThroughput()
+{
+    Timer timer;
+    for (UInt32 submitted = 0; submitted < THROUGHPUT_JOB_COUNT; submitted += THROUGHPUT_BATCH_SIZE) {
+        Job* root = JobSystem::CreateEmptyJob();
+        for (UInt32 i = 0; i < THROUGHPUT_BATCH_SIZE; i++) {
+            JobSystem::Run(JobSystem::CreateEmptyJob(root));
+        }
+        JobSystem::Run(root);
+        JobSystem::Wait(root);
+    }
+    Float64 seconds = TO_SECONDS(timer.GetElapsed());
+    return THROUGHPUT_JOB_COUNT / seconds;
+}
+
+Float64 JobSystemBenchmark::MeasureParallelFor()
+{
+    Float32* output = sParallelForOutput.data();
+
+    Timer timer;
+    for (UInt32 iteration = 0; iteration < BENCHMARK_ITERATIONS; iteration++) {
+        JobSystem::ParallelFor(PARALLEL_FOR_COUNT, 1024, [output](UInt32 index) {
+            Float32 value = static_cast<Float32>(index);
+            for (int i = 0; i < 32; i++) {
+                value = std::sqrt(value * 1.0001f + 1.0f) + std::sin(value);
+            }
+            output[index] = value;
+        });
+    }
+    return timer.GetElapsed() / BENCHMARK_ITERATIONS;
+}
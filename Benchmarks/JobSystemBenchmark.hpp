@@ -0,0 +1,24 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-02 16:40:18
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+/// @brief Measures job system throughput and how parallel work scales from 1 to N threads.
+class JobSystemBenchmark
+{
+public:
+    /// @brief Runs the benchmark and logs the results.
+    static void Run();
+private:
+    /// @brief Schedules empty jobs to measure raw scheduling overhead.
+    /// @return Jobs executed per second.
+    static Float64 MeasureThroughput();
+
+    /// @brief Runs a math-heavy ParallelFor.
+    /// @return The time it took, in milliseconds.
+    static Float64 MeasureParallelFor();
+};
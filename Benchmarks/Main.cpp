@@ -0,0 +1,42 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-02 16:38:02
+//
+
+#include <Core/Logger.hpp>
+
+#include <cstdlib>
+
+#include "BenchmarkReport.hpp"
+#include "JobSystemBenchmark.hpp"
+#include "PhysicsBenchmark.hpp"
+#include "SceneBenchmark.hpp"
+
+// Usage: Benchmarks [--output <path>] [--baseline <path>] [--tolerance <percent>]
+// Exits with 1 if any result regressed past the tolerance, so CI can fail on it.
+int main(int argc, char** argv)
+{
+    String output = "Benchmarks/Results.json";
+    String baseline = "Benchmarks/Baseline.json";
+    Float64 tolerance = 10.0;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        String option = argv[i];
+        if (option == "--output") {
+            output = argv[i + 1];
+        } else if (option == "--baseline") {
+            baseline = argv[i + 1];
+        } else if (option == "--tolerance") {
+            tolerance = std::atof(argv[i + 1]);
+        }
+    }
+
+    Logger::Init();
+
+    JobSystemBenchmark::Run();
+    PhysicsBenchmark::Run();
+    SceneBenchmark::Run(StressSceneSpecs());
+
+    BenchmarkReport::Write(output);
+    UInt32 regressions = BenchmarkReport::Compare(baseline, tolerance);
+    return (regressions || BenchmarkReport::GetBudgetFailures()) ? 1 : 0;
+}
@@ -0,0 +1,86 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-03 11:04:46
+//
+
+#include "PhysicsBenchmark.hpp"
+#include "BenchmarkReport.hpp"
+
+#include <Core/JobSystem.hpp>
+#include <Core/Logger.hpp>
+#include <Core/Timer.hpp>
+
+#include <Physics/PhysicsSystem.hpp>
+#include <Physics/Rigidbody.hpp>
+#include <World/Entity.hpp>
+
+constexpr UInt32 PHYSICS_BODY_GRID = 20; // 20 * 20 * 20 = 8000 dynamic bodies
+constexpr UInt32 PHYSICS_WARMUP_STEPS = 10;
+constexpr UInt32 PHYSICS_STEPS = 240;
+constexpr float PHYSICS_STEP_DURATION = 1.0f / 60.0f;
+
+void PhysicsBenchmark::Run()
+{
+    JobSystem::Init();
+
+    Float64 threadPool = Simulate(PhysicsJobBackend::JoltThreadPool);
+    Float64 engine = Simulate(PhysicsJobBackend::Engine);
+
+    UInt32 bodyCount = PHYSICS_BODY_GRID * PHYSICS_BODY_GRID * PHYSICS_BODY_GRID;
+    LOG_INFO("[Physics] {0} dynamic bodies, {1} steps", bodyCount, PHYSICS_STEPS);
+    LOG_INFO("[Physics] JPH::JobSystemThreadPool : {0:.3f}ms/step", threadPool);
+    LOG_INFO("[Physics] Engine job system        : {0:.3f}ms/step ({1:.2f}x)", engine, threadPool / engine);
+    BenchmarkReport::AddTime("Physics Step (Jolt thread pool)", threadPool);
+    BenchmarkReport::AddTime("Physics Step (engine job system)", engine);
+
+    JobSystem::Exit();
+}
+
+Float64 PhysicsBenchmark::Simulate(PhysicsJobBackend backend)
+{
+    PhysicsSystem::Init(backend);
+
+    Float64 average = 0.0;
+    {
+        Ref<Scene> scene = MakeRef<Scene>();
+        BoxCollider floorShape(glm::vec3(500.0f, 1.0f, 500.0f));
+        BoxCollider boxShape(glm::vec3(0.5f));
+
+        Entity floor = scene->AddEntity("Floor");
+        auto& floorBody = floor.AddComponent<Rigidbody>(floorShape, 0.0f, true);
+        PhysicsSystem::GetInterface()->SetPosition(floorBody.GetBody()->GetID(), JPH::Vec3(0.0f, -1.0f, 0.0f), JPH::EActivation::DontActivate);
+
+        for (UInt32 x = 0; x < PHYSICS_BODY_GRID; x++) {
+            for (UInt32 y = 0; y < PHYSICS_BODY_GRID; y++) {
+                for (UInt32 z = 0; z < PHYSICS_BODY_GRID; z++) {
+                    Entity box = scene->AddEntity("Box");
+                    auto& body = box.AddComponent<Rigidbody>(boxShape, 1.0f, false);
+
+                    // Slight offset per layer so the stacks topple instead of settling instantly
+                    JPH::Vec3 position(x * 1.5f + y * 0.1f, 1.0f + y * 1.5f, z * 1.5f);
+                    PhysicsSystem::GetInterface()->SetPosition(body.GetBody()->GetID(), position, JPH::EActivation::DontActivate);
+                }
+            }
+        }
+
+        PhysicsSystem::OnAwake(scene);
+        for (UInt32 i = 0; i < PHYSICS_WARMUP_STEPS; i++) {
+            PhysicsSystem::Update(scene, PHYSICS_STEP_DURATION);
+        }
+
+        Timer timer;
+        for (UInt32 i = 0; i < PHYSICS_STEPS; i++) {
+            PhysicsSystem::Update(scene, PHYSICS_STEP_DURATION);
+        }
+        average = timer.GetElapsed() / PHYSICS_STEPS;
+
+        auto view = scene->GetRegistry()->view<Rigidbody>();
+        for (auto [id, rb] : view.each()) {
+            PhysicsSystem::GetInterface()->RemoveBody(rb.GetBody()->GetID());
+            PhysicsSystem::GetInterface()->DestroyBody(rb.GetBody()->GetID());
+        }
+    }
+
+    PhysicsSystem::Exit();
+    return average;
+}
@@ -0,0 +1,23 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-03 11:04:39
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+enum class PhysicsJobBackend;
+
+/// @brief Simulates a pile of dynamic rigidbodies with Jolt's own thread pool and with the engine job system.
+class PhysicsBenchmark
+{
+public:
+    /// @brief Runs the benchmark and logs the results.
+    static void Run();
+private:
+    /// @brief Builds the scene, steps it and tears it down.
+    /// @param backend The job backend Jolt should use.
+    /// @return The average step time, in milliseconds.
+    static Float64 Simulate(PhysicsJobBackend backend);
+};
@@ -0,0 +1,189 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-08 10:55:29
+//
+
+#include "SceneBenchmark.hpp"
+#include "BenchmarkReport.hpp"
+
+#include <Core/File.hpp>
+#include <Core/Logger.hpp>
+#include <Core/Timer.hpp>
+#include <Core/Memory.hpp>
+
+#include <Asset/AssetManager.hpp>
+#include <RHI/Uploader.hpp>
+#include <Renderer/RenderSnapshot.hpp>
+#include <World/LightManager.hpp>
+#include <World/SceneSerializer.hpp>
+#include <Script/ScriptSystem.hpp>
+
+#include <cmath>
+
+constexpr UInt32 SCENE_WARMUP_ITERATIONS = 5;
+constexpr UInt32 SCENE_ITERATIONS = 100;
+constexpr UInt32 SERIALIZER_ITERATIONS = 3;
+constexpr UInt32 MESHLET_ITERATIONS = 5;
+constexpr UInt32 MESHLET_GRID_SIZE = 256; // 256 * 256 vertices, ~130k triangles
+constexpr float SCRIPT_STEP_DURATION = 1.0f / 60.0f;
+constexpr UInt64 NO_ALLOCATION_BUDGET = UINT64_MAX; // Only reports allocations
+constexpr UInt64 ZERO_ALLOCATIONS = 0; // Per-frame systems must not touch the heap once warmed up
+constexpr UInt64 FRAME_ALLOCATION_BUDGET = 512; // Render passes build a few small lists each, anything per entity blows far past it
+
+static const char* STRESS_SCENE_PATH = "Benchmarks/StressScene.json";
+
+BenchmarkApplication::BenchmarkApplication(ApplicationSpecs specs)
+    : Application(specs)
+{
+    mScenePlaying = true;
+}
+
+void BenchmarkApplication::RunFrame()
+{
+    mScene->Update();
+    mRenderer->Extract(mScene);
+    mRenderer->Swap();
+    OnPrivateRender();
+}
+
+template<typename F>
+Float64 SceneBenchmark::Measure(const String& name, UInt32 warmup, UInt32 iterations, UInt64 allocationBudget, F&& function)
+{
+    for (UInt32 i = 0; i < warmup; i++) {
+        function();
+    }
+
+    // Counted across every thread, jobs spawned by the function allocate on workers.
+    MemoryAllocationCount allocationsBefore = Memory::GetTotalAllocations();
+    Timer timer;
+    for (UInt32 i = 0; i < iterations; i++) {
+        function();
+    }
+    Float64 average = timer.GetElapsed() / iterations;
+    Float64 allocations = Float64(Memory::GetTotalAllocations().Allocations - allocationsBefore.Allocations) / iterations;
+
+    LOG_INFO("[Scene] {0:28} : {1:.3f}ms, {2:.1f} allocs", name, average, allocations);
+    BenchmarkReport::AddTime(name, average);
+    BenchmarkReport::AddAllocations(name + " Allocations", allocations, allocationBudget);
+    return average;
+}
+
+void SceneBenchmark::Run(const StressSceneSpecs& specs)
+{
+    ApplicationSpecs appSpecs = {};
+    appSpecs.Width = 1280;
+    appSpecs.Height = 720;
+    appSpecs.WindowTitle = "Mnemen Benchmarks";
+    appSpecs.CopyToBackBuffer = false;
+
+    BenchmarkApplication app(appSpecs);
+
+    Ref<Scene> scene = StressScene::Generate(specs);
+    app.SetScene(scene);
+
+    // Meshes load in the background, the frame is only representative once they're all in
+    while (AssetManager::GetPendingCount() > 0) {
+        AssetManager::Update();
+    }
+    Uploader::Flush();
+
+    // Per-frame systems
+    Measure("Scene::Update", SCENE_WARMUP_ITERATIONS, SCENE_ITERATIONS, ZERO_ALLOCATIONS, [&]() {
+        scene->Update();
+    });
+
+    RenderSnapshot snapshot;
+    Measure("RenderSnapshot::Extract", SCENE_WARMUP_ITERATIONS, SCENE_ITERATIONS, ZERO_ALLOCATIONS, [&]() {
+        snapshot.Extract(scene);
+    });
+
+    const RenderCamera* camera = snapshot.GetMainCamera();
+    if (camera) {
+        UInt64 visible = 0;
+        UInt64 culled = 0;
+        auto cullNode = [&](auto& self, MeshNode* node, const glm::mat4& transform) -> void {
+            if (!node)
+                return;
+            for (MeshPrimitive& primitive : node->Primitives) {
+                if (primitive.IsBoxInFrustum(transform, camera->View, camera->Projection))
+                    visible++;
+                else
+                    culled++;
+            }
+            for (MeshNode* child : node->Children) {
+                self(self, child, transform);
+            }
+        };
+
+        Measure("Frustum Culling", SCENE_WARMUP_ITERATIONS, SCENE_ITERATIONS, ZERO_ALLOCATIONS, [&]() {
+            visible = 0;
+            culled = 0;
+            for (const RenderInstance& instance : snapshot.Instances) {
+                cullNode(cullNode, instance.MeshAsset->Mesh.Root, instance.Transform);
+            }
+        });
+        LOG_INFO("[Scene] Culling kept {0} primitives and rejected {1}", visible, culled);
+    } else {
+        LOG_WARN("[Scene] The stress scene has no main camera, skipping frustum culling");
+    }
+
+    UInt32 frameIndex = 0;
+    Measure("LightManager::Update", SCENE_WARMUP_ITERATIONS, SCENE_ITERATIONS, ZERO_ALLOCATIONS, [&]() {
+        Frame frame = {};
+        frame.FrameIndex = frameIndex++ % FRAMES_IN_FLIGHT;
+        LightManager::Update(frame, snapshot);
+    });
+
+    // Everything above together, plus recording every render pass. Meant for the null backend, where it measures the CPU side only.
+    Measure("Full Frame", SCENE_WARMUP_ITERATIONS, SCENE_ITERATIONS, FRAME_ALLOCATION_BUDGET, [&]() {
+        app.RunFrame();
+    });
+
+    ScriptSystem::Awake(scene);
+    // Lua allocates as it runs, scripts are only reported
+    Measure("ScriptSystem::Update", SCENE_WARMUP_ITERATIONS, SCENE_ITERATIONS, NO_ALLOCATION_BUDGET, [&]() {
+        ScriptSystem::Update(scene, SCRIPT_STEP_DURATION);
+    });
+
+    // Tooling
+    Measure("SceneSerializer::Serialize", 1, SERIALIZER_ITERATIONS, NO_ALLOCATION_BUDGET, [&]() {
+        SceneSerializer::SerializeScene(scene, STRESS_SCENE_PATH);
+    });
+    Measure("SceneSerializer::Deserialize", 1, SERIALIZER_ITERATIONS, NO_ALLOCATION_BUDGET, [&]() {
+        Ref<Scene> loaded = SceneSerializer::DeserializeScene(STRESS_SCENE_PATH);
+    });
+    File::Delete(STRESS_SCENE_PATH);
+
+    // Meshlet building, on a bumpy grid so meshopt can't take shortcuts
+    {
+        Vector<Vertex> vertices(MESHLET_GRID_SIZE * MESHLET_GRID_SIZE);
+        for (UInt32 y = 0; y < MESHLET_GRID_SIZE; y++) {
+            for (UInt32 x = 0; x < MESHLET_GRID_SIZE; x++) {
+                Vertex& vertex = vertices[y * MESHLET_GRID_SIZE + x];
+                vertex = {};
+                vertex.Position = glm::vec3(x, std::sin(x * 0.3f) * std::cos(y * 0.2f) * 4.0f, y);
+                vertex.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+                vertex.UV = glm::vec2(x, y) / float(MESHLET_GRID_SIZE);
+            }
+        }
+
+        Vector<UInt32> indices;
+        indices.reserve((MESHLET_GRID_SIZE - 1) * (MESHLET_GRID_SIZE - 1) * 6);
+        for (UInt32 y = 0; y < MESHLET_GRID_SIZE - 1; y++) {
+            for (UInt32 x = 0; x < MESHLET_GRID_SIZE - 1; x++) {
+                UInt32 i = y * MESHLET_GRID_SIZE + x;
+                indices.insert(indices.end(), { i, i + MESHLET_GRID_SIZE, i + 1, i + 1, i + MESHLET_GRID_SIZE, i + MESHLET_GRID_SIZE + 1 });
+            }
+        }
+
+        UInt64 meshletCount = 0;
+        Measure("Mesh::BuildMeshlets", 1, MESHLET_ITERATIONS, NO_ALLOCATION_BUDGET, [&]() {
+            meshletCount = Mesh::BuildMeshlets(vertices, indices).Meshlets.size();
+        });
+        LOG_INFO("[Scene] Built {0} meshlets from {1} triangles", meshletCount, indices.size() / 3);
+    }
+
+    // The uploader keeps flushed batches until it sees them complete, drop them while the RHI is still around
+    app.GetRHI()->Wait();
+    Uploader::ClearRequests();
+}
@@ -0,0 +1,48 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-08 10:48:03
+//
+
+#pragma once
+
+#include <Core/Application.hpp>
+
+#include "StressScene.hpp"
+
+/// @brief Headless application hosting the stress scene, so systems relying on Application::Get() work as in game.
+class BenchmarkApplication : public Application
+{
+public:
+    BenchmarkApplication(ApplicationSpecs specs);
+
+    void OnUpdate(float dt) override {}
+    void OnPhysicsTick() override {}
+    void OnImGui(const Frame& frame) override {}
+
+    /// @brief Makes a scene the active scene of the application.
+    void SetScene(Ref<Scene> scene) { mScene = scene; }
+
+    /// @brief Gets the render hardware interface of the application.
+    RHI::Ref GetRHI() { return mRHI; }
+
+    /// @brief Runs the scene update, render extract and render of a frame like Application::Run, rendering on the calling thread.
+    void RunFrame();
+};
+
+/// @brief Times the per-frame CPU systems and the scene tooling on a procedural stress scene.
+class SceneBenchmark
+{
+public:
+    /// @brief Runs the benchmark and adds its results to the BenchmarkReport.
+    static void Run(const StressSceneSpecs& specs);
+private:
+    /// @brief Runs a function a few times to warm caches up, then times it and reports the average time and allocation count.
+    /// @param name Name of the result.
+    /// @param warmup Number of untimed runs.
+    /// @param iterations Number of timed runs.
+    /// @param allocationBudget Heap allocations a warmed-up run may make before the suite fails, UINT64_MAX to only report them.
+    /// @param function The code to time.
+    /// @return The average time of a run, in milliseconds.
+    template<typename F>
+    static Float64 Measure(const String& name, UInt32 warmup, UInt32 iterations, UInt64 allocationBudget, F&& function);
+};
@@ -0,0 +1,88 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-08 10:26:40
+//
+
+#include "StressScene.hpp"
+
+#include <Core/Logger.hpp>
+
+#include <algorithm>
+#include <random>
+
+Ref<Scene> StressScene::Generate(const StressSceneSpecs& specs)
+{
+    Ref<Scene> scene = MakeRef<Scene>();
+    std::mt19937 generator(specs.Seed);
+    std::uniform_real_distribution<float> position(-specs.Extent, specs.Extent);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    auto randomPosition = [&]() { return glm::vec3(position(generator), position(generator), position(generator)); };
+
+    // Camera in the middle of the scene, so culling keeps part of it and rejects the rest
+    {
+        Entity camera = scene->AddDefaultCamera("Stress Camera");
+        camera.GetComponent<TransformComponent>().Position = glm::vec3(0.0f, 0.0f, -specs.Extent * 0.5f);
+    }
+
+    // Deep hierarchies: every HierarchyDepth entities form a parent -> child chain
+    {
+        UInt32 depth = std::max(specs.HierarchyDepth, 1u);
+        Entity parent;
+        for (UInt32 i = 0; i < specs.EntityCount; i++) {
+            Entity entity = scene->AddEntity("Node");
+            TransformComponent& transform = entity.GetComponent<TransformComponent>();
+            if (i % depth == 0) {
+                transform.Position = randomPosition();
+            } else {
+                transform.Position = glm::vec3(1.0f, 0.0f, 0.0f);
+                transform.Rotation = glm::quat(glm::vec3(0.0f, unit(generator), 0.0f));
+                entity.SetParent(parent);
+            }
+            parent = entity;
+        }
+    }
+
+    // Meshes, cycling through the primitive models so several assets are in flight
+    for (UInt32 i = 0; i < specs.MeshCount; i++) {
+        Entity entity;
+        switch (i % 5) {
+            case 0: entity = scene->AddDefaultCube("Mesh"); break;
+            case 1: entity = scene->AddDefaultSphere("Mesh"); break;
+            case 2: entity = scene->AddDefaultPlane("Mesh"); break;
+            case 3: entity = scene->AddDefaultCapsule("Mesh"); break;
+            default: entity = scene->AddDefaultCylinder("Mesh"); break;
+        }
+        entity.GetComponent<TransformComponent>().Position = randomPosition();
+    }
+
+    // Lights
+    for (UInt32 i = 0; i < specs.PointLightCount; i++) {
+        Entity entity = scene->AddEntity("Point Light");
+        entity.GetComponent<TransformComponent>().Position = randomPosition();
+
+        PointLightComponent& light = entity.AddComponent<PointLightComponent>();
+        light.Color = glm::vec3(unit(generator), unit(generator), unit(generator));
+        light.Radius = 1.0f + unit(generator) * 10.0f;
+    }
+    for (UInt32 i = 0; i < specs.SpotLightCount; i++) {
+        Entity entity = scene->AddEntity("Spot Light");
+        TransformComponent& transform = entity.GetComponent<TransformComponent>();
+        transform.Position = randomPosition();
+        transform.Rotation = glm::quat(glm::vec3(unit(generator), unit(generator), unit(generator)) * 6.28f);
+
+        SpotLightComponent& light = entity.AddComponent<SpotLightComponent>();
+        light.Color = glm::vec3(unit(generator), unit(generator), unit(generator));
+    }
+
+    // Scripts
+    for (UInt32 i = 0; i < specs.ScriptCount; i++) {
+        Entity entity = scene->AddEntity("Scripted");
+        entity.GetComponent<TransformComponent>().Position = randomPosition();
+        entity.GetComponent<ScriptComponent>().PushScript("Assets/Scripts/Benchmark.lua");
+    }
+
+    LOG_INFO("[Stress] Generated {0} entities, {1} meshes, {2} point lights, {3} spot lights, {4} scripts",
+             specs.EntityCount, specs.MeshCount, specs.PointLightCount, specs.SpotLightCount, specs.ScriptCount);
+    return scene;
+}
@@ -0,0 +1,29 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-08 10:21:54
+//
+
+#pragma once
+
+#include <World/Scene.hpp>
+
+/// @brief Shape of a procedurally generated stress scene.
+struct StressSceneSpecs
+{
+    UInt32 EntityCount = 20000; ///< Empty transform-only entities, chained into hierarchies.
+    UInt32 HierarchyDepth = 16; ///< Length of each parent/child chain.
+    UInt32 MeshCount = 4000; ///< Entities with a MeshComponent, cycling through the primitive models.
+    UInt32 PointLightCount = 2000; ///< Entities with a PointLightComponent.
+    UInt32 SpotLightCount = 1000; ///< Entities with a SpotLightComponent.
+    UInt32 ScriptCount = 1000; ///< Entities running the benchmark Lua script.
+    float Extent = 500.0f; ///< Half size of the cube everything is scattered in.
+    UInt32 Seed = 1337; ///< Seed of the generator, the same seed always gives the same scene.
+};
+
+/// @brief Builds large synthetic scenes to measure the engine's CPU systems.
+class StressScene
+{
+public:
+    /// @brief Generates a scene, with a primary camera looking at its center.
+    static Ref<Scene> Generate(const StressSceneSpecs& specs);
+};
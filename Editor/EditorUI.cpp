@@ -258,6 +258,9 @@ void Editor::BeginDockSpace()
             if (ImGui::MenuItem(ICON_FA_PENCIL " Close")) {
                 mMarkForClose = true;
             }
+            if (ImGui::MenuItem(ICON_FA_ARCHIVE " Pack Assets")) {
+                AssetArchive::Pack("Assets", "Assets.mpak");
+            }
             if (ImGui::MenuItem(ICON_FA_WINDOW_CLOSE " Exit", "Ctrl+Q")) {
                 SaveScene();
                 mWindow->Close();
@@ -7,23 +7,30 @@
 
 #include "Mnemen/AI/AISystem.hpp"
 
+#include "Mnemen/Asset/AssetArchive.hpp"
 #include "Mnemen/Asset/AssetCacher.hpp"
 #include "Mnemen/Asset/AssetManager.hpp"
 #include "Mnemen/Asset/Image.hpp"
 #include "Mnemen/Asset/Mesh.hpp"
 #include "Mnemen/Asset/Shader.hpp"
+#include "Mnemen/Asset/TextureStreamer.hpp"
 
 #include "Mnemen/Audio/AudioFile.hpp"
 #include "Mnemen/Audio/AudioSystem.hpp"
 
 #include "Mnemen/Core/Application.hpp"
+#include "Mnemen/Core/Arena.hpp"
 #include "Mnemen/Core/Assert.hpp"
 #include "Mnemen/Core/Common.hpp"
+#include "Mnemen/Core/Counters.hpp"
 #include "Mnemen/Core/File.hpp"
+#include "Mnemen/Core/JobSystem.hpp"
+#include "Mnemen/Core/Memory.hpp"
 #include "Mnemen/Core/Logger.hpp"
 #include "Mnemen/Core/Profiler.hpp"
 #include "Mnemen/Core/Project.hpp"
 #include "Mnemen/Core/Random.hpp"
+#include "Mnemen/Core/Replay.hpp"
 #include "Mnemen/Core/Timer.hpp"
 #include "Mnemen/Core/UTF.hpp"
 #include "Mnemen/Core/Window.hpp"
@@ -36,6 +43,7 @@
 #include "Mnemen/Renderer/Renderer.hpp"
 #include "Mnemen/Renderer/RendererTools.hpp"
 #include "Mnemen/Renderer/RenderPass.hpp"
+#include "Mnemen/Renderer/RenderSnapshot.hpp"
 #include "Mnemen/Renderer/Skybox.hpp"
 #include "Mnemen/Renderer/SkyboxCooker.hpp"
 
@@ -59,7 +67,11 @@
 #include "Mnemen/RHI/Texture.hpp"
 #include "Mnemen/RHI/TLAS.hpp"
 #include "Mnemen/RHI/Uploader.hpp"
-#include "Mnemen/RHI/Utilities.hpp"
+#if defined(MNEMEN_RHI_NULL)
+    #include "Mnemen/RHI/Null/NullStats.hpp"
+#else
+    #include "Mnemen/RHI/Utilities.hpp"
+#endif
 #include "Mnemen/RHI/View.hpp"
 
 #include "Mnemen/Script/Script.hpp"
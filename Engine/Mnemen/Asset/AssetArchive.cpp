@@ -0,0 +1,184 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-10 09:58:12
+//
+
+#include <Asset/AssetArchive.hpp>
+#include <Core/Logger.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+
+AssetArchive::Data AssetArchive::sData;
+
+static UInt64 AlignArchiveOffset(UInt64 offset)
+{
+    return (offset + ASSET_ARCHIVE_ALIGNMENT - 1) & ~(ASSET_ARCHIVE_ALIGNMENT - 1);
+}
+
+bool AssetArchive::Pack(const String& assetDirectory, const String& archivePath)
+{
+    if (IsMounted()) {
+        LOG_ERROR("[Archive] Unmount the archive before packing, assets would be read back from it");
+        return false;
+    }
+
+    struct PackedAsset {
+        String Path;
+        String Cached;
+        UInt64 Hash;
+    };
+
+    Vector<PackedAsset> assets;
+    for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(assetDirectory)) {
+        String entryPath = dirEntry.path().string();
+        std::replace(entryPath.begin(), entryPath.end(), '\\', '/');
+        if (AssetCacher::GetAssetTypeFromPath(entryPath) == AssetType::None) {
+            continue;
+        }
+
+        AssetCacher::CacheAsset(entryPath);
+        String cached = AssetCacher::GetCachedAsset(entryPath);
+        if (!File::Exists(cached)) {
+            LOG_WARN("[Archive] {0} failed to cook and won't be packed", entryPath);
+            continue;
+        }
+        assets.push_back({ entryPath, cached, AssetCacher::HashPath(entryPath) });
+    }
+
+    std::sort(assets.begin(), assets.end(), [](const PackedAsset& a, const PackedAsset& b) {
+        return a.Hash < b.Hash;
+    });
+    for (UInt64 i = 1; i < assets.size(); i++) {
+        if (assets[i].Hash == assets[i - 1].Hash) {
+            LOG_ERROR("[Archive] {0} and {1} have the same path hash, rename one of them", assets[i - 1].Path, assets[i].Path);
+            return false;
+        }
+    }
+
+    std::ofstream stream(archivePath, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) {
+        LOG_ERROR("[Archive] Failed to open {0} for writing", archivePath);
+        return false;
+    }
+
+    AssetArchiveHeader header = {};
+    header.Magic = ASSET_ARCHIVE_MAGIC;
+    header.Version = ASSET_ARCHIVE_VERSION;
+    header.EntryCount = assets.size();
+
+    // Payloads are streamed one at a time, the table and the paths are written once every offset is known
+    Vector<AssetArchiveEntry> entries(assets.size());
+    UInt64 pathOffset = sizeof(AssetArchiveHeader) + entries.size() * sizeof(AssetArchiveEntry);
+    UInt64 offset = pathOffset;
+    for (const PackedAsset& asset : assets) {
+        offset += asset.Path.size();
+    }
+    offset = AlignArchiveOffset(offset);
+    stream.seekp(offset);
+    for (UInt64 i = 0; i < assets.size(); i++) {
+        AssetFile file = AssetCacher::ReadAsset(assets[i].Path);
+
+        AssetArchiveEntry& entry = entries[i];
+        entry.Hash = assets[i].Hash;
+        entry.PathOffset = pathOffset;
+        entry.PathLength = assets[i].Path.size();
+        pathOffset += entry.PathLength;
+        entry.Offset = offset;
+        entry.Size = file.Size;
+        entry.Header = file.Header;
+
+        stream.seekp(offset);
+        stream.write(reinterpret_cast<const char*>(file.Bytes), file.Size);
+        offset = AlignArchiveOffset(offset + file.Size);
+    }
+
+    stream.seekp(0);
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    stream.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(AssetArchiveEntry));
+    for (const PackedAsset& asset : assets) {
+        stream.write(asset.Path.data(), asset.Path.size());
+    }
+    if (!stream.good()) {
+        LOG_ERROR("[Archive] Failed to write {0}", archivePath);
+        return false;
+    }
+
+    LOG_INFO("[Archive] Packed {0} assets in {1} ({2} MB)", assets.size(), archivePath, offset / (1024 * 1024));
+    return true;
+}
+
+bool AssetArchive::Mount(const String& archivePath)
+{
+    Unmount();
+    if (!sData.File.Open(archivePath)) {
+        return false;
+    }
+
+    const UInt8* data = sData.File.GetData();
+    UInt64 size = sData.File.GetSize();
+    const AssetArchiveHeader* header = reinterpret_cast<const AssetArchiveHeader*>(data);
+    if (size < sizeof(AssetArchiveHeader) || header->Magic != ASSET_ARCHIVE_MAGIC) {
+        LOG_ERROR("[Archive] {0} isn't an asset archive", archivePath);
+        sData.File.Close();
+        return false;
+    }
+    if (header->Version != ASSET_ARCHIVE_VERSION) {
+        LOG_ERROR("[Archive] {0} has version {1}, expected {2}", archivePath, header->Version, ASSET_ARCHIVE_VERSION);
+        sData.File.Close();
+        return false;
+    }
+    if (header->EntryCount > (size - sizeof(AssetArchiveHeader)) / sizeof(AssetArchiveEntry)) {
+        LOG_ERROR("[Archive] {0} is truncated", archivePath);
+        sData.File.Close();
+        return false;
+    }
+
+    // Payloads are handed out as raw pointers into the mapping, an entry pointing past the end would read out of it
+    const AssetArchiveEntry* entries = reinterpret_cast<const AssetArchiveEntry*>(data + sizeof(AssetArchiveHeader));
+    for (UInt64 i = 0; i < header->EntryCount; i++) {
+        const AssetArchiveEntry& entry = entries[i];
+        if (entry.Offset > size || entry.Size > size - entry.Offset || entry.PathOffset > size || entry.PathLength > size - entry.PathOffset) {
+            LOG_ERROR("[Archive] {0} is corrupted, entry {1} lies outside of the archive", archivePath, i);
+            sData.File.Close();
+            return false;
+        }
+    }
+
+    sData.Entries = entries;
+    sData.EntryCount = header->EntryCount;
+    LOG_INFO("[Archive] Mounted {0} with {1} assets", archivePath, sData.EntryCount);
+    return true;
+}
+
+void AssetArchive::Unmount()
+{
+    sData.File.Close();
+    sData.Entries = nullptr;
+    sData.EntryCount = 0;
+}
+
+const AssetArchiveEntry* AssetArchive::Find(const String& normalPath)
+{
+    if (!sData.Entries) {
+        return nullptr;
+    }
+
+    UInt64 hash = AssetCacher::HashPath(normalPath);
+    const AssetArchiveEntry* end = sData.Entries + sData.EntryCount;
+    const AssetArchiveEntry* entry = std::lower_bound(sData.Entries, end, hash, [](const AssetArchiveEntry& entry, UInt64 hash) {
+        return entry.Hash < hash;
+    });
+    if (entry == end || entry->Hash != hash) {
+        return nullptr;
+    }
+
+    // Another path with the same hash would otherwise get this asset
+    std::string_view path(reinterpret_cast<const char*>(sData.File.GetData() + entry->PathOffset), entry->PathLength);
+    if (path != normalPath) {
+        return nullptr;
+    }
+    return entry;
+}
@@ -0,0 +1,74 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-10 09:41:27
+//
+
+#pragma once
+
+#include <Asset/AssetCacher.hpp>
+#include <Core/MappedFile.hpp>
+
+constexpr UInt32 ASSET_ARCHIVE_MAGIC = 0x4B41504D; ///< "MPAK", little endian.
+constexpr UInt32 ASSET_ARCHIVE_VERSION = 2; ///< Bumped whenever the archive layout changes.
+constexpr UInt64 ASSET_ARCHIVE_ALIGNMENT = 512; ///< Alignment of every payload, matches D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT.
+
+/// @brief First bytes of an archive.
+struct AssetArchiveHeader
+{
+    UInt32 Magic;
+    UInt32 Version;
+    UInt64 EntryCount; ///< Number of entries in the table of contents, which directly follows the header.
+};
+
+/// @brief An entry of the table of contents.
+struct AssetArchiveEntry
+{
+    UInt64 Hash; ///< AssetCacher::HashPath of the asset's source path. The table is sorted on it.
+    UInt64 PathOffset; ///< Offset of the source path from the start of the archive, compared on lookups since hashes can collide.
+    UInt64 PathLength; ///< Length of the source path, it isn't null terminated.
+    UInt64 Offset; ///< Offset of the payload from the start of the archive.
+    UInt64 Size; ///< Size of the payload, in bytes.
+    struct AssetFile::Header Header; ///< Header of the cooked asset, so metadata never touches the payload.
+};
+
+/// @brief A single file holding every cooked asset of a project, for shipping builds.
+///
+/// The archive is a header, a table of contents sorted by path hash, the source paths, then the
+/// cooked payloads aligned to ASSET_ARCHIVE_ALIGNMENT. Mounting it maps the whole file: looking an asset up is a
+/// binary search in the mapped table, and reading it is a pointer into the mapping, without any
+/// filesystem call.
+class AssetArchive
+{
+public:
+    /// @brief Cooks every stale asset of a directory and packs the cooked assets in an archive.
+    /// @param assetDirectory The directory where assets are stored.
+    /// @param archivePath The archive to write.
+    /// @return Whether the archive was written.
+    static bool Pack(const String& assetDirectory, const String& archivePath);
+
+    /// @brief Maps an archive, assets it contains are read from it from now on.
+    /// @param archivePath The archive to map.
+    /// @return Whether the file is a valid archive.
+    static bool Mount(const String& archivePath);
+
+    /// @brief Unmaps the archive.
+    static void Unmount();
+
+    /// @brief Returns whether an archive is mounted.
+    static bool IsMounted() { return sData.File.IsOpen(); }
+
+    /// @brief Looks an asset up in the mounted archive.
+    /// @param normalPath The source path of the asset.
+    /// @return The asset's entry, or nullptr if no archive is mounted or it isn't in it.
+    static const AssetArchiveEntry* Find(const String& normalPath);
+
+    /// @brief Gets the payload of an entry, valid until the archive is unmounted.
+    /// @param entry An entry returned by Find.
+    static const UInt8* GetPayload(const AssetArchiveEntry* entry) { return sData.File.GetData() + entry->Offset; }
+private:
+    static struct Data {
+        MappedFile File;
+        const AssetArchiveEntry* Entries = nullptr; ///< Table of contents, inside the mapping.
+        UInt64 EntryCount = 0;
+    } sData;
+};
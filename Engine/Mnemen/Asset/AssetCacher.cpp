@@ -4,13 +4,26 @@
 //
 
 #include <Asset/AssetCacher.hpp>
+#include <Asset/AssetArchive.hpp>
 #include <Core/Logger.hpp>
 #include <Core/Application.hpp>
+#include <Core/JobSystem.hpp>
+#include <Core/Memory.hpp>
+#include <Core/Profiler.hpp>
+#include <Core/Timer.hpp>
+
+#include <stb/stb_image.h>
 
 #include <filesystem>
 
+/// @brief Bytes a texture takes while it is cooked: nvtt decodes it to 4 float channels, and building a mip keeps the previous level around.
+constexpr UInt64 TEXTURE_COOK_BYTES_PER_PIXEL = 4 * sizeof(float) * 2;
+
+static const char* COOK_MANIFEST_PATH = ".cache/manifest.json";
+
 AssetCacher::Data AssetCacher::sData;
 
+#if !defined(MNEMEN_RHI_NULL)
 /// @brief A custom error handler for NVTT (NVIDIA Texture Tools).
 /// @details This class is used to handle different error scenarios that may arise during texture compression using NVTT.
 class NVTTErrorHandler : public nvtt::ErrorHandler
@@ -89,26 +102,29 @@ public:
     /// @param size The size of the data to write.
     /// @return `true` if data was written successfully, `false` otherwise.
     virtual bool writeData(const void* data, int size) override {
-        UInt8* readableData = (UInt8*)data;
-        for (int i = 0; i < size; i++) {
-            mBytes->push_back(readableData[i]);
-        }
+        const UInt8* readableData = (const UInt8*)data;
+        mBytes->insert(mBytes->end(), readableData, readableData + size);
         return true;
     }
 
 private:
     Vector<UInt8>* mBytes; ///< Pointer to a `Vector<UInt8>` where texture data is written.
 };
+#endif
 
 
-String AssetCacher::GetCachedAsset(const String& normalPath)
+/// @brief MurmurHash64A, used for cache file names and file contents.
+/// @param bytes The data to hash.
+/// @param size The size of the data, in bytes.
+/// @return The hash.
+static UInt64 HashBytes(const void* bytes, UInt64 size)
 {
     const UInt64 m = 0xc6a4a7935bd1e995ULL;
     const UInt32 r = 47;
 
-    UInt64 h = 1000 ^ (normalPath.size() * m);
-    const UInt64 * data = (const UInt64 *)normalPath.data();
-    const UInt64 * end = data + (normalPath.size() / 8);
+    UInt64 h = 1000 ^ (size * m);
+    const UInt64 * data = (const UInt64 *)bytes;
+    const UInt64 * end = data + (size / 8);
     while (data != end) {
         UInt64 k = *data++;
         k *= m;
@@ -120,7 +136,7 @@ String AssetCacher::GetCachedAsset(const String& normalPath)
     }
 
     const UInt8 * data2 = (const UInt8*)data;
-    switch(normalPath.size() & 7) {
+    switch(size & 7) {
         case 7: h ^= UInt64(data2[6]) << 48;
         case 6: h ^= UInt64(data2[5]) << 40;
         case 5: h ^= UInt64(data2[4]) << 32;
@@ -134,35 +150,227 @@ String AssetCacher::GetCachedAsset(const String& normalPath)
     h ^= h >> r;
     h *= m;
     h ^= h >> r;
-    return ".cache/" + String(std::to_string(h)) + ".ma";
+    return h;
 }
 
-AssetFile AssetCacher::ReadAsset(const String& path)
+UInt64 AssetCacher::HashPath(const String& normalPath)
 {
-    String cached = GetCachedAsset(path);
-    if (!File::Exists(cached)) {
-        CacheAsset(path);
+    return HashBytes(normalPath.data(), normalPath.size());
+}
+
+String AssetCacher::GetCachedAsset(const String& normalPath)
+{
+    return ".cache/" + String(std::to_string(HashPath(normalPath))) + ".ma";
+}
+
+void AssetCacher::LoadManifest()
+{
+    sData.ManifestFiles.clear();
+    sData.ManifestEntries.clear();
+    if (!File::Exists(COOK_MANIFEST_PATH)) {
+        return;
     }
-    
-    AssetFile result = {};
 
-    UInt8* Bytes = (UInt8*)File::ReadBytes(cached);
-    memcpy(&result.Header, Bytes, sizeof(AssetFile::Header));
+    // A manifest cut short by a crash, or edited by hand, is as good as no manifest: everything gets recooked
+    try {
+        nlohmann::json root = File::LoadJSON(COOK_MANIFEST_PATH);
+        if (root.value("version", 0u) != COOK_VERSION) {
+            LOG_INFO("Cook manifest is outdated, every asset will be recooked");
+            return;
+        }
 
-    UInt64 size = File::GetFileSize(cached);
-    result.Bytes.resize(size - sizeof(AssetFile::Header));
-    memcpy(result.Bytes.data(), Bytes + sizeof(AssetFile::Header), result.Bytes.size());
+        for (auto& file : root["files"]) {
+            CookManifestFile manifestFile = {};
+            manifestFile.Filetime.Low = file["filetimeLow"];
+            manifestFile.Filetime.High = file["filetimeHigh"];
+            manifestFile.Hash = file["hash"];
+            sData.ManifestFiles[file["path"]] = manifestFile;
+        }
+        for (auto& asset : root["assets"]) {
+            CookManifestEntry entry = {};
+            entry.SettingsHash = asset["settings"];
+            for (auto& dependency : asset["dependencies"]) {
+                entry.Dependencies.push_back({ dependency["path"], dependency["hash"] });
+            }
+            sData.ManifestEntries[asset["path"]] = entry;
+        }
+    } catch (const nlohmann::json::exception& e) {
+        LOG_WARN("Cook manifest is corrupted ({0}), every asset will be recooked", e.what());
+        sData.ManifestFiles.clear();
+        sData.ManifestEntries.clear();
+    }
+}
 
-    delete[] Bytes;
-    return result;
+void AssetCacher::SaveManifest()
+{
+    std::lock_guard<std::mutex> lock(sData.ManifestMutex);
+
+    nlohmann::json root;
+    root["version"] = COOK_VERSION;
+    root["files"] = nlohmann::json::array();
+    root["assets"] = nlohmann::json::array();
+    for (auto& [path, manifestFile] : sData.ManifestFiles) {
+        nlohmann::json file;
+        file["path"] = path;
+        file["filetimeLow"] = manifestFile.Filetime.Low;
+        file["filetimeHigh"] = manifestFile.Filetime.High;
+        file["hash"] = manifestFile.Hash;
+        root["files"].push_back(file);
+    }
+    for (auto& [path, entry] : sData.ManifestEntries) {
+        nlohmann::json asset;
+        asset["path"] = path;
+        asset["settings"] = entry.SettingsHash;
+        asset["dependencies"] = nlohmann::json::array();
+        for (auto& dependency : entry.Dependencies) {
+            nlohmann::json dependencyJson;
+            dependencyJson["path"] = dependency.Path;
+            dependencyJson["hash"] = dependency.Hash;
+            asset["dependencies"].push_back(dependencyJson);
+        }
+        root["assets"].push_back(asset);
+    }
+
+    // Written aside then moved over the old one, so a crash mid-write never leaves a truncated manifest
+    String temporary = String(COOK_MANIFEST_PATH) + ".tmp";
+    File::WriteJSON(root, temporary);
+    if (!File::Replace(temporary, COOK_MANIFEST_PATH)) {
+        File::Delete(temporary);
+    }
 }
 
-AssetFile AssetCacher::ReadAssetHeader(const String& path)
+UInt64 AssetCacher::GetFileHash(const String& path)
 {
-    String cached = GetCachedAsset(path);
+    if (!File::Exists(path)) {
+        return 0;
+    }
+
+    File::Filetime filetime = File::GetLastModified(path);
+    {
+        std::lock_guard<std::mutex> lock(sData.ManifestMutex);
+        auto it = sData.ManifestFiles.find(path);
+        if (it != sData.ManifestFiles.end() && it->second.Filetime == filetime) {
+            return it->second.Hash;
+        }
+    }
+
+    // Touched or new, hash the content so a save without changes doesn't recook
+    UInt64 hash = 0;
+    UInt64 size = File::GetFileSize(path);
+    if (size) {
+        UInt8* bytes = (UInt8*)File::ReadBytes(path);
+        hash = HashBytes(bytes, size);
+        delete[] bytes;
+    }
+
+    std::lock_guard<std::mutex> lock(sData.ManifestMutex);
+    sData.ManifestFiles[path] = { filetime, hash };
+    return hash;
+}
+
+UInt64 AssetCacher::GetCookSettingsHash(const String& normalPath)
+{
+    // Everything CookAsset branches on, besides the files themselves
+    AssetType type = GetAssetTypeFromPath(normalPath);
+    UInt32 settings[3] = { COOK_VERSION, UInt32(type), 0 };
+    if (type == AssetType::Texture) {
+        settings[2] = UInt32(Application::Get()->GetProject()->Settings.Format);
+    } else if (type == AssetType::Shader) {
+        settings[2] = UInt32(GetShaderTypeFromPath(normalPath));
+    } else if (type == AssetType::Mesh) {
+        settings[2] = MESH_FORMAT_VERSION;
+    }
+    return HashBytes(settings, sizeof(settings));
+}
+
+void AssetCacher::GatherMeshBuffers(const String& path, Vector<String>& buffers)
+{
+    // Only glTF keeps geometry outside of the model file. Textures are separate assets, the mesh only stores their path.
+    if (File::GetFileExtension(path) != ".gltf") {
+        return;
+    }
+
+    // A malformed file only loses its buffer dependencies, the mesh cook itself reports the error
+    try {
+        nlohmann::json root = File::LoadJSON(path);
+        if (!root.contains("buffers")) {
+            return;
+        }
+        String directory = std::filesystem::path(path).parent_path().string();
+        for (auto& buffer : root["buffers"]) {
+            String uri = buffer.value("uri", "");
+            if (uri.empty() || uri.rfind("data:", 0) == 0) {
+                continue;
+            }
+            buffers.push_back(directory + "/" + uri);
+        }
+    } catch (const nlohmann::json::exception& e) {
+        LOG_WARN("Failed to parse {0} ({1}), its buffers won't be tracked", path, e.what());
+    }
+}
+
+void AssetCacher::GatherShaderIncludes(const String& path, Vector<String>& includes)
+{
+    String source = File::ReadFile(path);
+    String directory = std::filesystem::path(path).parent_path().string();
+
+    UInt64 position = 0;
+    while ((position = source.find("#include", position)) != String::npos) {
+        UInt64 open = source.find_first_of("\"<", position);
+        UInt64 lineEnd = source.find('\n', position);
+        position += 8;
+        if (open == String::npos || open > lineEnd) {
+            continue;
+        }
+        UInt64 close = source.find_first_of("\">", open + 1);
+        if (close == String::npos || close > lineEnd) {
+            continue;
+        }
+
+        // Our shaders include from the project root, DXC also looks next to the including file
+        String include = source.substr(open + 1, close - open - 1);
+        if (!File::Exists(include)) {
+            include = directory + "/" + include;
+            if (!File::Exists(include)) {
+                continue;
+            }
+        }
+        if (std::find(includes.begin(), includes.end(), include) != includes.end()) {
+            continue;
+        }
+        includes.push_back(include);
+        GatherShaderIncludes(include, includes);
+    }
+}
+
+AssetFile AssetCacher::ReadAsset(const String& path)
+{
+    if (const AssetArchiveEntry* entry = AssetArchive::Find(path)) {
+        const UInt8* payload = AssetArchive::GetPayload(entry);
+
+        AssetFile result = {};
+        result.Header = entry->Header;
+        result.Bytes = payload;
+        result.Size = entry->Size;
+        return result;
+    }
 
+    String cached = GetCachedAsset(path);
+    if (!File::Exists(cached)) {
+        CacheAsset(path);
+    }
+    
     AssetFile result = {};
-    File::ReadBytes(cached, &result.Header, sizeof(result.Header));
+    result.Mapping = MakeRef<MappedFile>();
+    if (!result.Mapping->Open(cached) || result.Mapping->GetSize() < sizeof(AssetFile::Header)) {
+        LOG_ERROR("Failed to read cached asset {0}", path);
+        result.Mapping.reset();
+        return result;
+    }
+
+    memcpy(&result.Header, result.Mapping->GetData(), sizeof(AssetFile::Header));
+    result.Bytes = result.Mapping->GetData() + sizeof(AssetFile::Header);
+    result.Size = result.Mapping->GetSize() - sizeof(AssetFile::Header);
     return result;
 }
 
@@ -234,35 +442,130 @@ AssetType AssetCacher::GetAssetTypeFromPath(const String& normalPath)
         return AssetType::Texture;
     if (extension == ".hlsl")
         return AssetType::Shader;
+    if (extension == ".gltf" || extension == ".glb" || extension == ".obj" || extension == ".fbx")
+        return AssetType::Mesh;
 
     return AssetType::None;
 }
 
-void AssetCacher::CacheAsset(const String& normalPath)
+bool AssetCacher::NeedsCooking(const String& normalPath)
 {
-    String extension = File::GetFileExtension(normalPath);
-    CompressionFormat format = Application::Get()->GetProject()->Settings.Format;
+    if (GetAssetTypeFromPath(normalPath) == AssetType::None) {
+        return false;
+    }
+    if (!File::Exists(GetCachedAsset(normalPath))) {
+        return true;
+    }
 
-    AssetType type = GetAssetTypeFromPath(normalPath);
-    if (type == AssetType::None) {
-        return;
+    CookManifestEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(sData.ManifestMutex);
+        auto it = sData.ManifestEntries.find(normalPath);
+        if (it == sData.ManifestEntries.end()) {
+            return true;
+        }
+        entry = it->second;
     }
 
-    File::Filetime assetFiletime = File::GetLastModified(normalPath);
-    String cached = GetCachedAsset(normalPath);
-    if (File::Exists(cached)) {
-        // Read only the header
-        AssetFile cachedFile = ReadAssetHeader(normalPath);
-        if (assetFiletime == cachedFile.Header.Filetime) {
-            return;
+    if (entry.SettingsHash != GetCookSettingsHash(normalPath)) {
+        return true;
+    }
+    for (const CookDependency& dependency : entry.Dependencies) {
+        if (GetFileHash(dependency.Path) != dependency.Hash) {
+            return true;
         }
     }
+    return false;
+}
+
+void AssetCacher::AcquireTextureMemory(UInt64 bytes)
+{
+    std::unique_lock<std::mutex> lock(sData.BudgetMutex);
+    sData.BudgetCondition.wait(lock, [bytes]() {
+        return sData.TextureBytesInFlight == 0 || sData.TextureBytesInFlight + bytes <= sData.TextureBudget;
+    });
+    sData.TextureBytesInFlight += bytes;
+}
+
+void AssetCacher::ReleaseTextureMemory(UInt64 bytes)
+{
+    {
+        std::lock_guard<std::mutex> lock(sData.BudgetMutex);
+        sData.TextureBytesInFlight -= bytes;
+    }
+    sData.BudgetCondition.notify_all();
+}
+
+void AssetCacher::CacheAsset(const String& normalPath)
+{
+    // Archived assets are final, their sources may not even ship
+    if (AssetArchive::Find(normalPath)) {
+        return;
+    }
+    if (NeedsCooking(normalPath)) {
+        CookAsset(normalPath);
+        SaveManifest();
+    }
+}
+
+void AssetCacher::CookAsset(const String& normalPath)
+{
+    PROFILE_FUNCTION();
+    MemoryScope memoryScope(MemoryTag::Asset);
+
+    String extension = File::GetFileExtension(normalPath);
+    CompressionFormat format = Application::Get()->GetProject()->Settings.Format;
+    AssetType type = GetAssetTypeFromPath(normalPath);
+    String cached = GetCachedAsset(normalPath);
 
     AssetFile file;
-    file.Header.Filetime = assetFiletime;
+    file.Header.Filetime = File::GetLastModified(normalPath);
+
+    // Room for the header is left at the front, so the cooked data is written as is
+    Vector<UInt8> bytes(sizeof(AssetFile::Header));
+
+    // Hashed before cooking, so a file edited while it cooks gets cooked again next time
+    CookManifestEntry entry = {};
+    entry.SettingsHash = GetCookSettingsHash(normalPath);
+    entry.Dependencies.push_back({ normalPath, GetFileHash(normalPath) });
+    if (type == AssetType::Shader) {
+        Vector<String> includes;
+        GatherShaderIncludes(normalPath, includes);
+        for (const String& include : includes) {
+            entry.Dependencies.push_back({ include, GetFileHash(include) });
+        }
+    } else if (type == AssetType::Mesh) {
+        Vector<String> buffers;
+        GatherMeshBuffers(normalPath, buffers);
+        for (const String& buffer : buffers) {
+            entry.Dependencies.push_back({ buffer, GetFileHash(buffer) });
+        }
+    }
 
     switch (type) {
         case AssetType::Texture: {
+#if defined(MNEMEN_RHI_NULL)
+            // Headless builds don't link NVTT, AssetManager falls back to the uncompressed source image
+            LOG_WARN("Texture {0} can't be compressed in headless builds, it will be loaded uncompressed", normalPath);
+            return;
+#else
+            if (sData.Contexts.empty()) {
+                LOG_ERROR("Texture {0} isn't in the asset archive, and cooked builds can't compress textures", normalPath);
+                return;
+            }
+
+            // Reserve the decoded size before decoding, so a burst of large textures doesn't run every core at once.
+            int infoWidth = 0, infoHeight = 0, infoChannels = 0;
+            UInt64 cookBytes = 0;
+            if (stbi_info(normalPath.c_str(), &infoWidth, &infoHeight, &infoChannels)) {
+                cookBytes = UInt64(infoWidth) * UInt64(infoHeight) * TEXTURE_COOK_BYTES_PER_PIXEL;
+            }
+            AcquireTextureMemory(cookBytes);
+            struct MemoryRelease {
+                UInt64 Bytes;
+                ~MemoryRelease() { AssetCacher::ReleaseTextureMemory(Bytes); }
+            } memoryRelease = { cookBytes };
+
             nvtt::Surface image;
             if (!image.load(normalPath.c_str())) {
                 LOG_ERROR("Failed to load texture {0}", normalPath);
@@ -283,10 +586,13 @@ void AssetCacher::CacheAsset(const String& normalPath)
             file.Header.TextureHeader.Width = imageWidth;
             file.Header.TextureHeader.Height = imageHeight;
             file.Header.TextureHeader.Levels = finalMipCount;
+            bytes.reserve(bytes.size() + UInt64(imageWidth) * imageHeight * 4 / 3); // BC formats are a byte per pixel, mips add a third
 
             LOG_INFO("Caching texture {0} ({1}, {2}, {3})", normalPath, imageWidth, imageHeight, finalMipCount);
 
-            TextureWriter writer(&file.Bytes);
+            nvtt::Context& context = *sData.Contexts[JobSystem::GetThreadIndex()];
+
+            TextureWriter writer(&bytes);
             NVTTErrorHandler errorHandler;
 
             nvtt::OutputOptions outputOptions;
@@ -299,8 +605,8 @@ void AssetCacher::CacheAsset(const String& normalPath)
                 compressionOptions.setFormat(nvtt::Format::Format_BC6U);
 
             for (int i = 0; i < finalMipCount; i++) {
-                if (!sData.mContext.compress(image, 0, i, compressionOptions, outputOptions)) {
-                    LOG_ERROR("Failed to compress texture!");
+                if (!context.compress(image, 0, i, compressionOptions, outputOptions)) {
+                    LOG_ERROR("Failed to compress texture {0}!", normalPath);
                 }
 
                 // Prepare the next mip:
@@ -313,31 +619,46 @@ void AssetCacher::CacheAsset(const String& normalPath)
                 image.toSrgb();
             }
             break;
+#endif
         }
         case AssetType::Shader: {
             ShaderType type = GetShaderTypeFromPath(normalPath);
             file.Header.ShaderHeader.Type = type;
             if (type == ShaderType::None)
                 return;
+            // ShaderCompiler creates its own DXC instances, so shaders compile in parallel as is.
             
             LOG_INFO("Caching shader {0}", normalPath);
             Shader shader = ShaderCompiler::Compile(normalPath, GetEntryPointFromShaderType(type), type);
-            file.Bytes.resize(shader.Bytecode.size());
-            memcpy(file.Bytes.data(), shader.Bytecode.data(), shader.Bytecode.size());
+            bytes.insert(bytes.end(), shader.Bytecode.begin(), shader.Bytecode.end());
+            break;
+        }
+        case AssetType::Mesh: {
+            LOG_INFO("Caching mesh {0}", normalPath);
+            if (!Mesh::Cook(normalPath, bytes))
+                return;
             break;
         }
     }
 
-    Vector<UInt8> bytesToWrite;
-    bytesToWrite.resize(sizeof(AssetFile::Header));
-    memcpy(bytesToWrite.data(), &file.Header, sizeof(AssetFile::Header));
-    bytesToWrite.insert(bytesToWrite.end(), file.Bytes.begin(), file.Bytes.end());
+    memcpy(bytes.data(), &file.Header, sizeof(AssetFile::Header));
+
+    // The previous cook may still be mapped by the texture streamer, so it is replaced rather than written over
+    String temporary = cached + ".tmp";
+    File::WriteBytes(temporary, bytes.data(), bytes.size());
+    if (!File::Replace(temporary, cached)) {
+        File::Delete(temporary);
+        return;
+    }
 
-    File::WriteBytes(cached, bytesToWrite.data(), bytesToWrite.size());
+    std::lock_guard<std::mutex> lock(sData.ManifestMutex);
+    sData.ManifestEntries[normalPath] = std::move(entry);
 }
 
 bool AssetCacher::IsCached(const String& normalPath)
 {
+    if (AssetArchive::Find(normalPath))
+        return true;
     if (File::Exists(GetCachedAsset(normalPath)))
         return true;
     return false;
@@ -345,21 +666,66 @@ bool AssetCacher::IsCached(const String& normalPath)
 
 void AssetCacher::Init(const String& assetDirectory)
 {
+    // Cooked builds read everything from the archive, don't walk or cook anything
+    if (AssetArchive::IsMounted()) {
+        LOG_INFO("Initialized Asset Cacher from the asset archive");
+        return;
+    }
+
     if (!File::Exists(".cache")) {
         File::CreateDirectoryFromPath(".cache");
     }
 
-    sData.mContext.enableCudaAcceleration(true);
-    if (!sData.mContext.isCudaAccelerationEnabled()) {
+#if !defined(MNEMEN_RHI_NULL)
+    // Compressor contexts aren't thread safe, every thread cooks with its own
+    sData.Contexts.clear();
+    for (UInt32 i = 0; i < JobSystem::GetThreadCount(); i++) {
+        Unique<nvtt::Context> context = std::make_unique<nvtt::Context>();
+        context->enableCudaAcceleration(true);
+        sData.Contexts.push_back(std::move(context));
+    }
+    if (!sData.Contexts[0]->isCudaAccelerationEnabled()) {
         LOG_WARN("No CUDA compression for you, good luck!");
     }
-
+#endif
+    sData.TextureBudget = UInt64(Application::Get()->GetProject()->Settings.CookMemoryBudget) * 1024 * 1024;
+    LoadManifest();
+
+    // Gather first so the cook knows its total, and so up to date assets don't take a job
+    struct StaleAsset {
+        String Path;
+        UInt64 Size;
+    };
+    Vector<StaleAsset> stale;
     for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(assetDirectory)) {
         String entryPath = dirEntry.path().string();
         std::replace(entryPath.begin(), entryPath.end(), '\\', '/');
     
-        CacheAsset(entryPath);
+        if (NeedsCooking(entryPath)) {
+            stale.push_back({ entryPath, UInt64(File::GetFileSize(entryPath)) });
+        }
+    }
+
+    if (!stale.empty()) {
+        UInt32 total = static_cast<UInt32>(stale.size());
+        LOG_INFO("Cooking {0} assets on {1} threads", total, JobSystem::GetThreadCount());
+
+        // Biggest files first, so a large texture picked up last doesn't leave every other thread idle
+        std::sort(stale.begin(), stale.end(), [](const StaleAsset& a, const StaleAsset& b) {
+            return a.Size > b.Size;
+        });
+
+        Timer timer;
+        sData.CookedCount = 0;
+        JobSystem::ParallelFor(total, 1, [&](UInt32 i) {
+            CookAsset(stale[i].Path);
+
+            UInt32 cooked = sData.CookedCount.fetch_add(1, std::memory_order_relaxed) + 1;
+            LOG_INFO("Cooked {0}/{1} ({2}%) {3}", cooked, total, cooked * 100 / total, stale[i].Path);
+        });
+        LOG_INFO("Cooked {0} assets in {1:.2f}s", total, timer.GetElapsed() / 1000.0f);
     }
+    SaveManifest();
 
     LOG_INFO("Initialized Asset Cacher");
 }
@@ -8,15 +8,23 @@
 #include <Asset/AssetManager.hpp>
 #include <Asset/Shader.hpp>
 #include <Core/File.hpp>
+#include <Core/MappedFile.hpp>
 #include <Core/Project.hpp>
 
+#if !defined(MNEMEN_RHI_NULL)
 #include <nvtt/nvtt.h>
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 /// @struct AssetFile
 /// @brief Represents an asset file with metadata and data bytes.
 ///
 /// The AssetFile structure contains a header with metadata information 
-/// and the actual binary data of the asset.
+/// and a view over the binary data of the asset. The data is never copied out of the
+/// mapped archive or cache file, it stays valid for as long as the AssetFile lives.
 struct AssetFile
 {
     /// @struct Header
@@ -40,7 +48,36 @@ struct AssetFile
         } ShaderHeader; ///< Header for shader assets.
     } Header; ///< The header of the asset.
 
-    Vector<UInt8> Bytes; ///< The binary data of the asset.
+    const UInt8* Bytes = nullptr; ///< The binary data of the asset, null if it couldn't be read.
+    UInt64 Size = 0; ///< Size of the binary data, in bytes.
+    Ref<MappedFile> Mapping; ///< Keeps the cache file backing Bytes mapped. Null when Bytes lives in the mounted archive.
+};
+
+/// @brief Bumped whenever the cooked data of an asset changes for the same source and settings, so every asset gets recooked.
+constexpr UInt32 COOK_VERSION = 1;
+
+/// @struct CookManifestFile
+/// @brief A file the cook has read, as it was when last hashed.
+struct CookManifestFile
+{
+    File::Filetime Filetime; ///< Last modification time when the file was hashed.
+    UInt64 Hash; ///< Hash of the file's content.
+};
+
+/// @struct CookDependency
+/// @brief A file an asset was cooked from.
+struct CookDependency
+{
+    String Path; ///< Path of the file.
+    UInt64 Hash; ///< Hash of the file's content when the asset was cooked.
+};
+
+/// @struct CookManifestEntry
+/// @brief How a cached asset was cooked.
+struct CookManifestEntry
+{
+    UInt64 SettingsHash; ///< Hash of the cook settings that applied to the asset.
+    Vector<CookDependency> Dependencies; ///< The source file first, then every file it includes.
 };
 
 /// @class AssetCacher
@@ -48,41 +85,102 @@ struct AssetFile
 ///
 /// Provides functionality to initialize the asset cache, store assets, 
 /// and check if an asset is cached.
+///
+/// The cook manifest (.cache/manifest.json) records how each asset was cooked: the hash of its
+/// source and of every file it includes, and the settings it was cooked with. An asset is only
+/// recooked when one of those changes. Files are only rehashed when their modification time moved.
 class AssetCacher
 {
 public:
-    /// @brief Initializes the asset caching system.
+    /// @brief Initializes the asset caching system and cooks every stale asset of a directory across the job system.
     /// @param assetDirectory The directory where assets are stored.
     static void Init(const String& assetDirectory);
 
-    /// @brief Caches an asset from the given file path.
+    /// @brief Caches an asset from the given file path, unless its cached version is up to date.
     /// @param normalPath The path of the asset to cache.
     static void CacheAsset(const String& normalPath);
 
-    /// @brief Checks if an asset is already cached.
+    /// @brief Checks if an asset is already cached, in the mounted archive or on disk.
     /// @param normalPath The path of the asset.
     /// @return True if the asset is cached, false otherwise.
     static bool IsCached(const String& normalPath);
 
-    /// @brief Reads an asset file from disk.
+    /// @brief Reads an asset file from the mounted archive, or from disk.
     /// @param path The path to the asset file.
     /// @return The AssetFile object containing the asset data.
     static AssetFile ReadAsset(const String& path);
 
+    /// @brief Hashes an asset's source path. Names cache files and keys the asset archive.
+    /// @param normalPath The path of the asset.
+    /// @return The hash.
+    static UInt64 HashPath(const String& normalPath);
+
 private:
     friend class AssetManager; ///< Allows AssetManager to access private members.
+    friend class AssetArchive; ///< Packs cooked assets.
 
     /// @struct Data
     /// @brief Internal data structure for asset caching.
     static struct Data
     {
-        nvtt::Context mContext; ///< The NVTT context for handling texture assets.
+#if !defined(MNEMEN_RHI_NULL)
+        Vector<Unique<nvtt::Context>> Contexts; ///< One NVTT context per job system thread, a context can only compress one texture at a time.
+#endif
+
+        std::mutex BudgetMutex; ///< Guards TextureBytesInFlight.
+        std::condition_variable BudgetCondition; ///< Signaled whenever a texture cook releases its memory.
+        UInt64 TextureBudget = 0; ///< Decoded texture bytes the cook may keep in flight.
+        UInt64 TextureBytesInFlight = 0; ///< Decoded texture bytes held by running cooks.
+
+        std::atomic<UInt32> CookedCount = 0; ///< Assets cooked by the current Init.
+
+        std::mutex ManifestMutex; ///< Guards the manifest, cook jobs update it.
+        UnorderedMap<String, CookManifestFile> ManifestFiles; ///< Every file hashed by the cook.
+        UnorderedMap<String, CookManifestEntry> ManifestEntries; ///< Every cooked asset, by source path.
     } sData;
 
-    /// @brief Reads the header of an asset file.
-    /// @param path The path to the asset file.
-    /// @return The AssetFile object containing only the header information.
-    static AssetFile ReadAssetHeader(const String& path);
+    /// @brief Loads the cook manifest. A missing or outdated manifest recooks everything.
+    static void LoadManifest();
+
+    /// @brief Writes the cook manifest.
+    static void SaveManifest();
+
+    /// @brief Gets the hash of a file's content, rehashing it only if it was modified since the last time.
+    /// @param path The path of the file.
+    /// @return The hash of the file, 0 if it doesn't exist.
+    static UInt64 GetFileHash(const String& path);
+
+    /// @brief Hashes the cook settings that apply to an asset.
+    /// @param normalPath The path of the asset.
+    /// @return The settings hash.
+    static UInt64 GetCookSettingsHash(const String& normalPath);
+
+    /// @brief Gathers the external buffers a glTF file loads its geometry from.
+    /// @param path The path of the model.
+    /// @param buffers Receives the buffer files.
+    static void GatherMeshBuffers(const String& path, Vector<String>& buffers);
+
+    /// @brief Recursively gathers the files included by a shader.
+    /// @param path The path of the shader.
+    /// @param includes Receives the included files, without duplicates.
+    static void GatherShaderIncludes(const String& path, Vector<String>& includes);
+
+    /// @brief Checks whether an asset is cookable and its cached version is missing or was cooked from other files or settings.
+    /// @param normalPath The path of the asset.
+    /// @return True if the asset must be cooked.
+    static bool NeedsCooking(const String& normalPath);
+
+    /// @brief Cooks an asset and writes it to the cache, using the calling thread's NVTT context.
+    /// @param normalPath The path of the asset to cook.
+    static void CookAsset(const String& normalPath);
+
+    /// @brief Blocks until a texture's decoded data fits in the cook memory budget, then reserves it.
+    /// @param bytes Estimated decoded size of the texture. A texture bigger than the budget waits until it cooks alone.
+    static void AcquireTextureMemory(UInt64 bytes);
+
+    /// @brief Gives back memory reserved by AcquireTextureMemory.
+    /// @param bytes The reserved size.
+    static void ReleaseTextureMemory(UInt64 bytes);
 
     /// @brief Retrieves the entry point from a shader type.
     /// @param type The shader type.
@@ -5,11 +5,38 @@
 
 #include <Asset/AssetManager.hpp>
 #include <Asset/AssetCacher.hpp>
+#include <Asset/AssetArchive.hpp>
+#include <Asset/TextureStreamer.hpp>
 
 #include <Core/Logger.hpp>
 #include <RHI/Uploader.hpp>
 #include <Core/Profiler.hpp>
+#include <Core/Memory.hpp>
 #include <Core/Application.hpp>
+#include <Core/Counters.hpp>
+
+#include <algorithm>
+#include <thread>
+
+static Counter sCacheHits("Asset Cache Hits");
+static Counter sCacheMisses("Asset Cache Misses");
+static Counter sCookedHits("Cooked Asset Hits");
+static Counter sCookedMisses("Cooked Asset Misses");
+static Counter sFinalizedAssets("Finalized Assets");
+static Counter sFinalizedBytes("Finalized Asset Bytes");
+
+/// @brief A mesh or texture load, decoded by a worker then finalized on the main thread.
+struct LoadRequest
+{
+    Asset::Handle Asset;
+    JobPriority Priority = JobPriority::Normal; ///< Read by workers under the queue mutex.
+    std::atomic<bool> Decoded = false; ///< Set once the worker is done with the fields below.
+    bool Failed = false;
+
+    bool Cooked = false; ///< Whether the texture came from the cache, in File, rather than from Image.
+    AssetFile File;
+    Image Image;
+};
 
 AssetManager::Data AssetManager::sData;
 
@@ -23,12 +50,29 @@ Asset::~Asset()
 void AssetManager::Init(RHI::Ref rhi)
 {
     sData.mRHI = rhi;
+    TextureStreamer::Init(rhi);
 
     LOG_INFO("Initialized Asset Manager");
 }
 
 void AssetManager::Clean()
 {
+    // Loads no worker picked up are dropped, the ones being decoded must finish before their sources go away
+    {
+        std::lock_guard<std::mutex> lock(sData.mQueueMutex);
+        for (auto& request : sData.mQueued) {
+            request->Failed = true;
+            request->Decoded = true;
+        }
+        sData.mQueued.clear();
+    }
+    for (auto& request : sData.mRequests) {
+        while (!request->Decoded.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+    sData.mRequests.clear();
+    TextureStreamer::Clean();
     sData.mAssets.clear();
 }
 
@@ -36,10 +80,59 @@ void AssetManager::Update()
 {
     PROFILE_FUNCTION();
 
+    UInt64 budget = UInt64(Application::Get()->GetProject()->Settings.AssetUploadBudget) * 1024 * 1024;
+    UInt64 uploaded = 0;
+    if (!sData.mRequests.empty()) {
+        PROFILE_SCOPE("Finalize Assets");
+
+        // High priority loads go first. Finalizing a mesh requests its textures, so new requests wait for next frame.
+        Vector<Ref<LoadRequest>> requests = std::move(sData.mRequests);
+        sData.mRequests.clear();
+        std::stable_partition(requests.begin(), requests.end(), [](const Ref<LoadRequest>& request) {
+            return request->Priority == JobPriority::High;
+        });
+
+        Vector<Ref<LoadRequest>> waiting;
+        for (auto& request : requests) {
+            // Freed while loading, nobody will ever look at it. A load no worker picked up yet leaves the queue,
+            // one being decoded is kept until it's done so Clean() can still wait on it.
+            if (request->Asset.use_count() == 1) {
+                if (!request->Decoded.load(std::memory_order_acquire)) {
+                    std::lock_guard<std::mutex> lock(sData.mQueueMutex);
+                    auto it = std::find(sData.mQueued.begin(), sData.mQueued.end(), request);
+                    if (it != sData.mQueued.end()) {
+                        sData.mQueued.erase(it);
+                    } else {
+                        waiting.push_back(request);
+                    }
+                }
+                continue;
+            }
+            // At least one load goes through each frame, however large it is
+            if (!request->Decoded.load(std::memory_order_acquire) || (uploaded > 0 && uploaded >= budget)) {
+                waiting.push_back(request);
+                continue;
+            }
+            uploaded += Finalize(*request);
+        }
+        sFinalizedBytes.Add(uploaded);
+
+        waiting.insert(waiting.end(), sData.mRequests.begin(), sData.mRequests.end());
+        sData.mRequests = std::move(waiting);
+    }
+
+    // Mips stream in with whatever the loads left of the budget
+    TextureStreamer::Update(budget > uploaded ? budget - uploaded : 0);
+
+    // Nothing else flushes once the application runs. The copies land on the graphics queue ahead of the next frame,
+    // so nothing waits for them here.
+    Uploader::Flush();
+
     if (sData.mAssets.empty())
         return;
     for (auto it = sData.mAssets.begin(); it != sData.mAssets.end(); ) {
-        if (!File::Exists(it->first)) {
+        // Archived assets can't disappear, and their sources may not ship
+        if (!AssetArchive::Find(it->first) && !File::Exists(it->first)) {
             it->second.reset();
             it = sData.mAssets.erase(it);
         } else {
@@ -62,30 +155,56 @@ void AssetManager::GiveBack(const String& path)
 
 Asset::Handle AssetManager::Get(const String& path, AssetType type)
 {
-    CompressionFormat format = Application::Get()->GetProject()->Settings.Format;
+    MemoryScope memoryScope(MemoryTag::Asset);
 
-    if (!File::Exists(path))
-        return nullptr;
+    auto loaded = sData.mAssets.find(path);
+    if (loaded != sData.mAssets.end()) {
+        sCacheHits.Increment();
+        loaded->second->RefCount++;
 
-    if (sData.mAssets.count(path) > 0) {
-        sData.mAssets[path]->RefCount++;
-        return sData.mAssets[path];
+        // The caller can't wait, finish the load on the spot. The frame being rendered reads the fields
+        // Finalize() writes, so it has to be done first.
+        if (loaded->second->State == AssetState::Loading) {
+            auto request = std::find_if(sData.mRequests.begin(), sData.mRequests.end(), [&](const Ref<LoadRequest>& request) {
+                return request->Asset == loaded->second;
+            });
+            if (request != sData.mRequests.end()) {
+                Ref<LoadRequest> pending = *request;
+                sData.mRequests.erase(request);
+                WaitForDecode(pending);
+                if (Application::Get()) {
+                    Application::Get()->WaitForRender();
+                }
+                Finalize(*pending);
+            }
+        }
+        return loaded->second;
     }
 
+    if (!AssetArchive::Find(path) && !File::Exists(path))
+        return nullptr;
+    sCacheMisses.Increment();
+
     Asset::Handle asset = MakeRef<Asset>();
     asset->RefCount = 1;
     asset->Type = type;
     asset->Path = path;
 
     switch (type) {
-        case AssetType::Mesh: {
-            LOG_DEBUG("Loading Mesh {0}", path);
-            asset->Mesh.Load(sData.mRHI, path);
+        case AssetType::Mesh:
+        case AssetType::Texture: {
+            LoadRequest request;
+            request.Asset = asset;
+            Decode(request);
+            Finalize(request);
             break;
         }
         case AssetType::EnvironmentMap: {
             if (!AssetCacher::IsCached(path)) {
+                sCookedMisses.Increment();
                 AssetCacher::CacheAsset(path);
+            } else {
+                sCookedHits.Increment();
             }
 
             AssetFile file = AssetCacher::ReadAsset(path);
@@ -103,57 +222,19 @@ Asset::Handle AssetManager::Get(const String& path, AssetType type)
             asset->Texture->Tag(ResourceTag::RenderPassResource);
             asset->ShaderView = sData.mRHI->CreateView(asset->Texture, ViewType::ShaderResource);
             
-            Uploader::EnqueueTextureUpload(file.Bytes, asset->Texture);
-            break;
-        }
-        case AssetType::Texture: {
-            LOG_DEBUG("Loading texture {0}", path);
-        
-            if (AssetCacher::IsCached(path) && true) {
-                AssetFile file = AssetCacher::ReadAsset(path);
-                
-                TextureDesc desc;
-                desc.Width = file.Header.TextureHeader.Width;
-                desc.Height = file.Header.TextureHeader.Height;
-                desc.Levels = file.Header.TextureHeader.Levels;
-                desc.Depth = 1;
-                desc.Name = path;
-                desc.Format = format == CompressionFormat::BC7 ? TextureFormat::BC7 : TextureFormat::BC3;
-                desc.Usage = TextureUsage::ShaderResource;
-
-                asset->Texture = sData.mRHI->CreateTexture(desc);
-                asset->Texture->Tag(ResourceTag::ModelTexture);
-                asset->ShaderView = sData.mRHI->CreateView(asset->Texture, ViewType::ShaderResource);
-
-                Uploader::EnqueueTextureUpload(file.Bytes, asset->Texture);
-            } else {
-                Image image;
-                image.Load(path);
-        
-                TextureDesc desc;
-                desc.Width = image.Width;
-                desc.Height = image.Height;
-                desc.Levels = image.Levels;
-                desc.Depth = 1;
-                desc.Name = path;
-                desc.Format = TextureFormat::RGBA8;
-                desc.Usage = TextureUsage::ShaderResource;
-                asset->Texture = sData.mRHI->CreateTexture(desc);
-                asset->Texture->Tag(ResourceTag::ModelTexture);
-            
-                Uploader::EnqueueTextureUpload(image, asset->Texture);
-            }
+            Uploader::EnqueueTextureUpload(file.Bytes, file.Size, asset->Texture);
             break;
         }
         case AssetType::Shader: {
             LOG_INFO("Loading shader {0}", path);
 
             if (AssetCacher::IsCached(path) && true) {
+                sCookedHits.Increment();
                 AssetFile file = AssetCacher::ReadAsset(path);
                 asset->Shader.Type = file.Header.ShaderHeader.Type;
-                asset->Shader.Bytecode.resize(file.Bytes.size());
-                memcpy(asset->Shader.Bytecode.data(), file.Bytes.data(), file.Bytes.size());
+                asset->Shader.Bytecode.assign(file.Bytes, file.Bytes + file.Size); // Pipelines keep the bytecode, the one copy we need
             } else {
+                sCookedMisses.Increment();
                 ShaderType type = AssetCacher::GetShaderTypeFromPath(path);
                 asset->Shader = ShaderCompiler::Compile(path, AssetCacher::GetEntryPointFromShaderType(type), type);
             }
@@ -187,6 +268,183 @@ Asset::Handle AssetManager::Get(const String& path, AssetType type)
     return asset;
 }
 
+Asset::Handle AssetManager::GetAsync(const String& path, AssetType type, JobPriority priority)
+{
+    if (type != AssetType::Mesh && type != AssetType::Texture)
+        return Get(path, type);
+    MemoryScope memoryScope(MemoryTag::Asset);
+
+    auto loaded = sData.mAssets.find(path);
+    if (loaded != sData.mAssets.end()) {
+        sCacheHits.Increment();
+        loaded->second->RefCount++;
+
+        // Someone needs it sooner than whoever asked first
+        if (priority == JobPriority::High && loaded->second->State == AssetState::Loading) {
+            std::lock_guard<std::mutex> lock(sData.mQueueMutex);
+            for (auto& request : sData.mRequests) {
+                if (request->Asset == loaded->second)
+                    request->Priority = priority;
+            }
+        }
+        return loaded->second;
+    }
+
+    if (!AssetArchive::Find(path) && !File::Exists(path))
+        return nullptr;
+    sCacheMisses.Increment();
+
+    Asset::Handle asset = MakeRef<Asset>();
+    asset->RefCount = 1;
+    asset->Type = type;
+    asset->Path = path;
+    asset->State = AssetState::Loading;
+    sData.mAssets[path] = asset;
+
+    Ref<LoadRequest> request = MakeRef<LoadRequest>();
+    request->Asset = asset;
+    request->Priority = priority;
+    sData.mRequests.push_back(request);
+
+    // Without workers the job would run right here anyway, skip the queue
+    if (JobSystem::GetThreadCount() == 1) {
+        Decode(*request);
+        return asset;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sData.mQueueMutex);
+        sData.mQueued.push_back(request);
+    }
+    JobSystem::Run(JobSystem::CreateJob([]() { DecodeNext(); }));
+    return asset;
+}
+
+UInt32 AssetManager::GetPendingCount()
+{
+    return UInt32(sData.mRequests.size());
+}
+
+void AssetManager::DecodeNext()
+{
+    // Jobs run in the order they were queued, so each one decodes whichever request matters most right now
+    Ref<LoadRequest> request;
+    {
+        std::lock_guard<std::mutex> lock(sData.mQueueMutex);
+        if (sData.mQueued.empty())
+            return;
+        auto next = std::min_element(sData.mQueued.begin(), sData.mQueued.end(), [](const Ref<LoadRequest>& a, const Ref<LoadRequest>& b) {
+            return a->Priority < b->Priority;
+        });
+        request = *next;
+        sData.mQueued.erase(next);
+    }
+    Decode(*request);
+}
+
+void AssetManager::Decode(LoadRequest& request)
+{
+    MemoryScope memoryScope(MemoryTag::Asset);
+    Asset& asset = *request.Asset;
+
+    if (AssetCacher::IsCached(asset.Path)) {
+        sCookedHits.Increment();
+    } else {
+        sCookedMisses.Increment();
+    }
+
+    switch (asset.Type) {
+        case AssetType::Mesh: {
+            LOG_DEBUG("Loading Mesh {0}", asset.Path);
+            request.Failed = !asset.Mesh.Decode(asset.Path); // Cooks the mesh on a miss
+            break;
+        }
+        case AssetType::Texture: {
+            LOG_DEBUG("Loading texture {0}", asset.Path);
+            if (AssetCacher::IsCached(asset.Path)) {
+                request.Cooked = true;
+                request.File = AssetCacher::ReadAsset(asset.Path);
+                request.Failed = !request.File.Bytes;
+            } else {
+                request.Image.Load(asset.Path);
+                request.Failed = request.Image.Pixels.empty();
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    request.Decoded.store(true, std::memory_order_release);
+}
+
+UInt64 AssetManager::Finalize(LoadRequest& request)
+{
+    MemoryScope memoryScope(MemoryTag::Asset);
+    Asset& asset = *request.Asset;
+    UInt64 uploaded = 0;
+
+    switch (asset.Type) {
+        case AssetType::Mesh: {
+            uploaded = asset.Mesh.Finalize(sData.mRHI); // Left empty if decoding failed
+            break;
+        }
+        case AssetType::Texture: {
+            if (request.Failed) {
+                LOG_ERROR("Failed to load texture {0}", asset.Path);
+                break;
+            }
+
+            // Cooked mips are streamed, the streamer creates the texture with the ones it starts with
+            if (request.Cooked) {
+                uploaded = TextureStreamer::Register(request.Asset, std::move(request.File));
+                break;
+            }
+
+            TextureDesc desc;
+            desc.Width = request.Image.Width;
+            desc.Height = request.Image.Height;
+            desc.Levels = request.Image.Levels;
+            desc.Depth = 1;
+            desc.Name = asset.Path;
+            desc.Format = TextureFormat::RGBA8;
+            desc.Usage = TextureUsage::ShaderResource;
+
+            asset.Texture = sData.mRHI->CreateTexture(desc);
+            asset.Texture->Tag(ResourceTag::ModelTexture);
+            asset.ShaderView = sData.mRHI->CreateView(asset.Texture, ViewType::ShaderResource);
+            Uploader::EnqueueTextureUpload(request.Image, asset.Texture);
+            uploaded = request.Image.Pixels.size();
+            break;
+        }
+        default:
+            break;
+    }
+
+    asset.State = request.Failed ? AssetState::Failed : AssetState::Ready;
+    sFinalizedAssets.Increment();
+    return uploaded;
+}
+
+void AssetManager::WaitForDecode(const Ref<LoadRequest>& request)
+{
+    // Still queued: decode it here rather than waiting for a worker to get to it
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock(sData.mQueueMutex);
+        auto it = std::find(sData.mQueued.begin(), sData.mQueued.end(), request);
+        if (it != sData.mQueued.end()) {
+            sData.mQueued.erase(it);
+            queued = true;
+        }
+    }
+    if (queued) {
+        Decode(*request);
+        return;
+    }
+    while (!request->Decoded.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
 void AssetManager::Free(Asset::Handle handle)
 {
     sData.mAssets[handle->Path]->RefCount--;
@@ -13,6 +13,9 @@
 #include <Renderer/PostProcessVolume.hpp>
 
 #include <RHI/RHI.hpp>
+#include <Core/JobSystem.hpp>
+
+#include <mutex>
 
 /// @enum AssetType
 /// @brief Represents different types of assets.
@@ -31,6 +34,15 @@ enum class AssetType
     MAX               ///< Max enum.
 };
 
+/// @enum AssetState
+/// @brief Where an asset is in its lifetime. Only ever changes on the main thread.
+enum class AssetState
+{
+    Loading, ///< Being decoded or waiting for its GPU resources. Renderers draw a placeholder instead.
+    Ready,   ///< Fully loaded.
+    Failed   ///< Couldn't be read. Stays empty, like a placeholder.
+};
+
 /// @struct Asset
 /// @brief Represents an asset with its associated data.
 ///
@@ -50,12 +62,20 @@ struct Asset
     PostProcessVolume Volume; ///< Volume data if the asset is a postfx volume.
 
     Int32 RefCount;         ///< Reference count for asset management.
+    AssetState State = AssetState::Ready; ///< Whether the data above can be used yet.
+    Int32 StreamIndex = -1; ///< Slot of the texture in the TextureStreamer, -1 if it isn't streamed.
 
     using Handle = Ref<Asset>; ///< Alias for asset pointer handle.
 
+    /// @brief Checks if the asset finished loading.
+    /// @return True once the asset's data can be used.
+    bool IsReady() const { return State == AssetState::Ready; }
+
     ~Asset();
 };
 
+struct LoadRequest;
+
 /// @class AssetManager
 /// @brief Manages asset loading, retrieval, and cleanup.
 ///
@@ -71,6 +91,7 @@ public:
     static void Clean();
 
     /// @brief Checks if the current assets still exist -- if they don't, they're out!
+    /// Also finalizes decoded asynchronous loads, within the project's AssetUploadBudget.
     static void Update();
 
     /// @brief Retrieves an asset based on its path and type.
@@ -79,6 +100,21 @@ public:
     /// @return A handle to the retrieved asset.
     static Asset::Handle Get(const String& path, AssetType type);
 
+    /// @brief Retrieves an asset without waiting for it to load.
+    ///
+    /// Meshes and textures are decoded on the job system and finalized by Update(), the returned asset
+    /// stays in the Loading state until then. Other asset types load synchronously, like Get().
+    /// Calling Get() on a loading asset finishes it on the spot.
+    /// @param path The file path of the asset.
+    /// @param type The type of asset being requested.
+    /// @param priority High priority loads are decoded and finalized before normal ones.
+    /// @return A handle to the asset, null if the file doesn't exist.
+    static Asset::Handle GetAsync(const String& path, AssetType type, JobPriority priority = JobPriority::Normal);
+
+    /// @brief Gets the number of asynchronous loads that aren't finalized yet.
+    /// @return The number of loading assets.
+    static UInt32 GetPendingCount();
+
     /// @brief Decreases the ref count of the given asset, mostly used for better recycling/cleaning of resources
     /// @param path The path of the asset to give back
     static void GiveBack(const String& path);
@@ -97,5 +133,15 @@ public:
     {
         RHI::Ref mRHI; ///< Pointer to the rendering hardware interface.
         UnorderedMap<String, Asset::Handle> mAssets; ///< Storage for assets mapped by file path.
+
+        Vector<Ref<LoadRequest>> mRequests; ///< Asynchronous loads waiting to be finalized. Main thread only.
+        Vector<Ref<LoadRequest>> mQueued; ///< Asynchronous loads waiting for a worker to decode them.
+        std::mutex mQueueMutex; ///< Guards mQueued.
     } sData; ///< Static instance of the AssetManager's data;
+
+private:
+    static void DecodeNext();
+    static void Decode(LoadRequest& request);
+    static UInt64 Finalize(LoadRequest& request);
+    static void WaitForDecode(const Ref<LoadRequest>& request);
 };
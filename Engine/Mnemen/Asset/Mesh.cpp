@@ -5,11 +5,21 @@
 
 #include "Mesh.hpp"
 #include "Core/Logger.hpp"
+#include "Core/Memory.hpp"
 
 #include <meshoptimizer.h>
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <limits>
 
 #include <Asset/AssetManager.hpp>
+#include <Asset/AssetCacher.hpp>
 #include <RHI/Uploader.hpp>
+#include <Core/JobSystem.hpp>
+
+constexpr float MESH_OVERDRAW_THRESHOLD = 1.05f; ///< How much worse the vertex cache may get to reduce overdraw.
+constexpr float MESH_LOD_MAX_ERROR = 0.05f; ///< Largest simplification error of a level of detail, relative to the primitive's size.
 
 bool MeshPrimitive::IsBoxOutsidePlane(const Plane& plane, const AABB& box, const glm::mat4& transform)
 {
@@ -51,37 +61,39 @@ bool MeshPrimitive::IsBoxInFrustum(glm::mat4 transform, glm::mat4 view, glm::mat
     return true;
 }
 
-void Mesh::Load(RHI::Ref rhi, const String& path)
+float MeshPrimitive::GetPixelsPerUnit(const glm::mat4& transform, const glm::mat4& view, const glm::mat4& proj, float viewportHeight) const
 {
-    mRHI = rhi;
-    Path = path;
-    Directory = path.substr(0, path.find_last_of('/'));
-
-    Assimp::Importer importer;
-    const aiScene* scene = importer.ReadFile(path, aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_CalcTangentSpace | aiProcess_GenSmoothNormals);
-    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-        LOG_ERROR("Failed to load model at path %s", path.c_str());
+    // Object space distances grow with the largest axis scale in the worst case
+    float scale = std::max({ glm::length(glm::vec3(transform[0])), glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2])) });
+    float pixelsPerUnit = proj[1][1] * viewportHeight * 0.5f * scale;
+
+    // Perspective projections shrink with the distance to the closest point of the bounds, orthographic ones don't
+    if (proj[3][3] == 0.0f) {
+        glm::vec3 center = (BoundingBox.Min + BoundingBox.Max) * 0.5f;
+        float radius = glm::length(BoundingBox.Max - BoundingBox.Min) * 0.5f * scale;
+        float distance = std::abs((view * transform * glm::vec4(center, 1.0f)).z) - radius;
+        if (distance <= 0.0f)
+            return std::numeric_limits<float>::infinity();
+        pixelsPerUnit /= distance;
     }
-    
-    Root = new MeshNode;
-    Root->Name = "RootNode";
-    Root->Parent = nullptr;
-    Root->Transform = glm::mat4(1.0f);
-    ProcessNode(Root, scene->mRootNode, scene);
+    return pixelsPerUnit;
 }
 
-Mesh::~Mesh()
+UInt32 MeshPrimitive::SelectLOD(const glm::mat4& transform, const glm::mat4& view, const glm::mat4& proj, float viewportHeight, float bias) const
 {
-    FreeNodes(Root);
-    for (auto& material : Materials) {
-        if (material.Albedo) {
-            AssetManager::GiveBack(material.Albedo->Path);
-        }
-        if (material.Normal) {
-            AssetManager::GiveBack(material.Normal->Path);
-        }
+    if (LODs.size() <= 1)
+        return 0;
+
+    float pixelsPerUnit = GetPixelsPerUnit(transform, view, proj, viewportHeight);
+    if (std::isinf(pixelsPerUnit))
+        return 0;
+
+    float threshold = MESH_LOD_PIXEL_ERROR * bias;
+    UInt32 level = 0;
+    while (level + 1 < LODs.size() && LODs[level + 1].Error * pixelsPerUnit <= threshold) {
+        level++;
     }
-    Materials.clear();
+    return level;
 }
 
 void Mesh::FreeNodes(MeshNode* node)
@@ -97,71 +109,11 @@ void Mesh::FreeNodes(MeshNode* node)
     delete node;
 }
 
-void Mesh::ProcessNode(MeshNode* node, aiNode *assimpNode, const aiScene *scene)
+MeshletData Mesh::BuildMeshlets(const Vector<Vertex>& vertices, const Vector<UInt32>& indices)
 {
-    // Create node resources
-    for (int i = 0; i < assimpNode->mNumMeshes; i++) {
-        aiMesh *mesh = scene->mMeshes[assimpNode->mMeshes[i]];
-        glm::mat4 transform(1.0f);
-        ProcessPrimitive(mesh, node, scene, transform);
-    }
-
-    for (int i = 0; i < assimpNode->mNumChildren; i++) {
-        MeshNode* childNode = new MeshNode;
-        childNode->Parent = node;
-        childNode->Transform = glm::mat4(1.0f);
-        childNode->Name = assimpNode->mName.C_Str();
-        node->Children.push_back(childNode);
-
-        ProcessNode(childNode, assimpNode->mChildren[i], scene);
-    }
-}
-
-void Mesh::ProcessPrimitive(aiMesh *mesh, MeshNode* node, const aiScene *scene, glm::mat4 transform)
-{
-    MeshPrimitive out;
-
-    Vector<Vertex> vertices = {};
-    Vector<UInt32> indices = {};
-
-    out.BoundingBox.Min = glm::vec3(FLT_MAX);
-    out.BoundingBox.Max = glm::vec3(-FLT_MAX);
-    for (int i = 0; i < mesh->mNumVertices; i++) {
-        Vertex vertex;
-
-        vertex.Position = glm::vec3(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
-        if (mesh->HasNormals()) {
-            vertex.Normal = glm::vec3(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z);
-        }
-        if (mesh->mTextureCoords[0]) {
-            vertex.UV = glm::vec2(mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y);
-        }
-        if (mesh->HasTangentsAndBitangents()) {
-            vertex.Tangent = glm::vec3(mesh->mTangents[i].x, mesh->mTangents[i].y, mesh->mTangents[i].z);
-            vertex.Bitangent = glm::vec3(mesh->mBitangents[i].x, mesh->mBitangents[i].y, mesh->mBitangents[i].z);
-        }
-
-        out.BoundingBox.Min.x = std::min(vertex.Position.x, out.BoundingBox.Min.x);
-        out.BoundingBox.Min.y = std::min(vertex.Position.y, out.BoundingBox.Min.y);
-        out.BoundingBox.Min.z = std::min(vertex.Position.z, out.BoundingBox.Min.z);
-
-        out.BoundingBox.Max.x = std::max(vertex.Position.x, out.BoundingBox.Max.x);
-        out.BoundingBox.Max.y = std::max(vertex.Position.y, out.BoundingBox.Max.y);
-        out.BoundingBox.Max.z = std::max(vertex.Position.z, out.BoundingBox.Max.z);
-        
-        vertices.push_back(vertex);
-    }
-
-    for (int i = 0; i < mesh->mNumFaces; i++) {
-        aiFace face = mesh->mFaces[i];
-        for (int j = 0; j < face.mNumIndices; j++)
-            indices.push_back(face.mIndices[j]);
-    }
-
-    Vector<meshopt_Meshlet> meshlets = {};
-    Vector<UInt32> meshletVertices = {};
-    Vector<Uint8> meshletTriangles = {};
-    Vector<MeshletBounds> meshletBounds = {};
+    MeshletData out;
+    if (indices.empty())
+        return out;
 
     const UInt64 kMaxTriangles = MAX_MESHLET_TRIANGLES;
     const UInt64 kMaxVertices = MAX_MESHLET_VERTICES;
@@ -169,15 +121,15 @@ void Mesh::ProcessPrimitive(aiMesh *mesh, MeshNode* node, const aiScene *scene,
 
     UInt64 maxMeshlets = meshopt_buildMeshletsBound(indices.size(), kMaxVertices, kMaxTriangles);
 
-    meshlets.resize(maxMeshlets);
-    meshletVertices.resize(maxMeshlets * kMaxVertices);
-    meshletTriangles.resize(maxMeshlets * kMaxTriangles * 3);
+    Vector<Uint8> meshletTriangles(maxMeshlets * kMaxTriangles * 3);
+    out.Meshlets.resize(maxMeshlets);
+    out.Vertices.resize(maxMeshlets * kMaxVertices);
 
     UInt64 meshletCount = meshopt_buildMeshlets(
-            meshlets.data(),
-            meshletVertices.data(),
+            out.Meshlets.data(),
+            out.Vertices.data(),
             meshletTriangles.data(),
-            reinterpret_cast<const UInt32*>(indices.data()),
+            indices.data(),
             indices.size(),
             reinterpret_cast<const float*>(vertices.data()),
             vertices.size(),
@@ -186,16 +138,17 @@ void Mesh::ProcessPrimitive(aiMesh *mesh, MeshNode* node, const aiScene *scene,
             kMaxTriangles,
             kConeWeight);
 
-    const meshopt_Meshlet& last = meshlets[meshletCount - 1];
-    meshletVertices.resize(last.vertex_offset + last.vertex_count);
+    const meshopt_Meshlet& last = out.Meshlets[meshletCount - 1];
+    out.Vertices.resize(last.vertex_offset + last.vertex_count);
     meshletTriangles.resize(last.triangle_offset + ((last.triangle_count * 3 + 3) & ~3));
-    meshlets.resize(meshletCount);
+    out.Meshlets.resize(meshletCount);
 
-    for (auto& m : meshlets) {
-        meshopt_optimizeMeshlet(&meshletVertices[m.vertex_offset], &meshletTriangles[m.triangle_offset], m.triangle_count, m.vertex_count);
+    out.Bounds.reserve(meshletCount);
+    for (auto& m : out.Meshlets) {
+        meshopt_optimizeMeshlet(&out.Vertices[m.vertex_offset], &meshletTriangles[m.triangle_offset], m.triangle_count, m.vertex_count);
     
         // Generate bounds
-        meshopt_Bounds meshopt_bounds = meshopt_computeMeshletBounds(&meshletVertices[m.vertex_offset], &meshletTriangles[m.triangle_offset],
+        meshopt_Bounds meshopt_bounds = meshopt_computeMeshletBounds(&out.Vertices[m.vertex_offset], &meshletTriangles[m.triangle_offset],
                                                                      m.triangle_count, &vertices[0].Position.x, vertices.size(), sizeof(Vertex));
         
         MeshletBounds bounds;
@@ -205,97 +158,604 @@ void Mesh::ProcessPrimitive(aiMesh *mesh, MeshNode* node, const aiScene *scene,
 
         bounds.Radius = meshopt_bounds.radius;
         bounds.ConeCutoff = meshopt_bounds.cone_cutoff;
-        meshletBounds.push_back(bounds);
+        out.Bounds.push_back(bounds);
     }
 
-    // PUSH
-    Vector<UInt32> meshletPrimitives;
-    for (auto& val : meshletTriangles) {
-        meshletPrimitives.push_back(static_cast<UInt32>(val));
-    }
+    // The shaders read one triangle index per UInt32
+    out.Triangles.assign(meshletTriangles.begin(), meshletTriangles.end());
+    return out;
+}
 
-    out.VertexCount = vertices.size();
-    out.IndexCount = indices.size();
-    out.MeshletCount = meshlets.size();
+template<typename T>
+static void WriteCooked(Vector<UInt8>& bytes, const T& value)
+{
+    const UInt8* data = reinterpret_cast<const UInt8*>(&value);
+    bytes.insert(bytes.end(), data, data + sizeof(T));
+}
 
-    out.VertexBuffer = mRHI->CreateBuffer(vertices.size() * sizeof(Vertex), sizeof(Vertex), BufferType::Vertex, node->Name + " Vertex Buffer");
-    out.VertexBuffer->BuildSRV();
-    out.VertexBuffer->Tag(ResourceTag::ModelGeometry);
+static void WriteCookedString(Vector<UInt8>& bytes, const String& string)
+{
+    WriteCooked(bytes, UInt32(string.size()));
+    bytes.insert(bytes.end(), string.begin(), string.end());
+}
 
-    out.IndexBuffer = mRHI->CreateBuffer(indices.size() * sizeof(UInt32), sizeof(UInt32), BufferType::Index, node->Name + " Index Buffer");
-    out.IndexBuffer->BuildSRV();
-    out.IndexBuffer->Tag(ResourceTag::ModelGeometry);
+template<typename T>
+static void WriteCookedArray(Vector<UInt8>& bytes, const Vector<T>& array)
+{
+    WriteCooked(bytes, UInt32(array.size()));
+    const UInt8* data = reinterpret_cast<const UInt8*>(array.data());
+    bytes.insert(bytes.end(), data, data + array.size() * sizeof(T));
+}
 
-    out.MeshletBuffer = mRHI->CreateBuffer(meshlets.size() * sizeof(meshopt_Meshlet), sizeof(meshopt_Meshlet), BufferType::Storage, node->Name + " Meshlet Buffer");
-    out.MeshletBuffer->BuildSRV();
-    out.MeshletBuffer->Tag(ResourceTag::ModelGeometry);
+/// @brief Compresses a stream with meshopt's vertex codec, any stride that is a multiple of 4 works.
+static void WriteCookedVertexStream(Vector<UInt8>& bytes, const void* data, UInt32 count, UInt32 stride)
+{
+    Vector<UInt8> encoded(meshopt_encodeVertexBufferBound(count, stride));
+    encoded.resize(meshopt_encodeVertexBuffer(encoded.data(), encoded.size(), data, count, stride));
 
-    out.MeshletVertices = mRHI->CreateBuffer(meshletVertices.size() * sizeof(UInt32), sizeof(UInt32), BufferType::Storage, node->Name + " Meshlet Vertices");
-    out.MeshletVertices->BuildSRV();
-    out.MeshletVertices->Tag(ResourceTag::ModelGeometry);
+    WriteCooked(bytes, count);
+    WriteCookedArray(bytes, encoded);
+}
 
-    out.MeshletTriangles = mRHI->CreateBuffer(meshletPrimitives.size() * sizeof(UInt32), sizeof(UInt32), BufferType::Storage, node->Name + " Meshlet Triangles");
-    out.MeshletTriangles->BuildSRV();
-    out.MeshletTriangles->Tag(ResourceTag::ModelGeometry);
+/// @brief Compresses a triangle list with meshopt's index codec.
+static void WriteCookedIndexStream(Vector<UInt8>& bytes, const Vector<UInt32>& indices, UInt32 vertexCount)
+{
+    Vector<UInt8> encoded(meshopt_encodeIndexBufferBound(indices.size(), vertexCount));
+    encoded.resize(meshopt_encodeIndexBuffer(encoded.data(), encoded.size(), indices.data(), indices.size()));
 
-    out.MeshletBounds = mRHI->CreateBuffer(meshletBounds.size() * sizeof(MeshletBounds), sizeof(MeshletBounds), BufferType::Storage, node->Name + " Meshlet Bounds");
-    out.MeshletBounds->BuildSRV();
-    out.MeshletBounds->Tag(ResourceTag::ModelGeometry);
+    WriteCooked(bytes, UInt32(indices.size()));
+    WriteCookedArray(bytes, encoded);
+}
 
-    out.GeometryStructure = mRHI->CreateBLAS(out.VertexBuffer, out.IndexBuffer, out.VertexCount, out.IndexCount, node->Name + " BLAS");
+/// @brief Folds a unit vector onto the octahedron, then unfolds the lower half over the corners of the square.
+static glm::vec2 EncodeOctahedral(glm::vec3 v)
+{
+    float length = std::abs(v.x) + std::abs(v.y) + std::abs(v.z);
+    if (length == 0.0f)
+        return glm::vec2(0.0f);
+    v /= length;
+
+    glm::vec2 encoded(v.x, v.y);
+    if (v.z < 0.0f) {
+        encoded.x = (1.0f - std::abs(v.y)) * (v.x >= 0.0f ? 1.0f : -1.0f);
+        encoded.y = (1.0f - std::abs(v.x)) * (v.y >= 0.0f ? 1.0f : -1.0f);
+    }
+    return encoded;
+}
 
-    aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
-    MeshMaterial meshMaterial = {};
-    out.MaterialIndex = Materials.size();
+static UInt16 QuantizeUnorm16(float value)
+{
+    return UInt16(std::round(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+}
 
-    aiColor3D flatColor(1.0f, 1.0f, 1.0f);
-    material->Get(AI_MATKEY_COLOR_DIFFUSE, flatColor);
-    meshMaterial.MaterialColor = glm::vec3(flatColor.r, flatColor.g, flatColor.b);
-    
-    // Albedo
+/// @brief Walks a cooked mesh. Reads past the end fail and leave the reader failed, instead of reading garbage.
+struct CookedMeshReader
+{
+    const UInt8* Data;
+    UInt64 Size;
+    UInt64 Offset = 0;
+    bool Failed = false;
+
+    template<typename T>
+    T Read()
     {
-        aiString str;
-        material->GetTexture(aiTextureType_DIFFUSE, 0, &str);
-        if (str.length) {
-            String texturePath = Directory + '/' + str.C_Str();
+        T value = {};
+        if (Offset + sizeof(T) > Size) {
+            Failed = true;
+            return value;
+        }
+        memcpy(&value, Data + Offset, sizeof(T));
+        Offset += sizeof(T);
+        return value;
+    }
 
-            meshMaterial.Albedo = AssetManager::Get(texturePath, AssetType::Texture);
-            meshMaterial.AlbedoView = mRHI->CreateView(meshMaterial.Albedo->Texture, ViewType::ShaderResource);
+    String ReadString()
+    {
+        UInt32 length = Read<UInt32>();
+        if (Failed || Offset + length > Size) {
+            Failed = true;
+            return "";
         }
+        String value(reinterpret_cast<const char*>(Data + Offset), length);
+        Offset += length;
+        return value;
     }
-    // Normal
+
+    /// @brief Reads a compressed stream: its element count, then its encoded bytes. Nothing is decoded or copied.
+    const UInt8* ReadStream(UInt32& count, UInt32& size)
     {
-        aiString str;
-        material->GetTexture(aiTextureType_NORMALS, 0, &str);
-        if (str.length) {
-            String texturePath = Directory + '/' + str.C_Str();
+        count = Read<UInt32>();
+        const UInt8* encoded = ReadArray<UInt8>(size);
+        if (Failed)
+            count = 0;
+        return encoded;
+    }
 
-            meshMaterial.Normal = AssetManager::Get(texturePath, AssetType::Texture);
-            meshMaterial.NormalView = mRHI->CreateView(meshMaterial.Normal->Texture, ViewType::ShaderResource);
+    /// @brief Returns a pointer to an array inside the data, nothing is copied.
+    template<typename T>
+    const T* ReadArray(UInt32& count)
+    {
+        count = Read<UInt32>();
+        if (Failed || Offset + UInt64(count) * sizeof(T) > Size) {
+            Failed = true;
+            count = 0;
+            return nullptr;
         }
+        const T* array = reinterpret_cast<const T*>(Data + Offset);
+        Offset += UInt64(count) * sizeof(T);
+        return array;
     }
-    // PBR
-    {
-        aiString str;
-        material->GetTexture(aiTextureType_UNKNOWN, 0, &str);
-        if (str.length) {
-            String texturePath = Directory + '/' + str.C_Str();
+};
+
+/// @brief A compressed stream of a cooked mesh, decoded on the job system before being uploaded.
+struct CookedMeshStream
+{
+    const UInt8* Encoded = nullptr;
+    UInt32 EncodedSize = 0;
+    UInt32 Count = 0;
+    UInt32 Stride = 0;
+    bool Indices = false; ///< Encoded with the index codec rather than the vertex codec.
+};
+
+/// @brief A GPU buffer of a decoded mesh, created and uploaded by Mesh::Finalize().
+struct PendingMeshBuffer
+{
+    Buffer::Ref* Target = nullptr; ///< Where the buffer goes, inside the pending node tree.
+    const void* Data = nullptr; ///< Contents inside the mapped file, when Stream is -1.
+    Int32 Stream = -1; ///< Index of the decoded stream holding the contents.
+    UInt64 Size = 0;
+    UInt32 Stride = 0;
+    BufferType Type = BufferType::Storage;
+    String Name;
+};
+
+/// @brief Everything Decode() prepares on a worker thread, for Finalize() to turn into GPU resources on the main thread.
+struct Mesh::PendingLoad
+{
+    AssetFile File; ///< Keeps the mapped cooked data alive until the uploads are enqueued.
+    MeshNode* Root = nullptr; ///< Not visible to the renderer until finalized.
+    Vector<MeshNode*> Nodes;
+    Vector<MeshMaterial> Materials;
+    Vector<Array<String, 3>> TexturePaths; ///< Albedo, normal and PBR texture of each material.
+    Vector<PendingMeshBuffer> Buffers;
+    Vector<CookedMeshStream> Streams;
+    Vector<Vector<UInt8>> Decoded; ///< Decompressed streams, referenced by Buffers.
+    UInt32 VertexCount = 0;
+    UInt32 IndexCount = 0;
+    UInt32 MeshletCount = 0;
+};
+
+bool Mesh::Cook(const String& path, Vector<UInt8>& bytes)
+{
+    MemoryScope memoryScope(MemoryTag::Mesh);
+    String directory = path.substr(0, path.find_last_of('/'));
+
+    Assimp::Importer importer;
+    const aiScene* scene = importer.ReadFile(path, aiProcess_FlipUVs | aiProcess_PreTransformVertices | aiProcess_CalcTangentSpace | aiProcess_GenSmoothNormals | aiProcess_Triangulate);
+    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+        LOG_ERROR("Failed to import model at path {0}", path);
+        return false;
+    }
+
+    // Patched once every node is cooked
+    UInt64 nodeCountOffset = bytes.size();
+    WriteCooked(bytes, UInt32(0));
+    WriteCooked(bytes, UInt32(scene->mNumMaterials));
+
+    for (UInt32 i = 0; i < scene->mNumMaterials; i++) {
+        aiMaterial* material = scene->mMaterials[i];
+
+        aiColor3D flatColor(1.0f, 1.0f, 1.0f);
+        material->Get(AI_MATKEY_COLOR_DIFFUSE, flatColor);
+        WriteCooked(bytes, glm::vec3(flatColor.r, flatColor.g, flatColor.b));
+        WriteCooked(bytes, UInt8(false));
+        WriteCooked(bytes, 0.0f);
+
+        for (aiTextureType type : { aiTextureType_DIFFUSE, aiTextureType_NORMALS, aiTextureType_UNKNOWN }) {
+            aiString str;
+            material->GetTexture(type, 0, &str);
+            WriteCookedString(bytes, str.length ? directory + '/' + str.C_Str() : String());
+        }
+    }
+
+    UInt32 nodeCount = 0;
+    CookNode(bytes, scene->mRootNode, scene, -1, nodeCount);
+    memcpy(bytes.data() + nodeCountOffset, &nodeCount, sizeof(UInt32));
+    return true;
+}
+
+void Mesh::CookNode(Vector<UInt8>& bytes, aiNode *assimpNode, const aiScene *scene, Int32 parent, UInt32& nodeCount)
+{
+    Int32 index = nodeCount++;
 
-            meshMaterial.PBR = AssetManager::Get(texturePath, AssetType::Texture);
-            meshMaterial.PBRView = mRHI->CreateView(meshMaterial.PBR->Texture, ViewType::ShaderResource);
+    WriteCooked(bytes, parent);
+    WriteCookedString(bytes, parent == -1 ? String("RootNode") : String(assimpNode->mName.C_Str()));
+    WriteCooked(bytes, glm::mat4(1.0f));
+
+    // Point and line meshes have nothing for the mesh shaders to draw
+    UInt32 primitiveCount = 0;
+    for (UInt32 i = 0; i < assimpNode->mNumMeshes; i++) {
+        if (scene->mMeshes[assimpNode->mMeshes[i]]->mPrimitiveTypes & aiPrimitiveType_TRIANGLE)
+            primitiveCount++;
+    }
+    WriteCooked(bytes, primitiveCount);
+    for (UInt32 i = 0; i < assimpNode->mNumMeshes; i++) {
+        aiMesh* mesh = scene->mMeshes[assimpNode->mMeshes[i]];
+        if (mesh->mPrimitiveTypes & aiPrimitiveType_TRIANGLE)
+            CookPrimitive(bytes, mesh);
+    }
+
+    for (UInt32 i = 0; i < assimpNode->mNumChildren; i++) {
+        CookNode(bytes, assimpNode->mChildren[i], scene, index, nodeCount);
+    }
+}
+
+void Mesh::CookPrimitive(Vector<UInt8>& bytes, aiMesh *mesh)
+{
+    Vector<Vertex> vertices = {};
+    Vector<UInt32> indices = {};
+    vertices.reserve(mesh->mNumVertices);
+    indices.reserve(mesh->mNumFaces * 3);
+
+    AABB boundingBox;
+    boundingBox.Min = glm::vec3(FLT_MAX);
+    boundingBox.Max = glm::vec3(-FLT_MAX);
+    for (int i = 0; i < mesh->mNumVertices; i++) {
+        Vertex vertex = {};
+
+        vertex.Position = glm::vec3(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
+        if (mesh->HasNormals()) {
+            vertex.Normal = glm::vec3(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z);
+        }
+        if (mesh->mTextureCoords[0]) {
+            vertex.UV = glm::vec2(mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y);
         }
+        if (mesh->HasTangentsAndBitangents()) {
+            vertex.Tangent = glm::vec3(mesh->mTangents[i].x, mesh->mTangents[i].y, mesh->mTangents[i].z);
+            vertex.Bitangent = glm::vec3(mesh->mBitangents[i].x, mesh->mBitangents[i].y, mesh->mBitangents[i].z);
+        }
+
+        boundingBox.Min.x = std::min(vertex.Position.x, boundingBox.Min.x);
+        boundingBox.Min.y = std::min(vertex.Position.y, boundingBox.Min.y);
+        boundingBox.Min.z = std::min(vertex.Position.z, boundingBox.Min.z);
+
+        boundingBox.Max.x = std::max(vertex.Position.x, boundingBox.Max.x);
+        boundingBox.Max.y = std::max(vertex.Position.y, boundingBox.Max.y);
+        boundingBox.Max.z = std::max(vertex.Position.z, boundingBox.Max.z);
+        
+        vertices.push_back(vertex);
+    }
+
+    for (int i = 0; i < mesh->mNumFaces; i++) {
+        const aiFace& face = mesh->mFaces[i];
+        if (face.mNumIndices != 3)
+            continue;
+        indices.insert(indices.end(), face.mIndices, face.mIndices + 3);
+    }
+
+    // Merge the duplicates Assimp leaves behind (it splits vertices per face), then reorder
+    // triangles for the post-transform cache and overdraw, and vertices in first-use order for fetch locality.
+    if (!indices.empty()) {
+        Vector<UInt32> remap(vertices.size());
+        UInt64 uniqueCount = meshopt_generateVertexRemap(remap.data(), indices.data(), indices.size(), vertices.data(), vertices.size(), sizeof(Vertex));
+        meshopt_remapIndexBuffer(indices.data(), indices.data(), indices.size(), remap.data());
+        meshopt_remapVertexBuffer(vertices.data(), vertices.data(), vertices.size(), sizeof(Vertex), remap.data());
+        vertices.resize(uniqueCount);
+
+        meshopt_optimizeVertexCache(indices.data(), indices.data(), indices.size(), vertices.size());
+        meshopt_optimizeOverdraw(indices.data(), indices.data(), indices.size(), &vertices[0].Position.x, vertices.size(), sizeof(Vertex), MESH_OVERDRAW_THRESHOLD);
+        vertices.resize(meshopt_optimizeVertexFetch(vertices.data(), indices.data(), indices.size(), vertices.data(), vertices.size(), sizeof(Vertex)));
+    }
+
+    // Every level simplifies the full resolution one down to half the triangles of the previous level,
+    // until meshopt can't get there without going over MESH_LOD_MAX_ERROR.
+    Vector<Vector<UInt32>> lods = { indices };
+    Vector<float> lodErrors = { 0.0f };
+    if (!indices.empty()) {
+        float errorScale = meshopt_simplifyScale(&vertices[0].Position.x, vertices.size(), sizeof(Vertex));
+        while (lods.size() < MAX_MESH_LODS) {
+            UInt64 targetCount = lods.back().size() / 6 * 3;
+            float error = 0.0f;
+
+            Vector<UInt32> lod(indices.size());
+            lod.resize(meshopt_simplify(lod.data(), indices.data(), indices.size(), &vertices[0].Position.x, vertices.size(), sizeof(Vertex), targetCount, MESH_LOD_MAX_ERROR, 0, &error));
+            if (lod.empty() || lod.size() > lods.back().size() * 3 / 4)
+                break;
+
+            meshopt_optimizeVertexCache(lod.data(), lod.data(), lod.size(), vertices.size());
+            lods.push_back(std::move(lod));
+            lodErrors.push_back(error * errorScale);
+        }
+    }
+
+    // Texture streaming needs how much of the UV space a unit of surface covers, the square root of the area ratio
+    float surfaceArea = 0.0f;
+    float uvArea = 0.0f;
+    for (UInt64 i = 0; i < indices.size(); i += 3) {
+        const Vertex& a = vertices[indices[i]];
+        const Vertex& b = vertices[indices[i + 1]];
+        const Vertex& c = vertices[indices[i + 2]];
+
+        glm::vec2 uvEdge0 = b.UV - a.UV;
+        glm::vec2 uvEdge1 = c.UV - a.UV;
+        surfaceArea += glm::length(glm::cross(b.Position - a.Position, c.Position - a.Position)) * 0.5f;
+        uvArea += std::abs(uvEdge0.x * uvEdge1.y - uvEdge0.y * uvEdge1.x) * 0.5f;
+    }
+    float uvDensity = surfaceArea > 0.0f ? std::sqrt(uvArea / surfaceArea) : 0.0f;
+
+    // Flat primitives have a zero extent on one axis, they all land on the minimum
+    glm::vec3 extent = boundingBox.Max - boundingBox.Min;
+    glm::vec3 inverseExtent = glm::vec3(extent.x > 0.0f ? 1.0f / extent.x : 0.0f,
+                                        extent.y > 0.0f ? 1.0f / extent.y : 0.0f,
+                                        extent.z > 0.0f ? 1.0f / extent.z : 0.0f);
+
+    Vector<PackedPosition> positions(vertices.size());
+    Vector<PackedVertex> packedVertices(vertices.size());
+    for (UInt64 i = 0; i < vertices.size(); i++) {
+        const Vertex& vertex = vertices[i];
+
+        glm::vec3 position = (vertex.Position - boundingBox.Min) * inverseExtent;
+        positions[i] = { QuantizeUnorm16(position.x), QuantizeUnorm16(position.y), QuantizeUnorm16(position.z), 0 };
+
+        // The bitangent is rebuilt from the normal and tangent, only its handedness is kept
+        bool flipped = glm::dot(glm::cross(vertex.Normal, vertex.Tangent), vertex.Bitangent) < 0.0f;
+        UInt32 tangent = glm::packSnorm2x16(EncodeOctahedral(vertex.Tangent));
+        tangent = (tangent & ~0x10000u) | (flipped ? 0x10000u : 0u);
+
+        packedVertices[i].Normal = glm::packSnorm2x16(EncodeOctahedral(vertex.Normal));
+        packedVertices[i].Tangent = tangent;
+        packedVertices[i].UV = glm::packHalf2x16(vertex.UV);
+    }
+
+    WriteCooked(bytes, Int32(mesh->mMaterialIndex));
+    WriteCooked(bytes, boundingBox);
+    WriteCooked(bytes, uvDensity);
+    WriteCookedVertexStream(bytes, positions.data(), UInt32(positions.size()), sizeof(PackedPosition));
+    WriteCookedVertexStream(bytes, packedVertices.data(), UInt32(packedVertices.size()), sizeof(PackedVertex));
+    WriteCooked(bytes, UInt32(lods.size()));
+    for (UInt64 i = 0; i < lods.size(); i++) {
+        MeshletData meshletData = BuildMeshlets(vertices, lods[i]);
+
+        WriteCooked(bytes, lodErrors[i]);
+        WriteCookedIndexStream(bytes, lods[i], UInt32(vertices.size()));
+        WriteCookedArray(bytes, meshletData.Meshlets);
+        // Meshlet indices are mostly zero bytes once widened, the byte-wise delta of the vertex codec squeezes them well
+        WriteCookedVertexStream(bytes, meshletData.Vertices.data(), UInt32(meshletData.Vertices.size()), sizeof(UInt32));
+        WriteCookedVertexStream(bytes, meshletData.Triangles.data(), UInt32(meshletData.Triangles.size()), sizeof(UInt32));
+        WriteCookedArray(bytes, meshletData.Bounds);
     }
+}
 
-    Uploader::EnqueueBufferUpload(vertices.data(), out.VertexBuffer->GetSize(), out.VertexBuffer);
-    Uploader::EnqueueBufferUpload(indices.data(), out.IndexBuffer->GetSize(), out.IndexBuffer);
-    Uploader::EnqueueBufferUpload(meshlets.data(), out.MeshletBuffer->GetSize(), out.MeshletBuffer);
-    Uploader::EnqueueBufferUpload(meshletVertices.data(), out.MeshletVertices->GetSize(), out.MeshletVertices);
-    Uploader::EnqueueBufferUpload(meshletPrimitives.data(), out.MeshletTriangles->GetSize(), out.MeshletTriangles);
-    Uploader::EnqueueBufferUpload(meshletBounds.data(), out.MeshletBounds->GetSize(), out.MeshletBounds);
+void Mesh::Load(RHI::Ref rhi, const String& path)
+{
+    Decode(path);
+    Finalize(rhi);
+}
 
-    VertexCount += out.VertexCount;
-    IndexCount += out.IndexCount;
+Mesh::Mesh() = default;
 
-    Materials.push_back(meshMaterial);
-    node->Primitives.push_back(out);
+Mesh::~Mesh()
+{
+    if (mPending) {
+        FreeNodes(mPending->Root);
+    }
+    FreeNodes(Root);
+    for (auto& material : Materials) {
+        if (material.Albedo) {
+            AssetManager::GiveBack(material.Albedo->Path);
+        }
+        if (material.Normal) {
+            AssetManager::GiveBack(material.Normal->Path);
+        }
+        if (material.PBR) {
+            AssetManager::GiveBack(material.PBR->Path);
+        }
+    }
+    Materials.clear();
+}
+
+bool Mesh::Decode(const String& path)
+{
+    MemoryScope memoryScope(MemoryTag::Mesh);
+    Path = path;
+    Directory = path.substr(0, path.find_last_of('/'));
+
+    mPending = MakeUnique<PendingLoad>();
+    mPending->File = AssetCacher::ReadAsset(path);
+    if (!mPending->File.Bytes || !DecodeCooked(mPending->File.Bytes, mPending->File.Size)) {
+        LOG_ERROR("Failed to load model at path {0}", path);
+        FreeNodes(mPending->Root);
+        mPending.reset();
+        return false;
+    }
+    return true;
+}
+
+UInt64 Mesh::Finalize(RHI::Ref rhi)
+{
+    MemoryScope memoryScope(MemoryTag::Mesh);
+    mRHI = rhi;
+    if (!mPending) {
+        Root = new MeshNode;
+        Root->Name = "RootNode";
+        Root->Transform = glm::mat4(1.0f);
+        return 0;
+    }
+    PendingLoad& pending = *mPending;
+
+    // Textures stream in on their own, the renderer uses its placeholders until they're ready
+    for (UInt64 i = 0; i < pending.Materials.size(); i++) {
+        MeshMaterial& material = pending.Materials[i];
+        const Array<String, 3>& textures = pending.TexturePaths[i];
+        if (!textures[0].empty())
+            material.Albedo = AssetManager::GetAsync(textures[0], AssetType::Texture);
+        if (!textures[1].empty())
+            material.Normal = AssetManager::GetAsync(textures[1], AssetType::Texture);
+        if (!textures[2].empty())
+            material.PBR = AssetManager::GetAsync(textures[2], AssetType::Texture);
+    }
+
+    UInt64 uploaded = 0;
+    for (const PendingMeshBuffer& buffer : pending.Buffers) {
+        Buffer::Ref& target = *buffer.Target;
+        target = mRHI->CreateBuffer(buffer.Size, buffer.Stride, buffer.Type, buffer.Name);
+        target->BuildSRV();
+        target->Tag(ResourceTag::ModelGeometry);
+
+        const void* data = buffer.Stream >= 0 ? pending.Decoded[buffer.Stream].data() : buffer.Data;
+        Uploader::EnqueueBufferUpload(data, buffer.Size, target);
+        uploaded += buffer.Size;
+    }
+
+    for (MeshNode* node : pending.Nodes) {
+        for (MeshPrimitive& primitive : node->Primitives) {
+            // Ray tracing always traces the full resolution level
+            primitive.GeometryStructure = mRHI->CreateBLAS(primitive.PositionBuffer, primitive.LODs[0].IndexBuffer, primitive.VertexCount, primitive.LODs[0].IndexCount, node->Name + " BLAS");
+        }
+    }
+
+    Root = pending.Root;
+    Materials = std::move(pending.Materials);
+    VertexCount = pending.VertexCount;
+    IndexCount = pending.IndexCount;
+    MeshletCount = pending.MeshletCount;
+    mPending.reset();
+    return uploaded;
+}
+
+bool Mesh::DecodeCooked(const UInt8* data, UInt64 size)
+{
+    PendingLoad& pending = *mPending;
+    CookedMeshReader reader = { data, size };
+    UInt32 nodeCount = reader.Read<UInt32>();
+    UInt32 materialCount = reader.Read<UInt32>();
+    if (reader.Failed || nodeCount == 0) {
+        return false;
+    }
+
+    pending.Materials.reserve(materialCount);
+    pending.TexturePaths.reserve(materialCount);
+    for (UInt32 i = 0; i < materialCount && !reader.Failed; i++) {
+        MeshMaterial meshMaterial = {};
+        meshMaterial.MaterialColor = reader.Read<glm::vec3>();
+        meshMaterial.AlphaTested = reader.Read<UInt8>();
+        meshMaterial.AlphaCutoff = reader.Read<float>();
+
+        Array<String, 3> textures;
+        for (String& texture : textures) {
+            texture = reader.ReadString();
+        }
+        pending.Materials.push_back(meshMaterial);
+        pending.TexturePaths.push_back(std::move(textures));
+    }
+
+    // Buffers point into the node tree, so primitives and levels are sized before anything takes their address
+    auto addBuffer = [&](Buffer::Ref& target, const void* array, UInt64 size, UInt32 stride, BufferType type, const String& name) {
+        PendingMeshBuffer buffer = {};
+        buffer.Target = &target;
+        buffer.Data = array;
+        buffer.Size = size;
+        buffer.Stride = stride;
+        buffer.Type = type;
+        buffer.Name = name;
+        pending.Buffers.push_back(std::move(buffer));
+    };
+    auto addStream = [&](Buffer::Ref& target, UInt32 stride, bool indices, BufferType type, const String& name) {
+        CookedMeshStream stream = {};
+        stream.Encoded = reader.ReadStream(stream.Count, stream.EncodedSize);
+        stream.Stride = stride;
+        stream.Indices = indices;
+
+        addBuffer(target, nullptr, UInt64(stream.Count) * stride, stride, type, name);
+        pending.Buffers.back().Stream = Int32(pending.Streams.size());
+        pending.Streams.push_back(stream);
+        return stream.Count;
+    };
+
+    pending.Nodes.reserve(nodeCount);
+    for (UInt32 i = 0; i < nodeCount && !reader.Failed; i++) {
+        MeshNode* node = new MeshNode;
+        Int32 parent = reader.Read<Int32>();
+        node->Name = reader.ReadString();
+        node->Transform = reader.Read<glm::mat4>();
+        if (parent >= 0 && parent < Int32(pending.Nodes.size())) {
+            node->Parent = pending.Nodes[parent];
+            node->Parent->Children.push_back(node);
+        } else if (!pending.Root) {
+            pending.Root = node;
+        } else {
+            // Only the first node can be a root, anything else is corrupted data
+            reader.Failed = true;
+            delete node;
+            break;
+        }
+        pending.Nodes.push_back(node);
+
+        UInt32 primitiveCount = reader.Read<UInt32>();
+        node->Primitives.reserve(primitiveCount);
+        for (UInt32 j = 0; j < primitiveCount && !reader.Failed; j++) {
+            MeshPrimitive& out = node->Primitives.emplace_back();
+            out.MaterialIndex = reader.Read<Int32>();
+            out.BoundingBox = reader.Read<AABB>();
+            out.UVDensity = reader.Read<float>();
+
+            UInt32 positionCount = addStream(out.PositionBuffer, sizeof(PackedPosition), false, BufferType::Vertex, node->Name + " Position Buffer");
+            out.VertexCount = addStream(out.VertexBuffer, sizeof(PackedVertex), false, BufferType::Vertex, node->Name + " Vertex Buffer");
+            UInt32 lodCount = reader.Read<UInt32>();
+            if (reader.Failed || out.MaterialIndex < 0 || out.MaterialIndex >= Int32(pending.Materials.size()) || positionCount != out.VertexCount || lodCount == 0 || lodCount > MAX_MESH_LODS) {
+                reader.Failed = true;
+                break;
+            }
+
+            glm::vec3 extent = out.BoundingBox.Max - out.BoundingBox.Min;
+            out.Dequantize = glm::mat4(1.0f);
+            out.Dequantize[0][0] = extent.x;
+            out.Dequantize[1][1] = extent.y;
+            out.Dequantize[2][2] = extent.z;
+            out.Dequantize[3] = glm::vec4(out.BoundingBox.Min, 1.0f);
+
+            out.LODs.resize(lodCount);
+            for (UInt32 level = 0; level < lodCount && !reader.Failed; level++) {
+                MeshLOD& lod = out.LODs[level];
+                String lodName = node->Name + " LOD" + std::to_string(level);
+
+                UInt32 meshletBoundsCount = 0;
+                lod.Error = reader.Read<float>();
+                lod.IndexCount = addStream(lod.IndexBuffer, sizeof(UInt32), true, BufferType::Index, lodName + " Index Buffer");
+                const meshopt_Meshlet* meshlets = reader.ReadArray<meshopt_Meshlet>(lod.MeshletCount);
+                addBuffer(lod.MeshletBuffer, meshlets, lod.MeshletCount * sizeof(meshopt_Meshlet), sizeof(meshopt_Meshlet), BufferType::Storage, lodName + " Meshlet Buffer");
+                addStream(lod.MeshletVertices, sizeof(UInt32), false, BufferType::Storage, lodName + " Meshlet Vertices");
+                addStream(lod.MeshletTriangles, sizeof(UInt32), false, BufferType::Storage, lodName + " Meshlet Triangles");
+                const MeshletBounds* meshletBounds = reader.ReadArray<MeshletBounds>(meshletBoundsCount);
+                addBuffer(lod.MeshletBounds, meshletBounds, meshletBoundsCount * sizeof(MeshletBounds), sizeof(MeshletBounds), BufferType::Storage, lodName + " Meshlet Bounds");
+                if (lod.IndexCount == 0 || lod.IndexCount % 3 != 0) {
+                    reader.Failed = true;
+                }
+            }
+            if (reader.Failed)
+                break;
+
+            pending.VertexCount += out.VertexCount;
+            pending.IndexCount += out.LODs[0].IndexCount;
+            pending.MeshletCount += out.LODs[0].MeshletCount;
+        }
+    }
+    if (reader.Failed)
+        return false;
+
+    // Streams decode independently of each other
+    pending.Decoded.resize(pending.Streams.size());
+    std::atomic<bool> decodeFailed = false;
+    JobSystem::ParallelFor(UInt32(pending.Streams.size()), 1, [&](UInt32 i) {
+        MemoryScope memoryScope(MemoryTag::Mesh);
+        const CookedMeshStream& stream = pending.Streams[i];
+        Vector<UInt8>& decoded = pending.Decoded[i];
+
+        decoded.resize(UInt64(stream.Count) * stream.Stride);
+        int result = stream.Indices ? meshopt_decodeIndexBuffer(decoded.data(), stream.Count, stream.Stride, stream.Encoded, stream.EncodedSize)
+                                    : meshopt_decodeVertexBuffer(decoded.data(), stream.Count, stream.Stride, stream.Encoded, stream.EncodedSize);
+        if (result != 0)
+            decodeFailed = true;
+    });
+    return !decodeFailed;
 }
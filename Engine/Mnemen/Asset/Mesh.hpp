@@ -13,6 +13,8 @@
 #include <Assimp/postprocess.h>
 #include <Assimp/pbrmaterial.h>
 
+#include <meshoptimizer.h>
+
 #include <Core/Common.hpp>
 #include <RHI/RHI.hpp>
 #include <Physics/BoundingVolume.hpp>
@@ -21,12 +23,17 @@
 #define MAX_MESHLET_TRIANGLES 124
 #define MAX_MESHLET_VERTICES 64
 
+constexpr UInt32 MESH_FORMAT_VERSION = 5; ///< Bumped whenever the cooked mesh layout changes, recooks every mesh.
+
+constexpr UInt32 MAX_MESH_LODS = 4; ///< Levels of detail cooked per primitive, full resolution included.
+constexpr float MESH_LOD_PIXEL_ERROR = 1.0f; ///< Error, in pixels, a level of detail may show on screen before a finer one is picked.
+
 class Asset;
 
 /// @struct Vertex
 /// @brief Represents a single vertex in a mesh.
 ///
-/// Contains position, texture coordinates, and normal vector.
+/// Full precision, only used while cooking. The GPU gets a PackedPosition and a PackedVertex instead.
 struct Vertex
 {
     glm::vec3 Position;  ///< The position of the vertex.
@@ -36,20 +43,36 @@ struct Vertex
     glm::vec3 Bitangent; ///< The bitangent vector.
 };
 
+/// @struct PackedPosition
+/// @brief The cooked position of a vertex, as UNORM16 inside the bounding box of its primitive.
+///
+/// Kept in its own stream so the shadow passes only fetch 8 bytes per vertex.
+struct PackedPosition
+{
+    UInt16 X; ///< Position along the bounding box width.
+    UInt16 Y; ///< Position along the bounding box height.
+    UInt16 Z; ///< Position along the bounding box depth.
+    UInt16 Padding; ///< Keeps positions 8 bytes aligned.
+};
+
+/// @struct PackedVertex
+/// @brief The cooked shading attributes of a vertex, 12 bytes next to the 56 of Vertex.
+struct PackedVertex
+{
+    UInt32 Normal; ///< Octahedral normal, two SNORM16.
+    UInt32 Tangent; ///< Octahedral tangent, two SNORM16. The lowest bit of the second one is set when the bitangent is flipped.
+    UInt32 UV; ///< Texture coordinates, two halves.
+};
+
 /// @struct MeshMaterial
 /// @brief Represents material properties of a mesh.
 ///
 /// Stores references to textures and material properties like color and transparency.
 struct MeshMaterial
 {
-    Ref<Asset> Albedo; ///< Pointer to the albedo texture asset.
-    View::Ref AlbedoView; ///< View pointer to the albedo texture.
-
-    Ref<Asset> Normal; ///< Pointer to the normal texture asset.
-    View::Ref NormalView; ///< View pointer to the normal texture.
-
-    Ref<Asset> PBR; ///< Pointer to the PBR texture asset.
-    View::Ref PBRView; ///< View pointer to the PBR texture.
+    Ref<Asset> Albedo; ///< Pointer to the albedo texture asset, may still be loading.
+    Ref<Asset> Normal; ///< Pointer to the normal texture asset, may still be loading.
+    Ref<Asset> PBR; ///< Pointer to the PBR texture asset, may still be loading.
 
     bool AlphaTested; ///< Indicates if the material uses alpha testing.
     float AlphaCutoff; ///< Cutoff threshold for alpha testing.
@@ -71,31 +94,70 @@ struct MeshletBounds
     float ConeCutoff; ///< Cosine of the cone angle divided by 2.
 };
 
-/// @struct MeshPrimitive
-/// @brief Represents a single drawable part of a mesh.
-///
-/// Stores buffer references and rendering-related data.
-struct MeshPrimitive
+/// @struct MeshletData
+/// @brief The meshlets of a primitive, laid out the way the mesh shaders read them.
+struct MeshletData
+{
+    Vector<meshopt_Meshlet> Meshlets; ///< Offsets and counts of each meshlet.
+    Vector<UInt32> Vertices; ///< Indices into the vertex buffer, referenced by the meshlets.
+    Vector<UInt32> Triangles; ///< Meshlet-local triangle indices, widened to one UInt32 each.
+    Vector<MeshletBounds> Bounds; ///< Culling bounds of each meshlet.
+};
+
+/// @struct MeshLOD
+/// @brief A level of detail of a primitive: its own triangles and meshlets, over the vertices of the primitive.
+struct MeshLOD
 {
-    Buffer::Ref VertexBuffer; ///< Pointer to the vertex buffer.
     Buffer::Ref IndexBuffer; ///< Pointer to the index buffer.
     Buffer::Ref MeshletBuffer; ///< Pointer to the meshlet buffer.
     Buffer::Ref MeshletVertices; ///< Pointer to the meshlet vertices buffer.
     Buffer::Ref MeshletTriangles; ///< Pointer to the meshlet triangles buffer.
     Buffer::Ref MeshletBounds; ///< Pointer to the meshlet bounds buffer.
 
+    UInt32 IndexCount = 0; ///< Number of indices in the level.
+    UInt32 MeshletCount = 0; ///< Number of meshlets in the level.
+    float Error = 0.0f; ///< How far, in object space, the simplified surface may be from the full resolution one.
+};
+
+/// @struct MeshPrimitive
+/// @brief Represents a single drawable part of a mesh.
+///
+/// Stores buffer references and rendering-related data.
+struct MeshPrimitive
+{
+    Buffer::Ref PositionBuffer; ///< Pointer to the packed position buffer.
+    Buffer::Ref VertexBuffer; ///< Pointer to the packed vertex attribute buffer.
+    Vector<MeshLOD> LODs; ///< Levels of detail, from full resolution to coarsest. Never empty once loaded.
+
     RaytracingInstance Instance; ///< Instance for ray tracing.
     BLAS::Ref GeometryStructure; ///< Bottom-level acceleration structure for ray tracing.
 
     UInt32 VertexCount; ///< Number of vertices in the primitive.
-    UInt32 IndexCount; ///< Number of indices in the primitive.
-    UInt32 MeshletCount; ///< Number of meshlets in the primitive.
     int MaterialIndex; ///< Index of the material used by this primitive.
 
     AABB BoundingBox;
+    glm::mat4 Dequantize; ///< Maps packed positions, once normalized, from the unit cube back into the bounding box.
+    float UVDensity = 0.0f; ///< Texture coordinate units per object space unit, averaged over the surface. Drives texture streaming.
 
     bool IsBoxOutsidePlane(const Plane& plane, const AABB& box, const glm::mat4& transform);
     bool IsBoxInFrustum(glm::mat4 transform, glm::mat4 view, glm::mat4 proj);
+
+    /// @brief Estimates how many pixels an object space unit of the primitive covers, at the closest point of its bounds.
+    /// @param transform World transform of the primitive.
+    /// @param view View matrix of the target.
+    /// @param proj Projection matrix of the target, perspective or orthographic.
+    /// @param viewportHeight Height of the target, in pixels.
+    /// @return Pixels per object space unit, infinity when the view is inside the bounds.
+    float GetPixelsPerUnit(const glm::mat4& transform, const glm::mat4& view, const glm::mat4& proj, float viewportHeight) const;
+
+    /// @brief Picks the coarsest level of detail whose error stays under MESH_LOD_PIXEL_ERROR once projected.
+    /// @param transform World transform of the primitive.
+    /// @param view View matrix of the target.
+    /// @param proj Projection matrix of the target, perspective or orthographic.
+    /// @param viewportHeight Height of the target, in pixels.
+    /// @param bias Scales the allowed error, above 1 picks coarser levels.
+    /// @return Index into LODs.
+    UInt32 SelectLOD(const glm::mat4& transform, const glm::mat4& view, const glm::mat4& proj, float viewportHeight, float bias = 1.0f) const;
 };
 
 /// @struct MeshNode
@@ -119,42 +181,92 @@ struct MeshNode
 /// @brief Represents a 3D mesh with materials and hierarchy.
 ///
 /// Handles mesh loading, storage, and rendering-related data.
+///
+/// Model files are imported once by Cook(), through the AssetCacher, into a flat binary layout
+/// (strings are a UInt32 length followed by the characters, arrays a UInt32 count followed by the elements):
+/// - UInt32 node count, UInt32 material count.
+/// - Per material: color, alpha tested (UInt8), alpha cutoff, albedo, normal and PBR texture paths.
+/// - Per node, parents before children: Int32 parent index, name, transform, UInt32 primitive count, then per primitive:
+///   material index, bounding box, UV density, packed positions*, packed vertices*, UInt32 LOD count, then per level of detail:
+///   float error, indices*, meshlets, meshlet vertices*, meshlet triangles*, meshlet bounds.
+///
+/// Streams marked * are compressed with meshopt's codecs: a UInt32 element count, then the encoded bytes as an array.
+/// Vertices are deduplicated and ordered for the vertex cache, overdraw and fetch locality before being encoded.
+/// Coarser levels of detail are simplified from the full resolution one with meshopt_simplify and share its vertices.
+///
+/// Decode() walks that layout and decodes the compressed streams in parallel on the job system, from any thread.
+/// Finalize() then creates the GPU resources on the main thread, uploading everything that wasn't compressed straight
+/// from the mapped cache file or archive. Load() does both at once.
 class Mesh
 {
 public:
     String Path; ///< File path of the mesh.
     String Directory; ///< Directory containing the mesh assets.
 
-    MeshNode* Root = nullptr; ///< Root node of the mesh hierarchy.
+    MeshNode* Root = nullptr; ///< Root node of the mesh hierarchy, null until finalized.
     Vector<MeshMaterial> Materials; ///< List of materials used by the mesh.
 
     UInt32 VertexCount = 0; ///< Total vertex count in the mesh.
-    UInt32 IndexCount = 0; ///< Total index count in the mesh.
-    UInt32 MeshletCount = 0; ///< Total meshlet count in the mesh.
+    UInt32 IndexCount = 0; ///< Total index count in the mesh, at full resolution.
+    UInt32 MeshletCount = 0; ///< Total meshlet count in the mesh, at full resolution.
 
-    /// @brief Loads a mesh from a file.
+    /// @brief Loads a mesh from its cooked form, cooking it first if needed.
     /// @param rhi Pointer to the rendering hardware interface.
     /// @param path Path to the mesh file.
     void Load(RHI::Ref rhi, const String& path);
 
+    /// @brief Reads a mesh from its cooked form, cooking it first if needed, and decodes its streams. Safe on worker threads.
+    /// @param path Path to the mesh file.
+    /// @return False if the mesh couldn't be read, Finalize() then leaves it empty.
+    bool Decode(const String& path);
+
+    /// @brief Creates and uploads the GPU resources of a decoded mesh and makes it visible. Main thread only.
+    /// @param rhi Pointer to the rendering hardware interface.
+    /// @return Number of bytes enqueued on the uploader.
+    UInt64 Finalize(RHI::Ref rhi);
+
+    /// @brief Imports a model file with Assimp, builds its meshlets and appends its cooked form to a buffer.
+    /// @param path Path to the model file.
+    /// @param bytes Receives the cooked mesh.
+    /// @return False if the file couldn't be imported.
+    static bool Cook(const String& path, Vector<UInt8>& bytes);
+
+    /// @brief Constructor for Mesh, out of line so the pending load can stay private to Mesh.cpp.
+    Mesh();
+
     /// @brief Destructor for Mesh, responsible for cleanup.
     ~Mesh();
 
+    /// @brief Splits a primitive into optimized meshlets and computes their bounds.
+    /// @param vertices The vertices of the primitive.
+    /// @param indices The triangle list of the primitive.
+    /// @return The meshlets, empty if there are no triangles.
+    static MeshletData BuildMeshlets(const Vector<Vertex>& vertices, const Vector<UInt32>& indices);
+
 private:
+    struct PendingLoad;
+
     RHI::Ref mRHI; ///< Pointer to the rendering hardware interface.
+    Unique<PendingLoad> mPending; ///< Decoded data waiting for Finalize().
 
-    /// @brief Processes a primitive within a mesh.
-    /// @param mesh The Assimp mesh data.
-    /// @param node The corresponding MeshNode.
-    /// @param scene The Assimp scene pointer.
-    /// @param transform Transformation matrix applied to the primitive.
-    void ProcessPrimitive(aiMesh *mesh, MeshNode* node, const aiScene *scene, glm::mat4 transform);
+    /// @brief Builds the materials and nodes of a cooked mesh and decodes its streams, without touching the GPU.
+    /// @param data The cooked mesh.
+    /// @param size Size of the cooked mesh, in bytes.
+    /// @return False if the data is truncated or corrupted.
+    bool DecodeCooked(const UInt8* data, UInt64 size);
 
-    /// @brief Processes a mesh node from Assimp.
-    /// @param node The current MeshNode being processed.
+    /// @brief Cooks an Assimp node and its children.
+    /// @param bytes Receives the cooked nodes.
     /// @param assimpNode The Assimp node pointer.
     /// @param scene The Assimp scene pointer.
-    void ProcessNode(MeshNode* node, aiNode *assimpNode, const aiScene *scene);
+    /// @param parent Index of the parent node, -1 for the root.
+    /// @param nodeCount Number of nodes cooked so far, incremented for every node.
+    static void CookNode(Vector<UInt8>& bytes, aiNode *assimpNode, const aiScene *scene, Int32 parent, UInt32& nodeCount);
+
+    /// @brief Cooks a primitive: its vertices, then the indices and meshlets of each level of detail.
+    /// @param bytes Receives the cooked primitive.
+    /// @param mesh The Assimp mesh data.
+    static void CookPrimitive(Vector<UInt8>& bytes, aiMesh *mesh);
 
     /// @brief Recursively frees all nodes in the hierarchy.
     /// @param node The node to be freed.
@@ -6,7 +6,11 @@
 #pragma once
 
 #include <Core/Common.hpp>
-#include <Agility/d3d12shader.h>
+#if defined(MNEMEN_RHI_NULL)
+    #include <RHI/Null/NullD3D12.hpp>
+#else
+    #include <Agility/d3d12shader.h>
+#endif
 
 /// @enum ShaderType
 /// @brief Represents different types of shaders.
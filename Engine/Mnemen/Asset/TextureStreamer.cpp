@@ -0,0 +1,218 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-13 11:21:37
+//
+
+#include <Asset/TextureStreamer.hpp>
+
+#include <Core/Application.hpp>
+#include <Core/Counters.hpp>
+#include <Core/Logger.hpp>
+#include <Core/Profiler.hpp>
+#include <RHI/Uploader.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+static Counter sResidentBytes("Streamed Texture Bytes");
+static Counter sStreamedBytes("Streamed Texture Uploads");
+static Counter sEvictions("Streamed Texture Evictions");
+
+TextureStreamer::Data TextureStreamer::sData;
+
+void TextureStreamer::Init(RHI::Ref rhi)
+{
+    sData.Rhi = rhi;
+}
+
+void TextureStreamer::Clean()
+{
+    sData.Textures.clear();
+    sData.Upgrades.clear();
+    sData.Retired.clear();
+    sData.ResidentBytes = 0;
+}
+
+UInt64 TextureStreamer::GetChainSize(const StreamedTexture& texture, UInt32 mip)
+{
+    // BC3 and BC7 both store 4x4 blocks in 16 bytes, each mip tightly packed after the previous one
+    UInt64 size = 0;
+    for (UInt32 i = mip; i < texture.Levels; i++) {
+        UInt64 blocksWide = std::max(1u, ((texture.Width >> i) + 3) / 4);
+        UInt64 blocksHigh = std::max(1u, ((texture.Height >> i) + 3) / 4);
+        size += blocksWide * blocksHigh * 16;
+    }
+    return size;
+}
+
+UInt64 TextureStreamer::MakeResident(StreamedTexture& texture, Asset& asset, UInt32 mip)
+{
+    TextureDesc desc;
+    desc.Width = std::max(1u, texture.Width >> mip);
+    desc.Height = std::max(1u, texture.Height >> mip);
+    desc.Levels = texture.Levels - mip;
+    desc.Depth = 1;
+    desc.Name = asset.Path;
+    desc.Format = texture.Format;
+    desc.Usage = TextureUsage::ShaderResource;
+
+    Texture::Ref gpuTexture = sData.Rhi->CreateTexture(desc);
+    gpuTexture->Tag(ResourceTag::ModelTexture);
+    View::Ref view = sData.Rhi->CreateView(gpuTexture, ViewType::ShaderResource);
+
+    UInt64 size = GetChainSize(texture, mip);
+    UInt64 offset = GetChainSize(texture, 0) - size;
+    Uploader::EnqueueTextureUpload(texture.File.Bytes + offset, size, gpuTexture);
+
+    // Frames in flight may still sample the old texture. They were all submitted before the flush that uploads the new one.
+    if (asset.Texture) {
+        sData.Retired.push_back({ asset.Texture, asset.ShaderView, Uploader::GetNextFenceValue() });
+    }
+    asset.Texture = gpuTexture;
+    asset.ShaderView = view;
+
+    // Textures too small to stream are always fully resident, they're left out of the budget
+    if (texture.MaxMip > 0) {
+        sData.ResidentBytes = sData.ResidentBytes - texture.ResidentBytes + size;
+    }
+    texture.ResidentMip = mip;
+    texture.ResidentBytes = size;
+    return size;
+}
+
+UInt64 TextureStreamer::Register(const Asset::Handle& asset, AssetFile file)
+{
+    CompressionFormat format = Application::Get()->GetProject()->Settings.Format;
+    bool streamed = Application::Get()->GetProject()->Settings.TextureStreamingBudget > 0;
+
+    StreamedTexture texture = {};
+    texture.Owner = asset;
+    texture.Width = file.Header.TextureHeader.Width;
+    texture.Height = file.Header.TextureHeader.Height;
+    texture.Levels = std::max(1, file.Header.TextureHeader.Levels);
+    texture.Format = format == CompressionFormat::BC7 ? TextureFormat::BC7 : TextureFormat::BC3;
+    texture.File = std::move(file);
+    if (GetChainSize(texture, 0) != texture.File.Size) {
+        LOG_WARN("Texture {0} doesn't match its cooked mip layout, it won't be streamed", asset->Path);
+        streamed = false;
+    }
+
+    // BC textures need their top mip to be a multiple of the block size
+    while (texture.MaxMip + 1 < texture.Levels) {
+        UInt32 width = texture.Width >> (texture.MaxMip + 1);
+        UInt32 height = texture.Height >> (texture.MaxMip + 1);
+        if (width < TEXTURE_STREAMING_MIN_SIZE || height < TEXTURE_STREAMING_MIN_SIZE || width % 4 != 0 || height % 4 != 0)
+            break;
+        texture.MaxMip++;
+    }
+    if (!streamed || texture.MaxMip == 0) {
+        texture.MaxMip = 0;
+        return MakeResident(texture, *asset, 0);
+    }
+
+    // Starts small, Update() streams the rest in once something looks at it
+    texture.WantedMip = texture.MaxMip;
+    texture.TargetMip = texture.MaxMip;
+    texture.LastSeenFrame = sData.Frame;
+    UInt64 size = MakeResident(texture, *asset, texture.MaxMip);
+
+    asset->StreamIndex = Int32(sData.Textures.size());
+    sData.Textures.push_back(std::move(texture));
+    return size;
+}
+
+void TextureStreamer::Request(const Asset::Handle& texture, float uvPerPixel)
+{
+    if (!texture || texture->StreamIndex < 0)
+        return;
+    StreamedTexture& streamed = sData.Textures[texture->StreamIndex];
+    streamed.UVPerPixel = std::min(streamed.UVPerPixel, uvPerPixel);
+}
+
+UInt64 TextureStreamer::Update(UInt64 uploadBudget)
+{
+    PROFILE_FUNCTION();
+
+    std::erase_if(sData.Retired, [](const RetiredTexture& retired) {
+        return Uploader::IsComplete(retired.FenceValue);
+    });
+    sData.Frame++;
+    if (sData.Textures.empty())
+        return 0;
+
+    // Forget textures whose asset is gone, their GPU texture went with it
+    for (UInt64 i = 0; i < sData.Textures.size(); ) {
+        if (sData.Textures[i].Owner.expired()) {
+            sData.ResidentBytes -= sData.Textures[i].ResidentBytes;
+            sData.Textures[i] = std::move(sData.Textures.back());
+            sData.Textures.pop_back();
+            if (i < sData.Textures.size())
+                sData.Textures[i].Owner.lock()->StreamIndex = Int32(i);
+        } else {
+            i++;
+        }
+    }
+
+    // A mip is needed once its texels get smaller than a pixel
+    for (StreamedTexture& texture : sData.Textures) {
+        if (texture.UVPerPixel < std::numeric_limits<float>::max()) {
+            float texelsPerPixel = float(std::max(texture.Width, texture.Height)) * texture.UVPerPixel;
+            float mip = texelsPerPixel > 1.0f ? std::floor(std::log2(texelsPerPixel)) : 0.0f;
+            texture.WantedMip = std::min(UInt32(mip), texture.MaxMip);
+            texture.LastSeenFrame = sData.Frame;
+        } else if (sData.Frame - texture.LastSeenFrame > TEXTURE_STREAMING_IDLE_FRAMES) {
+            texture.WantedMip = texture.MaxMip;
+        }
+        texture.UVPerPixel = std::numeric_limits<float>::max();
+    }
+
+    // Push every texture down by the same number of mips until the wanted set fits
+    UInt64 budget = UInt64(Application::Get()->GetProject()->Settings.TextureStreamingBudget) * 1024 * 1024;
+    UInt32 bias = 0;
+    for (; bias < TEXTURE_STREAMING_MAX_BIAS; bias++) {
+        UInt64 total = 0;
+        for (const StreamedTexture& texture : sData.Textures) {
+            total += GetChainSize(texture, std::min(texture.WantedMip + bias, texture.MaxMip));
+        }
+        if (total <= budget)
+            break;
+    }
+
+    UInt64 uploaded = 0;
+    sData.Upgrades.clear();
+    for (UInt32 i = 0; i < sData.Textures.size(); i++) {
+        StreamedTexture& texture = sData.Textures[i];
+        texture.TargetMip = std::min(texture.WantedMip + bias, texture.MaxMip);
+
+        // Evict right away when over budget or unseen, otherwise keep the mips around in case they're needed again
+        bool idle = sData.Frame - texture.LastSeenFrame > TEXTURE_STREAMING_IDLE_FRAMES;
+        if (texture.TargetMip > texture.ResidentMip && (idle || sData.ResidentBytes > budget)) {
+            uploaded += MakeResident(texture, *texture.Owner.lock(), texture.TargetMip);
+            sEvictions.Increment();
+        } else if (texture.TargetMip < texture.ResidentMip) {
+            sData.Upgrades.push_back(i);
+        }
+    }
+
+    // Stream in the blurriest textures first
+    std::sort(sData.Upgrades.begin(), sData.Upgrades.end(), [](UInt32 a, UInt32 b) {
+        const StreamedTexture& first = sData.Textures[a];
+        const StreamedTexture& second = sData.Textures[b];
+        return first.ResidentMip - first.TargetMip > second.ResidentMip - second.TargetMip;
+    });
+    UInt64 streamed = 0;
+    for (UInt32 index : sData.Upgrades) {
+        StreamedTexture& texture = sData.Textures[index];
+        UInt64 size = GetChainSize(texture, texture.TargetMip);
+        if (sData.ResidentBytes - texture.ResidentBytes + size > budget)
+            continue;
+        // At least one upgrade goes through each frame, or chains larger than the upload budget would never stream in
+        if (streamed > 0 && streamed + size > uploadBudget)
+            continue;
+        streamed += MakeResident(texture, *texture.Owner.lock(), texture.TargetMip);
+    }
+
+    sResidentBytes.Add(sData.ResidentBytes);
+    sStreamedBytes.Add(streamed);
+    return uploaded + streamed;
+}
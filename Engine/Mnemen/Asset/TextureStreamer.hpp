@@ -0,0 +1,99 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-13 11:04:52
+//
+
+#pragma once
+
+#include <Asset/AssetCacher.hpp>
+
+#include <limits>
+
+constexpr UInt32 TEXTURE_STREAMING_MIN_SIZE = 64; ///< Mips this size and below stay resident for as long as their texture is loaded.
+constexpr UInt32 TEXTURE_STREAMING_IDLE_FRAMES = 120; ///< Frames a texture may go unseen before it falls back to its smallest mips.
+constexpr UInt32 TEXTURE_STREAMING_MAX_BIAS = 16; ///< Most mips every texture may be pushed down by to fit the budget.
+
+/// @brief A cooked texture whose mips are streamed in and out.
+struct StreamedTexture
+{
+    std::weak_ptr<Asset> Owner; ///< The texture asset, the streamer never keeps it alive.
+    AssetFile File; ///< The cooked mips, kept mapped so they can be uploaded again.
+
+    UInt32 Width = 0; ///< Width of the full resolution mip.
+    UInt32 Height = 0; ///< Height of the full resolution mip.
+    UInt32 Levels = 0; ///< Mips in the cooked file.
+    TextureFormat Format = TextureFormat::BC7;
+
+    UInt32 ResidentMip = 0; ///< Finest mip on the GPU, every coarser one is resident too.
+    UInt32 WantedMip = 0; ///< Finest mip the last views asked for.
+    UInt32 TargetMip = 0; ///< WantedMip, once pushed down to fit the budget.
+    UInt32 MaxMip = 0; ///< Coarsest mip that may become the finest resident one.
+    UInt64 ResidentBytes = 0; ///< Size of the resident mips.
+
+    float UVPerPixel = std::numeric_limits<float>::max(); ///< Smallest texture coordinate footprint of a pixel requested this frame.
+    UInt64 LastSeenFrame = 0; ///< Last frame the texture was requested.
+};
+
+/// @brief A texture replaced by a new set of mips, that frames already submitted may still sample.
+struct RetiredTexture
+{
+    Texture::Ref Texture;
+    View::Ref ShaderView;
+    UInt64 FenceValue = 0; ///< Upload fence value after which the GPU is done with the texture.
+};
+
+/// @class TextureStreamer
+/// @brief Keeps the mips of cooked textures resident only while they are visible, under the project's TextureStreamingBudget.
+///
+/// The renderer reports how much of the UV space a pixel covers for every visible material, from primitive bounds and
+/// the UV density cooked with each mesh. From that every texture gets the finest mip it needs. If those don't fit in the
+/// budget, every texture is pushed down the same number of mips until they do.
+///
+/// A texture whose resident mips change is recreated with just those mips, uploaded straight from its mapped cooked file,
+/// and the view of its asset is swapped for the new one. The GPU never sees a partially resident texture, and the old
+/// texture is only released once the GPU went past the upload fence signaled after the swap.
+///
+/// Main thread only.
+class TextureStreamer
+{
+public:
+    /// @brief Initializes the streamer.
+    /// @param rhi The RHI used to create textures.
+    static void Init(RHI::Ref rhi);
+
+    /// @brief Forgets every streamed texture.
+    static void Clean();
+
+    /// @brief Creates the GPU texture of a cooked texture asset, with only its smallest mips if it can be streamed.
+    /// @param asset The texture asset, receives the texture and its shader view.
+    /// @param file The cooked texture.
+    /// @return Number of bytes enqueued on the uploader.
+    static UInt64 Register(const Asset::Handle& asset, AssetFile file);
+
+    /// @brief Reports that a texture is visible this frame.
+    /// @param texture The texture asset. Ignored if null or not streamed.
+    /// @param uvPerPixel Texture coordinate units a pixel covers where the texture is drawn.
+    static void Request(const Asset::Handle& texture, float uvPerPixel);
+
+    /// @brief Picks the mips each texture needs, then evicts and streams them in.
+    /// @param uploadBudget Bytes that may be uploaded to stream mips in. The first upgrade of a frame and evictions ignore it.
+    /// @return Number of bytes enqueued on the uploader.
+    static UInt64 Update(UInt64 uploadBudget);
+
+    /// @brief Gets the size of every resident streamed mip.
+    /// @return The size, in bytes.
+    static UInt64 GetResidentBytes() { return sData.ResidentBytes; }
+
+private:
+    static UInt64 GetChainSize(const StreamedTexture& texture, UInt32 mip);
+    static UInt64 MakeResident(StreamedTexture& texture, Asset& asset, UInt32 mip);
+
+    static struct Data {
+        RHI::Ref Rhi;
+        Vector<StreamedTexture> Textures;
+        Vector<UInt32> Upgrades; ///< Scratch list of textures to stream in, kept around so Update() doesn't allocate.
+        Vector<RetiredTexture> Retired; ///< Replaced textures, released by Update() once their fence value is reached.
+        UInt64 ResidentBytes = 0;
+        UInt64 Frame = 0;
+    } sData;
+};
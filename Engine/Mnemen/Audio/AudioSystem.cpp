@@ -8,6 +8,7 @@
 
 #include <Core/Logger.hpp>
 #include <Core/Profiler.hpp>
+#include <Core/Memory.hpp>
 
 AudioSystem::Data AudioSystem::sData;
 
@@ -23,6 +24,21 @@ void DataCallback(ma_device *pDevice, void *output, const void *input, ma_uint32
     ma_engine_read_pcm_frames(engine, output, frameCount, nullptr);
 }
 
+static void* AudioMalloc(size_t size, void* userData)
+{
+    return Memory::Allocate(size, MemoryTag::Audio);
+}
+
+static void* AudioRealloc(void* ptr, size_t size, void* userData)
+{
+    return Memory::Reallocate(ptr, size, MemoryTag::Audio);
+}
+
+static void AudioFree(void* ptr, void* userData)
+{
+    Memory::Free(ptr);
+}
+
 void AudioSystem::Init()
 {
     ma_device_config deviceConfig = ma_device_config_init(ma_device_type_playback);
@@ -44,6 +60,9 @@ void AudioSystem::Init()
     ma_engine_config engineConfig = ma_engine_config_init();
     engineConfig.pDevice = &sData.Device;
     engineConfig.listenerCount = 1;
+    engineConfig.allocationCallbacks.onMalloc = AudioMalloc;
+    engineConfig.allocationCallbacks.onRealloc = AudioRealloc;
+    engineConfig.allocationCallbacks.onFree = AudioFree;
 
     result = ma_engine_init(&engineConfig, &sData.Engine);
     if (result != MA_SUCCESS) {
@@ -74,6 +93,7 @@ void AudioSystem::Awake(Ref<Scene> scene)
 void AudioSystem::Update(Ref<Scene> scene)
 {
     PROFILE_FUNCTION();
+    MemoryScope memoryScope(MemoryTag::Audio);
 
     entt::registry* registry = scene->GetRegistry();
     auto view = registry->view<AudioSourceComponent>();
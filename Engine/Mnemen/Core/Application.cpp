@@ -7,9 +7,15 @@
 #include <Core/Logger.hpp>
 #include <Core/Profiler.hpp>
 #include <Core/Assert.hpp>
+#include <Core/JobSystem.hpp>
+#include <Core/Arena.hpp>
+#include <Core/Counters.hpp>
+#include <Core/Memory.hpp>
+#include <Core/Replay.hpp>
 
 #include <Input/Input.hpp>
 #include <Asset/AssetCacher.hpp>
+#include <Asset/AssetArchive.hpp>
 #include <Asset/AssetManager.hpp>
 
 #include <World/SceneSerializer.hpp>
@@ -24,6 +30,7 @@
 #include <Renderer/SkyboxCooker.hpp>
 
 #include <imgui.h>
+#include <cmath>
 
 Application* Application::sInstance;
 
@@ -33,6 +40,8 @@ Application::Application(ApplicationSpecs specs)
     sInstance = this;
 
     Logger::Init();
+    JobSystem::Init();
+    FrameArena::Init();
     Input::Init();
     PhysicsSystem::Init();
     AudioSystem::Init();
@@ -47,7 +56,11 @@ Application::Application(ApplicationSpecs specs)
         mProject->Load(specs.ProjectPath);
 
     Profiler::Init(mRHI);
+    Profiler::SetHitchBudget(mProject->Settings.HitchBudget);
     AssetManager::Init(mRHI);
+    if (!specs.ArchivePath.empty() && !AssetArchive::Mount(specs.ArchivePath)) {
+        LOG_WARN("Falling back to the asset cache");
+    }
     AssetCacher::Init("Assets");
 
     mRenderer = MakeRef<Renderer>(mRHI);
@@ -65,26 +78,48 @@ Application::Application(ApplicationSpecs specs)
 Application::~Application()
 {
     AssetManager::Purge();
+    AssetArchive::Unmount();
     Profiler::Exit();
     ScriptSystem::Exit();
     AISystem::Exit();
     AudioSystem::Exit();
     PhysicsSystem::Exit();
     Input::Exit();
+    FrameArena::Exit();
+    JobSystem::Exit();
 
     LOG_INFO("Mnemen is done!");
 }
 
 void Application::OnAwake()
+{
+    if (Replay::IsActive()) {
+        mRequestedScenePlaying = true;
+        return;
+    }
+    StartScene();
+}
+
+void Application::OnStop()
+{
+    if (Replay::IsActive()) {
+        mRequestedScenePlaying = false;
+        return;
+    }
+    StopScene();
+}
+
+void Application::StartScene()
 {
     mScenePlaying = true;
+    mPhysicsAccumulator = 0.0f;
 
     ScriptSystem::Awake(mScene);
     AudioSystem::Awake(mScene);
     PhysicsSystem::OnAwake(mScene);
 }
 
-void Application::OnStop()
+void Application::StopScene()
 {
     PhysicsSystem::OnStop(mScene);
     AudioSystem::Quit(mScene);
@@ -93,9 +128,39 @@ void Application::OnStop()
     mScenePlaying = false;
 }
 
+bool Application::UpdateReplay(float& dt)
+{
+    ReplayFrame frame = {};
+    if (Replay::GetMode() == ReplayMode::Recording) {
+        frame.DeltaTime = dt;
+        frame.ScenePlaying = mRequestedScenePlaying;
+        Replay::RecordFrame(frame);
+    } else if (!Replay::ReadFrame(frame)) {
+        return false;
+    }
+    dt = frame.DeltaTime;
+
+    // Scene transitions only happen here while a replay runs, so both runs start and stop the scene on the same frame.
+    if (frame.ScenePlaying && !mScenePlaying) {
+        StartScene();
+    } else if (!frame.ScenePlaying && mScenePlaying) {
+        StopScene();
+    }
+    return true;
+}
+
 void Application::Run()
 {
     Uploader::Flush();
+    if (!mApplicationSpecs.ReplayPath.empty()) {
+        if (Replay::BeginPlayback(mApplicationSpecs.ReplayPath) && !mApplicationSpecs.ReplayCapturePath.empty())
+            Profiler::BeginCapture(Replay::GetFrameCount(), mApplicationSpecs.ReplayCapturePath);
+    } else if (!mApplicationSpecs.RecordPath.empty()) {
+        Replay::BeginRecording(mApplicationSpecs.RecordPath);
+    }
+    mRequestedScenePlaying = mScenePlaying;
+
+    mWindow->Update();
     while (mWindow->IsOpen()) {
         Profiler::BeginFrame();
 
@@ -105,31 +170,57 @@ void Application::Run()
         mLastFrame = time;
         dt /= 1000.0f;
 
+        if (Replay::IsActive() && !UpdateReplay(dt)) {
+            break;
+        }
+
         // On Physics Update
         {
             PROFILE_SCOPE("Physics Update");
-            float minStepDuration = 1.0f / mProject->Settings.PhysicsRefreshRate;
-            if (TO_SECONDS(mPhysicsTimer.GetElapsed()) > minStepDuration) {
+            float stepDuration = 1.0f / mProject->Settings.PhysicsRefreshRate;
+            UInt32 maxSubsteps = std::max(mProject->Settings.MaxPhysicsSubsteps, 1u);
+
+            mPhysicsAccumulator += dt;
+            UInt32 substeps = 0;
+            while (mPhysicsAccumulator >= stepDuration && substeps < maxSubsteps) {
                 OnPhysicsTick();
                 if (mScenePlaying && mScene) {
-                    PhysicsSystem::Update(mScene, minStepDuration);
+                    PhysicsSystem::Update(mScene, stepDuration);
                 }
-                mPhysicsTimer.Restart();
+                mPhysicsAccumulator -= stepDuration;
+                substeps++;
+            }
+
+            // Out of budget: drop the time we couldn't simulate rather than paying for it over the next frames.
+            if (mPhysicsAccumulator >= stepDuration) {
+                mPhysicsAccumulator = std::fmod(mPhysicsAccumulator, stepDuration);
+            }
+
+            if (mScenePlaying && mScene) {
+                PhysicsSystem::Interpolate(mScene, mPhysicsAccumulator / stepDuration);
             }
         }
 
         // Engine Update
         {
             PROFILE_SCOPE("Systems Update");
-            
-            mWindow->Update();
+
+            // Scripts can add/remove entities and touch any component, so they run alone first.
             if (mScenePlaying && mScene) {
-                AISystem::Update(mScene);
-                AudioSystem::Update(mScene);
                 ScriptSystem::Update(mScene, dt);
             }
+
+            // AI and audio don't share components with the transform/camera update, let the workers take them.
+            Job* systems = JobSystem::CreateEmptyJob();
+            if (mScenePlaying && mScene) {
+                Ref<Scene> scene = mScene;
+                JobSystem::Run(JobSystem::CreateJob([scene]() { AISystem::Update(scene); }, systems));
+                JobSystem::Run(JobSystem::CreateJob([scene]() { AudioSystem::Update(scene); }, systems));
+            }
+            JobSystem::Run(systems);
             if (mScene)
                 mScene->Update();
+            JobSystem::Wait(systems);
         }
 
         // App Update
@@ -138,10 +229,19 @@ void Application::Run()
             OnUpdate(dt);
         }
         
-        // Render
+        // Extract: copy what the renderer needs so the scene is free to move on.
         {
-            PROFILE_SCOPE("CPU Render");
-            OnPrivateRender();
+            PROFILE_SCOPE("Render Extract");
+            mRenderer->Extract(mScene);
+        }
+
+        // Sync point: the previous frame must be done before we touch the window, assets or the snapshots.
+        {
+            PROFILE_SCOPE("Render Wait");
+            WaitForRender();
+            Memory::EndFrame();
+            Counters::EndFrame();
+            Profiler::RecordCounters();
         }
 
         // Post Update
@@ -149,10 +249,35 @@ void Application::Run()
             PostPresent();
             AssetManager::Update();
             Input::PostUpdate();
+            mWindow->Update();
+        }
+
+        // Render
+        {
+            PROFILE_SCOPE("CPU Render");
+            mRenderer->Swap();
+            if (mApplicationSpecs.PipelinedRendering) {
+                mRenderJob = JobSystem::CreateJob([this]() { OnPrivateRender(); });
+                // On the main thread's queue it would get picked up by the next Wait() of the frame, and stall the simulation
+                JobSystem::RunOnWorker(mRenderJob, JobPriority::High);
+            } else {
+                OnPrivateRender();
+            }
         }
     }
+    WaitForRender();
+    Replay::End();
     mRHI->Wait();
     AssetManager::Clean();
+    Uploader::ClearRequests();
+}
+
+void Application::WaitForRender()
+{
+    if (mRenderJob) {
+        JobSystem::Wait(mRenderJob);
+        mRenderJob = nullptr;
+    }
 }
 
 void Application::OnPrivateRender()
@@ -164,7 +289,7 @@ void Application::OnPrivateRender()
 
     // Scene render
     {
-        mRenderer->Render(frame, mScene);
+        mRenderer->Render(frame);
     }
 
     // UI
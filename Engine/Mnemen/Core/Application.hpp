@@ -14,6 +14,8 @@
 #include <Renderer/Renderer.hpp>
 #include <World/Scene.hpp>
 
+struct Job;
+
 /// @struct ApplicationSpecs
 /// @brief Stores configuration settings for the application.
 struct ApplicationSpecs
@@ -25,6 +27,13 @@ struct ApplicationSpecs
     String ProjectPath; ///< The path of the project.
 
     bool CopyToBackBuffer; ///< If set to true, the output color will be copied to the swapchain. Used in Runtime.
+    bool PipelinedRendering = false; ///< If set to true, frame N is rendered on a worker while frame N+1 simulates. OnImGui must not touch the scene.
+
+    String RecordPath; ///< If set, input, frame times and scene transitions are recorded to this file (see Replay).
+    String ReplayPath; ///< If set, the session recorded in this file is played back instead of listening to the OS, and the application exits at its end.
+    String ReplayCapturePath; ///< If set along with ReplayPath, every replayed frame is captured to this Chrome trace file.
+
+    String ArchivePath; ///< If set, cooked assets are read from this asset archive and nothing is cooked at startup (see AssetArchive).
 };
 
 /// @class Application
@@ -46,7 +55,7 @@ public:
     /// @param dt Delta time since the last frame in seconds.
     virtual void OnUpdate(float dt) = 0;
 
-    /// @brief Called at a fixed time step for physics updates (90 Hz by default).
+    /// @brief Called at a fixed time step for physics updates (90 Hz by default). May run several times per frame.
     virtual void OnPhysicsTick() = 0;
 
     /// @brief Called during the UI rendering phase to handle ImGui drawing.
@@ -56,14 +65,22 @@ public:
     virtual void PostPresent() {};
 
     /// @brief Called when the scene is awaken
+    /// @note While a replay is recorded, the scene starts on the next frame boundary. While one is played, the replay decides.
     void OnAwake();
 
     /// @brief Called when the scene is stopped
+    /// @note While a replay is recorded, the scene stops on the next frame boundary. While one is played, the replay decides.
     void OnStop();
 
     /// @brief Starts the application loop.
     void Run();
 
+    /// @brief Waits for the frame being rendered on a worker, if any.
+    ///
+    /// The render job reads assets and snapshots while the main thread moves on. Anything that has to change them
+    /// before the frame's own sync point calls this first.
+    void WaitForRender();
+
     /// @brief Retrieves the main application window.
     /// @return A shared pointer to the window instance.
     Ref<Window> GetWindow() { return mWindow; }
@@ -87,6 +104,17 @@ protected:
     /// @brief Handles internal rendering operations.
     void OnPrivateRender();
 
+    /// @brief Starts the scene systems.
+    void StartScene();
+
+    /// @brief Stops the scene systems.
+    void StopScene();
+
+    /// @brief Records or plays the current frame, and applies the scene transitions on the frame boundary.
+    /// @param dt The frame time, replaced by the recorded one when playing.
+    /// @return False once the replay is over.
+    bool UpdateReplay(float& dt);
+
     static Application* sInstance; ///< Singleton instance of the application.
     
     ApplicationSpecs mApplicationSpecs; ///< Cached application settings.
@@ -95,15 +123,17 @@ protected:
     Timer mTimer; ///< Delta-time tracking timer.
     float mLastFrame = 0.0f; ///< Time of the last frame update.
 
-    Timer mPhysicsTimer; ///< Timer for fixed-step physics updates.
+    float mPhysicsAccumulator = 0.0f; ///< Simulation time, in seconds, not consumed by a physics step yet.
 
     RHI::Ref mRHI = nullptr; ///< Rendering Hardware Interface.
     Renderer::Ref mRenderer = nullptr; ///< Renderer instance.
+    Job* mRenderJob = nullptr; ///< The frame being rendered on a worker when rendering is pipelined.
     
     Ref<Project> mProject = nullptr; ///< Currently active project.
     Ref<Scene> mScene = nullptr; ///< Currently active scene.
 
     bool mUIFocused = true; ///< Whether or not UI elements are focused.
     bool mScenePlaying = false; ///< Whether the scene is playing or not.
+    bool mRequestedScenePlaying = false; ///< Scene state asked for by OnAwake/OnStop while recording, applied on the next frame.
 };
 
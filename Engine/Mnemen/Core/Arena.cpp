@@ -0,0 +1,117 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-06 09:58:41
+//
+
+#include "Arena.hpp"
+
+#include <Core/Memory.hpp>
+#include <RHI/Surface.hpp>
+
+#include <new>
+
+static constexpr std::align_val_t ARENA_BLOCK_ALIGNMENT = std::align_val_t(64);
+
+FrameArena::Data FrameArena::sData;
+
+Arena::Arena(UInt64 blockSize)
+    : mBlockSize(blockSize)
+{
+    AddBlock(blockSize);
+}
+
+Arena::~Arena()
+{
+    for (Block& block : mBlocks) {
+        ::operator delete(block.Memory, ARENA_BLOCK_ALIGNMENT);
+    }
+}
+
+void Arena::AddBlock(UInt64 size)
+{
+    Block block;
+    block.Memory = static_cast<UInt8*>(::operator new(size, ARENA_BLOCK_ALIGNMENT));
+    block.Size = size;
+    mBlocks.push_back(block);
+}
+
+void* Arena::Allocate(UInt64 size, UInt64 alignment)
+{
+    UInt64 offset = (mOffset + alignment - 1) & ~(alignment - 1);
+    while (offset + size > mBlocks[mCurrent].Size) {
+        // Move on to the next block, chaining a new one if the rest are all too small.
+        mCurrent++;
+        if (mCurrent == mBlocks.size()) {
+            AddBlock(std::max(mBlockSize, size + alignment));
+        }
+        offset = 0;
+    }
+
+    mOffset = offset + size;
+    mPeak = std::max(mPeak, GetUsed());
+    return mBlocks[mCurrent].Memory + offset;
+}
+
+void Arena::Rewind(Marker marker)
+{
+    mCurrent = marker.Block;
+    mOffset = marker.Offset;
+}
+
+void Arena::Reset()
+{
+    if (mBlocks.size() > 1) {
+        // The arena overflowed since the last reset, replace the chain with a single block big enough for all of it.
+        UInt64 capacity = GetCapacity();
+        for (Block& block : mBlocks) {
+            ::operator delete(block.Memory, ARENA_BLOCK_ALIGNMENT);
+        }
+        mBlocks.clear();
+        AddBlock(capacity);
+    }
+    mCurrent = 0;
+    mOffset = 0;
+}
+
+UInt64 Arena::GetUsed() const
+{
+    UInt64 used = mOffset;
+    for (UInt32 i = 0; i < mCurrent; i++) {
+        used += mBlocks[i].Size;
+    }
+    return used;
+}
+
+UInt64 Arena::GetCapacity() const
+{
+    UInt64 capacity = 0;
+    for (const Block& block : mBlocks) {
+        capacity += block.Size;
+    }
+    return capacity;
+}
+
+void FrameArena::Init()
+{
+    MemoryScope memoryScope(MemoryTag::Renderer);
+    for (int i = 0; i < FRAMES_IN_FLIGHT; i++) {
+        sData.Frames.push_back(MakeUnique<Arena>());
+    }
+    sData.Current = 0;
+}
+
+void FrameArena::Exit()
+{
+    sData.Frames.clear();
+}
+
+void FrameArena::Begin(UInt32 frameIndex)
+{
+    sData.Current = frameIndex % sData.Frames.size();
+    sData.Frames[sData.Current]->Reset();
+}
+
+Arena& FrameArena::Get()
+{
+    return *sData.Frames[sData.Current];
+}
@@ -0,0 +1,136 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-06 09:40:12
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+#include <cstddef>
+
+/// @brief Linear allocator handing out memory with a pointer bump.
+///
+/// Memory is never freed individually: the whole arena is reset at once, or rewound to a marker.
+/// When a block runs out a new one is chained, and the next Reset() merges every block into a
+/// single one, so an arena that sees the same workload every frame stops calling malloc after
+/// the first few frames. Destructors of objects living in an arena are never run.
+///
+/// An arena is not thread safe, each thread should allocate from its own.
+class Arena
+{
+public:
+    /// @brief A position in the arena that can be rewound to.
+    struct Marker
+    {
+        UInt32 Block = 0; ///< Index of the block that was being allocated from.
+        UInt64 Offset = 0; ///< Offset in that block.
+    };
+
+    /// @brief Creates an arena.
+    /// @param blockSize Size of the first block, and the minimum size of every chained block.
+    Arena(UInt64 blockSize = 1024 * 1024);
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /// @brief Allocates memory from the arena.
+    /// @param size Size of the allocation, in bytes.
+    /// @param alignment Alignment of the allocation, must be a power of two.
+    /// @return The allocated memory, valid until the arena is reset or rewound past it.
+    void* Allocate(UInt64 size, UInt64 alignment = alignof(std::max_align_t));
+
+    /// @brief Gets the current position of the arena.
+    Marker GetMarker() const { return { mCurrent, mOffset }; }
+
+    /// @brief Frees everything allocated after the given marker.
+    void Rewind(Marker marker);
+
+    /// @brief Frees everything, and merges the blocks if the arena had to grow.
+    void Reset();
+
+    /// @brief Gets the number of bytes currently allocated, including alignment padding.
+    UInt64 GetUsed() const;
+
+    /// @brief Gets the highest GetUsed() ever reached.
+    UInt64 GetPeak() const { return mPeak; }
+
+    /// @brief Gets the total size of every block owned by the arena.
+    UInt64 GetCapacity() const;
+private:
+    struct Block
+    {
+        UInt8* Memory = nullptr;
+        UInt64 Size = 0;
+    };
+
+    void AddBlock(UInt64 size);
+
+    Vector<Block> mBlocks;
+    UInt64 mBlockSize = 0;
+    UInt32 mCurrent = 0;
+    UInt64 mOffset = 0;
+    UInt64 mPeak = 0;
+};
+
+/// @brief Adapter letting STL containers allocate from an Arena.
+///
+/// Deallocation is a no-op, memory comes back when the arena is reset. Containers using it must
+/// not outlive the arena's next reset.
+template<typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    ArenaAllocator(Arena& arena)
+        : mArena(&arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other)
+        : mArena(other.GetArena()) {}
+
+    T* allocate(std::size_t count) { return static_cast<T*>(mArena->Allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T*, std::size_t) {}
+
+    Arena* GetArena() const { return mArena; }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return mArena == other.GetArena(); }
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return mArena != other.GetArena(); }
+private:
+    Arena* mArena;
+};
+
+/// @brief Vector allocating from an Arena.
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+/// @brief Per-frame transient memory.
+///
+/// There is one frame arena per frame in flight, reset when the renderer starts recording that
+/// frame, so anything allocated from Get() while recording lives until the frame slot comes
+/// around again. Only the thread recording the frame may allocate from it.
+class FrameArena
+{
+public:
+    /// @brief Creates the frame arenas.
+    static void Init();
+
+    /// @brief Destroys the frame arenas.
+    static void Exit();
+
+    /// @brief Resets the arena of a frame slot and makes it current.
+    /// @param frameIndex The frame in flight being recorded.
+    static void Begin(UInt32 frameIndex);
+
+    /// @brief Gets the arena of the frame being recorded.
+    static Arena& Get();
+private:
+    static struct Data {
+        Vector<Unique<Arena>> Frames; ///< One arena per frame in flight.
+        UInt32 Current = 0; ///< Index of the frame being recorded.
+    } sData;
+};
@@ -3,17 +3,26 @@
 // > Create Time: 2025-12-03 05:54:34
 //
 
+#if defined(_WIN32)
 #include <Windows.h>
+#else
+#include <csignal>
+#endif
 #include <sstream>
 
 #include <Core/Assert.hpp>
 #include <Core/Logger.hpp>
 
-void Assert::Check(bool condition, const String& fileName, const String& function, int line, const String& message)
+void Assert::Check(bool condition, const char* fileName, const char* function, int line, const String& message)
 {
     if (!condition) {
         LOG_CRITICAL("ASSERTION FAILED ({0}:{1} - line {2}): {3}", fileName, function, line, message);
+#if defined(_WIN32)
         MessageBoxA(nullptr, "Assertion Failed! Check output or log files. for details.", "MNEMEN", MB_OK | MB_ICONERROR);
         __debugbreak();
+#else
+        // Stops in an attached debugger, otherwise terminates with a core dump like __debugbreak would
+        std::raise(SIGTRAP);
+#endif
     }
 }
\ No newline at end of file
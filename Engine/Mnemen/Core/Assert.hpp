@@ -23,10 +23,13 @@ public:
     /// @param function The function where the assertion occurred.
     /// @param line The line number where the assertion occurred.
     /// @param message The error message to display if the condition is false.
-    static void Check(bool condition, const String& fileName, const String& function, int line, const String& message);
+    static void Check(bool condition, const char* fileName, const char* function, int line, const String& message);
 };
 
 /// @brief Macro for performing runtime assertions.
+///
+/// The message is only built once the condition fails, so a passing assertion never allocates.
+///
 /// @param cond The condition to evaluate.
 /// @param msg The message to display if the assertion fails.
-#define ASSERT(cond, msg) ::Assert::Check(cond, __FILE__, __FUNCTION__, __LINE__, msg)
\ No newline at end of file
+#define ASSERT(cond, msg) do { if (!(cond)) ::Assert::Check(false, __FILE__, __FUNCTION__, __LINE__, msg); } while (0)
\ No newline at end of file
@@ -0,0 +1,97 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-07 16:05:51
+//
+
+#include "Counters.hpp"
+
+#include <Core/Assert.hpp>
+
+#include <cstring>
+
+Counters::Data Counters::sData;
+
+static thread_local UInt32 sShard = UINT32_MAX;
+
+Counter::Counter(const char* name)
+    : mIndex(Counters::Register(name))
+{
+}
+
+void Counter::Add(UInt64 value)
+{
+    Counters::sData.Shards[Counters::GetShard()].Values[mIndex].fetch_add(value, std::memory_order_relaxed);
+}
+
+UInt64 Counter::GetFrameValue() const
+{
+    return Counters::GetFrameValue(mIndex);
+}
+
+UInt32 Counters::Register(const char* name)
+{
+    std::lock_guard<std::mutex> lock(sData.RegisterMutex);
+
+    UInt32 count = sData.Count.load(std::memory_order_relaxed);
+    for (UInt32 i = 0; i < count; i++) {
+        if (!strcmp(sData.Names[i], name))
+            return i;
+    }
+
+    ASSERT(count < MAX_COUNTERS, "Too many counters registered!");
+    sData.Names[count] = name;
+    sData.Count.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+UInt32 Counters::GetShard()
+{
+    // Threads past MAX_COUNTER_SHARDS share shards, which stays correct since adds are atomic.
+    if (sShard == UINT32_MAX)
+        sShard = sData.NextShard.fetch_add(1, std::memory_order_relaxed) % MAX_COUNTER_SHARDS;
+    return sShard;
+}
+
+void Counters::EndFrame()
+{
+    UInt32 count = sData.Count.load(std::memory_order_acquire);
+    for (UInt32 i = 0; i < count; i++) {
+        UInt64 total = GetTotal(i);
+        sData.FrameValues[i].store(total - sData.LastTotals[i], std::memory_order_relaxed);
+        sData.LastTotals[i] = total;
+    }
+}
+
+UInt32 Counters::GetCount()
+{
+    return sData.Count.load(std::memory_order_acquire);
+}
+
+const char* Counters::GetName(UInt32 index)
+{
+    return sData.Names[index];
+}
+
+UInt64 Counters::GetFrameValue(UInt32 index)
+{
+    return sData.FrameValues[index].load(std::memory_order_relaxed);
+}
+
+UInt64 Counters::GetFrameValue(const String& name)
+{
+    UInt32 count = GetCount();
+    for (UInt32 i = 0; i < count; i++) {
+        if (name == sData.Names[i])
+            return GetFrameValue(i);
+    }
+    return 0;
+}
+
+UInt64 Counters::GetTotal(UInt32 index)
+{
+    UInt64 total = 0;
+    for (const Shard& shard : sData.Shards) {
+        total += shard.Values[index].load(std::memory_order_relaxed);
+    }
+    return total;
+}
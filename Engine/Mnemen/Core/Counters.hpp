@@ -0,0 +1,105 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-07 15:42:18
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+#include <atomic>
+#include <mutex>
+
+constexpr UInt32 MAX_COUNTERS = 64; ///< Number of distinct counter names the registry can hold.
+constexpr UInt32 MAX_COUNTER_SHARDS = 32; ///< Number of per-thread shards each counter is split into.
+
+/// @brief Handle to a named counter of the registry.
+///
+/// Declare one as a static next to the code that counts, counters with the same name share the same
+/// value whichever translation unit they're declared in:
+///
+///     static Counter sDrawCalls("Draw Calls");
+///     sDrawCalls.Increment();
+///
+/// Adding is a relaxed atomic add on the calling thread's own shard, so it never contends with the
+/// other threads and never allocates.
+class Counter
+{
+public:
+    /// @brief Registers the counter, or finds it if the name is already registered.
+    /// @param name Name of the counter, a string with static storage.
+    Counter(const char* name);
+
+    /// @brief Adds a value to the counter for the current frame.
+    void Add(UInt64 value);
+
+    /// @brief Adds one to the counter for the current frame.
+    void Increment() { Add(1); }
+
+    /// @brief Gets the value the counter reached over the last finished frame.
+    UInt64 GetFrameValue() const;
+private:
+    UInt32 mIndex;
+};
+
+/// @brief Registry of named counters with per-frame values.
+///
+/// Each counter is split into per-thread shards that only ever grow. EndFrame() sums the shards and
+/// stores the difference with the previous sum as the value of the frame that just finished, so
+/// threads still counting while the frame ends are simply attributed to the next frame instead of
+/// being lost to a reset.
+class Counters
+{
+public:
+    /// @brief Closes the current frame, computing the per-frame value of every counter.
+    ///
+    /// Called once per frame by the application, after the render job of the previous frame is done.
+    static void EndFrame();
+
+    /// @brief Gets the number of registered counters.
+    static UInt32 GetCount();
+
+    /// @brief Gets the name of a counter.
+    /// @param index Index of the counter, below GetCount().
+    static const char* GetName(UInt32 index);
+
+    /// @brief Gets the value a counter reached over the last finished frame.
+    /// @param index Index of the counter, below GetCount().
+    static UInt64 GetFrameValue(UInt32 index);
+
+    /// @brief Gets the value a counter reached over the last finished frame.
+    /// @param name Name of the counter.
+    /// @return The value, or 0 if no counter has this name.
+    static UInt64 GetFrameValue(const String& name);
+
+    /// @brief Gets the sum of every value ever added to a counter.
+    /// @param index Index of the counter, below GetCount().
+    static UInt64 GetTotal(UInt32 index);
+private:
+    friend class Counter;
+
+    /// @brief Finds or registers a counter.
+    static UInt32 Register(const char* name);
+
+    /// @brief Gets the shard of the calling thread.
+    static UInt32 GetShard();
+
+    /// @brief Values of every counter for one thread, on its own cache lines.
+    struct alignas(64) Shard
+    {
+        Array<std::atomic<UInt64>, MAX_COUNTERS> Values;
+    };
+
+    // Constant-initialized, counters are registered by static constructors of other translation units.
+    static struct Data {
+        std::mutex RegisterMutex;
+        std::atomic<UInt32> Count = 0;
+        Array<const char*, MAX_COUNTERS> Names = {};
+
+        Array<Shard, MAX_COUNTER_SHARDS> Shards;
+        std::atomic<UInt32> NextShard = 0;
+
+        Array<UInt64, MAX_COUNTERS> LastTotals = {};
+        Array<std::atomic<UInt64>, MAX_COUNTERS> FrameValues;
+    } sData;
+};
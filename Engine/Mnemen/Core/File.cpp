@@ -11,7 +11,13 @@
 #include <fstream>
 #include <filesystem>
 
+#if defined(_WIN32)
 #include <Windows.h>
+#else
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 bool File::Exists(const String& path)
 {
@@ -29,6 +35,45 @@ bool File::IsDirectory(const String& path)
     return (statistics.st_mode & S_IFDIR) != 0;
 }
 
+String File::GetFileExtension(const String& path)
+{
+    std::filesystem::path fsPath(path);
+    return fsPath.extension().string();
+}
+
+void File::WriteString(const String& path, const String& str)
+{
+    std::ofstream stream(path);
+    if (!stream.is_open()) {
+        LOG_ERROR("Failed to write {0}", path);
+    }
+    stream << str;
+    stream.close();
+}
+
+nlohmann::json File::LoadJSON(const String& path)
+{
+    std::ifstream stream(path);
+    if (!stream.is_open()) {
+        LOG_ERROR("Failed to open JSON file {0}", path);
+        return {};
+    }
+    nlohmann::json root = nlohmann::json::parse(stream);
+    stream.close();
+    return root;
+}
+
+void File::WriteJSON(const nlohmann::json& json, const String& path)
+{
+    std::ofstream stream(path);
+    if (!stream.is_open()) {
+        LOG_ERROR("Failed to open JSON file {0} for writing!", path);
+    }
+    stream << json.dump(4) << std::endl;
+    stream.close();
+}
+
+#if defined(_WIN32)
 void File::CreateFileFromPath(const String& path)
 {
     HANDLE handle = CreateFileA(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
@@ -71,6 +116,15 @@ void File::Move(const String& oldPath, const String& newPath)
     }
 }
 
+bool File::Replace(const String& oldPath, const String& newPath)
+{
+    if (!MoveFileExA(oldPath.c_str(), newPath.c_str(), MOVEFILE_REPLACE_EXISTING)) {
+        LOG_ERROR("Failed to replace file {0} with {1}", newPath.c_str(), oldPath.c_str());
+        return false;
+    }
+    return true;
+}
+
 void File::Copy(const String& oldPath, const String& newPath, bool overwrite)
 {
     if (!Exists(oldPath)) {
@@ -83,12 +137,6 @@ void File::Copy(const String& oldPath, const String& newPath, bool overwrite)
     }
 }
 
-String File::GetFileExtension(const String& path)
-{
-    std::filesystem::path fsPath(path);
-    return fsPath.extension().string();
-}
-
 int File::GetFileSize(const String& path)
 {
     int result = 0;
@@ -162,16 +210,6 @@ void File::WriteBytes(const String& path, const void* data, UInt64 size)
     CloseHandle(handle);
 }
 
-void File::WriteString(const String& path, const String& str)
-{
-    std::ofstream stream(path);
-    if (!stream.is_open()) {
-        LOG_ERROR("Failed to write {0}", path);
-    }
-    stream << str;
-    stream.close();
-}
-
 File::Filetime File::GetLastModified(const String& path)
 {
     HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
@@ -184,25 +222,149 @@ File::Filetime File::GetLastModified(const String& path)
     result.Low = temp.dwLowDateTime;
     return result;
 }
+#else
+void File::CreateFileFromPath(const String& path)
+{
+    int handle = open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+    if (handle < 0) {
+        LOG_ERROR("Error when creating file {0}", path.c_str());
+        return;
+    }
+    LOG_INFO("Creating file {0}", path);
+    close(handle);
+}
 
-nlohmann::json File::LoadJSON(const String& path)
+void File::CreateDirectoryFromPath(const String& path)
 {
-    std::ifstream stream(path);
-    if (!stream.is_open()) {
-        LOG_ERROR("Failed to open JSON file {0}", path);
-        return {};
+    if (mkdir(path.c_str(), 0755) != 0) {
+        LOG_ERROR("Error when creating directory {0}", path.c_str());
     }
-    nlohmann::json root = nlohmann::json::parse(stream);
-    stream.close();
-    return root;
 }
 
-void File::WriteJSON(const nlohmann::json& json, const String& path)
+void File::Delete(const String& path)
 {
-    std::ofstream stream(path);
-    if (!stream.is_open()) {
-        LOG_ERROR("Failed to open JSON file {0} for writing!", path);
+    if (!Exists(path)) {
+        LOG_WARN("Trying to delete file {0} that doesn't exist!", path.c_str());
+        return;
     }
-    stream << json.dump(4) << std::endl;
-    stream.close();
+
+    if (unlink(path.c_str()) != 0) {
+        LOG_ERROR("Failed to delete file {0}", path.c_str());
+    }
+}
+
+void File::Move(const String& oldPath, const String& newPath)
+{
+    if (!Exists(oldPath)) {
+        LOG_WARN("Trying to move file {0} that doesn't exist!", oldPath.c_str());
+        return;
+    }
+
+    // MoveFileA refuses to replace an existing file, rename() would silently do it
+    if (Exists(newPath) || rename(oldPath.c_str(), newPath.c_str()) != 0) {
+        LOG_ERROR("Failed to move file {0} to {1}", oldPath.c_str(), newPath.c_str());
+    }
+}
+
+bool File::Replace(const String& oldPath, const String& newPath)
+{
+    if (rename(oldPath.c_str(), newPath.c_str()) != 0) {
+        LOG_ERROR("Failed to replace file {0} with {1}", newPath.c_str(), oldPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void File::Copy(const String& oldPath, const String& newPath, bool overwrite)
+{
+    if (!Exists(oldPath)) {
+        LOG_WARN("Trying to copy file {0} that doesn't exist!", oldPath.c_str());
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::copy_options options = overwrite ? std::filesystem::copy_options::overwrite_existing : std::filesystem::copy_options::none;
+    if (!std::filesystem::copy_file(oldPath, newPath, options, error)) {
+        LOG_ERROR("Failed to copy file {0} to {1}", oldPath.c_str(), newPath.c_str());
+    }
+}
+
+int File::GetFileSize(const String& path)
+{
+    struct stat statistics;
+    if (stat(path.c_str(), &statistics) == -1) {
+        LOG_ERROR("File {0} does not exist!", path.c_str());
+        return 0;
+    }
+    return static_cast<int>(statistics.st_size);
+}
+
+String File::ReadFile(const String& path)
+{
+    FILE* handle = fopen(path.c_str(), "rb");
+    if (!handle) {
+        LOG_ERROR("File {0} does not exist and cannot be read!", path);
+        return String("");
+    }
+    int size = File::GetFileSize(path);
+    if (size == 0) {
+        LOG_ERROR("File {0} has a size of 0, thus cannot be read!", path);
+        fclose(handle);
+        return String("");
+    }
+    String result(size, '\0');
+    result.resize(fread(result.data(), 1, size, handle));
+    fclose(handle);
+    return result;
+}
+
+void File::ReadBytes(const String& path, void *data, UInt64 size)
+{
+    FILE* handle = fopen(path.c_str(), "rb");
+    if (!handle) {
+        LOG_ERROR("File {0} does not exist and cannot be read!", path);
+        return;
+    }
+    fread(data, 1, size, handle);
+    fclose(handle);
+}
+
+void *File::ReadBytes(const String& path)
+{
+    FILE* handle = fopen(path.c_str(), "rb");
+    if (!handle) {
+        LOG_ERROR("File {0} does not exist and cannot be read!", path);
+        return nullptr;
+    }
+    int size = File::GetFileSize(path);
+    if (size == 0) {
+        LOG_ERROR("File {0} has a size of 0, thus cannot be read!", path);
+        fclose(handle);
+        return nullptr;
+    }
+    char *buffer = new char[size + 1];
+    fread(buffer, 1, size, handle);
+    fclose(handle);
+    return buffer;
+}
+
+void File::WriteBytes(const String& path, const void* data, UInt64 size)
+{
+    FILE* handle = fopen(path.c_str(), "wb");
+    ASSERT(handle, "Failed to create file for writing!");
+    fwrite(data, 1, size, handle);
+    fclose(handle);
+}
+
+File::Filetime File::GetLastModified(const String& path)
+{
+    // Only ever compared and hashed, the clock's own ticks are as good as Win32's 100ns intervals
+    std::error_code error;
+    UInt64 time = UInt64(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+
+    File::Filetime result;
+    result.High = UInt32(time >> 32);
+    result.Low = UInt32(time);
+    return result;
 }
+#endif
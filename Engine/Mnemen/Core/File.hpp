@@ -66,6 +66,12 @@ public:
     /// @param oldPath The old path of the file.
     /// @param newPath The new path of the file.
     static void Move(const String& oldPath, const String& newPath);
+
+    /// @brief Moves a file over another one in a single step, readers see either the old file or the new one.
+    /// @param oldPath The path of the file to move, usually a temporary file that was just written.
+    /// @param newPath The path of the file to replace. It doesn't have to exist.
+    /// @return True if the file was moved, otherwise false.
+    static bool Replace(const String& oldPath, const String& newPath);
     
     /// @brief Copies a file from oldPath to newPath.
     /// @param oldPath The old path of the file.
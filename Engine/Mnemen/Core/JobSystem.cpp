@@ -0,0 +1,240 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-02 14:11:12
+//
+
+#include "JobSystem.hpp"
+
+#include <Core/Logger.hpp>
+
+JobSystem::Data JobSystem::sData;
+
+static thread_local UInt32 sThreadIndex = UINT32_MAX;
+
+bool JobSystem::JobQueue::Push(Job* job)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Bottom - Top >= MAX_JOB_COUNT)
+        return false;
+    Jobs[Bottom % MAX_JOB_COUNT] = job;
+    Bottom++;
+    return true;
+}
+
+Job* JobSystem::JobQueue::Pop()
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Bottom == Top)
+        return nullptr;
+    Bottom--;
+    return Jobs[Bottom % MAX_JOB_COUNT];
+}
+
+Job* JobSystem::JobQueue::Steal()
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Bottom == Top)
+        return nullptr;
+    Job* job = Jobs[Top % MAX_JOB_COUNT];
+    Top++;
+    return job;
+}
+
+void JobSystem::Init(Int32 requestedWorkers)
+{
+    UInt32 workerCount = static_cast<UInt32>(std::max(requestedWorkers, 0));
+    if (requestedWorkers < 0) {
+        UInt32 hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    sData.Running = true;
+    sData.PendingJobs = 0;
+    sData.Contexts.resize(workerCount + 1);
+    for (UInt32 i = 0; i < workerCount + 1; i++) {
+        sData.Contexts[i] = MakeUnique<ThreadContext>();
+        sData.Contexts[i]->StealSeed = i * 2654435761u + 1;
+    }
+
+    sThreadIndex = 0;
+    for (UInt32 i = 0; i < workerCount; i++) {
+        sData.Threads.emplace_back(&JobSystem::WorkerLoop, i + 1);
+    }
+
+    LOG_INFO("Initialized job system with {0} worker threads", workerCount);
+}
+
+void JobSystem::Exit()
+{
+    {
+        std::lock_guard<std::mutex> lock(sData.WakeMutex);
+        sData.Running = false;
+    }
+    sData.WakeCondition.notify_all();
+
+    for (auto& thread : sData.Threads) {
+        thread.join();
+    }
+    sData.Threads.clear();
+    sData.Contexts.clear();
+}
+
+UInt32 JobSystem::GetThreadIndex()
+{
+    return sThreadIndex;
+}
+
+Job* JobSystem::CreateEmptyJob(Job* parent)
+{
+    Job* job = AllocateJob(parent);
+    job->Entry = nullptr;
+    return job;
+}
+
+Job* JobSystem::AllocateJob(Job* parent)
+{
+    ASSERT(sThreadIndex < sData.Contexts.size(), "Jobs can only be created from the main thread or a job system worker!");
+
+    ThreadContext* context = sData.Contexts[sThreadIndex].get();
+    Job* job = &context->Pool[context->PoolIndex++ % MAX_JOB_COUNT];
+    ASSERT(IsDone(job), "Job pool wrapped around onto a job that is still running!");
+
+    job->Parent = parent;
+    job->UnfinishedJobs.store(1, std::memory_order_relaxed);
+    if (parent) {
+        parent->UnfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+void JobSystem::Run(Job* job, JobPriority priority)
+{
+    ASSERT(sThreadIndex < sData.Contexts.size(), "Jobs can only be run from the main thread or a job system worker!");
+
+    if (!sData.Contexts[sThreadIndex]->Queues[(UInt64)priority].Push(job)) {
+        Execute(job);
+        return;
+    }
+    Notify();
+}
+
+void JobSystem::RunOnWorker(Job* job, JobPriority priority)
+{
+    // Without workers nobody would ever pull it from there
+    if (sData.Threads.empty() || !sData.WorkerQueues[(UInt64)priority].Push(job)) {
+        Run(job, priority);
+        return;
+    }
+    Notify();
+}
+
+void JobSystem::Notify()
+{
+    sData.PendingJobs.fetch_add(1, std::memory_order_release);
+
+    // Taking the lock makes sure a worker can't miss the wake up between checking for work and going to sleep.
+    {
+        std::lock_guard<std::mutex> lock(sData.WakeMutex);
+    }
+    sData.WakeCondition.notify_one();
+}
+
+void JobSystem::Wait(Job* job)
+{
+    while (!IsDone(job)) {
+        Job* next = GetJob();
+        if (next) {
+            Execute(next);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+Job* JobSystem::GetJob()
+{
+    for (UInt64 priority = 0; priority < (UInt64)JobPriority::MAX; priority++) {
+        Job* job = GetJob((JobPriority)priority);
+        if (job)
+            return job;
+    }
+    return nullptr;
+}
+
+Job* JobSystem::GetJob(JobPriority priority)
+{
+    ThreadContext* context = sData.Contexts[sThreadIndex].get();
+
+    Job* job = context->Queues[(UInt64)priority].Pop();
+    if (job) {
+        sData.PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    // Nothing left in our own queue. Workers pick up the jobs the main thread must leave alone first.
+    if (sThreadIndex != 0) {
+        job = sData.WorkerQueues[(UInt64)priority].Steal();
+        if (job) {
+            sData.PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // Then try stealing from someone else, starting at a random victim.
+    UInt32 contextCount = static_cast<UInt32>(sData.Contexts.size());
+    if (contextCount <= 1)
+        return nullptr;
+
+    context->StealSeed ^= context->StealSeed << 13;
+    context->StealSeed ^= context->StealSeed >> 17;
+    context->StealSeed ^= context->StealSeed << 5;
+    UInt32 start = context->StealSeed % contextCount;
+    for (UInt32 i = 0; i < contextCount; i++) {
+        UInt32 victim = (start + i) % contextCount;
+        if (victim == sThreadIndex)
+            continue;
+
+        job = sData.Contexts[victim]->Queues[(UInt64)priority].Steal();
+        if (job) {
+            sData.PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::Execute(Job* job)
+{
+    if (job->Entry) {
+        job->Entry(job->Data);
+    }
+    Finish(job);
+}
+
+void JobSystem::Finish(Job* job)
+{
+    Job* parent = job->Parent;
+    if (job->UnfinishedJobs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        if (parent) {
+            Finish(parent);
+        }
+    }
+}
+
+void JobSystem::WorkerLoop(UInt32 index)
+{
+    sThreadIndex = index;
+
+    while (sData.Running) {
+        Job* job = GetJob();
+        if (job) {
+            Execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sData.WakeMutex);
+        sData.WakeCondition.wait(lock, []() {
+            return sData.PendingJobs.load(std::memory_order_acquire) > 0 || !sData.Running;
+        });
+    }
+}
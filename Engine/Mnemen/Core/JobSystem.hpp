@@ -0,0 +1,203 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-02 14:11:05
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+#include <Core/Assert.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <new>
+#include <type_traits>
+#include <algorithm>
+
+/// @brief Number of jobs each thread can have in flight before its pool wraps around.
+constexpr UInt32 MAX_JOB_COUNT = 4096;
+
+/// @brief Size, in bytes, of the inline storage a job uses for its captured lambda.
+constexpr UInt32 JOB_DATA_SIZE = 96;
+
+/// @brief Upper bound on the number of batches a single ParallelFor will split into.
+constexpr UInt32 MAX_PARALLEL_FOR_BATCHES = 256;
+
+/// @brief Priority a job is queued with. Threads always drain high priority work first.
+enum class JobPriority
+{
+    High, ///< Work on the critical path of the frame (physics, culling...)
+    Normal, ///< Everything else
+    MAX
+};
+
+/// @brief A unit of work executed by the job system.
+///
+/// Jobs are allocated from a per-thread ring pool and never touch the heap. The callable
+/// is copied into the job's inline storage. A job is only considered finished once its own
+/// function and all of its children have run, which lets a single Wait() on a parent
+/// cover an entire tree of work.
+struct alignas(64) Job
+{
+    /// @brief Function pointer invoking (and destroying) the callable stored in Data.
+    using Function = void(*)(void* data);
+
+    Function Entry = nullptr; ///< Entry point of the job.
+    Job* Parent = nullptr; ///< Parent job, notified when this job and its children are done.
+    std::atomic<Int32> UnfinishedJobs = 0; ///< 1 for the job itself + 1 per unfinished child.
+    alignas(16) UInt8 Data[JOB_DATA_SIZE]; ///< Inline storage for the captured callable.
+};
+
+/// @brief Work-stealing job scheduler.
+///
+/// Every thread taking part in the job system (the main thread and each worker) owns a job
+/// pool and a double-ended queue. Owners push and pop at the back of their own queue, idle
+/// threads steal from the front of other queues. Threads waiting on a job never block: they
+/// keep executing pending jobs until the one they wait on completes.
+///
+/// Jobs may only be created and run from the thread that called Init() or from inside other jobs.
+class JobSystem
+{
+public:
+    /// @brief Starts the worker threads.
+    /// @param workerCount Number of worker threads to spawn. -1 picks one per hardware thread, minus the main thread.
+    static void Init(Int32 workerCount = -1);
+
+    /// @brief Stops and joins every worker thread.
+    static void Exit();
+
+    /// @brief Creates a job from a callable without scheduling it.
+    /// @param function The callable to execute. Must fit in JOB_DATA_SIZE bytes.
+    /// @param parent Optional parent job that will not complete before this one.
+    /// @return The created job.
+    template<typename Callable>
+    static Job* CreateJob(Callable&& function, Job* parent = nullptr)
+    {
+        using FunctionType = std::decay_t<Callable>;
+        static_assert(sizeof(FunctionType) <= JOB_DATA_SIZE, "Job callable is too large, capture by reference or pointer instead!");
+        static_assert(alignof(FunctionType) <= 16, "Job callable is over-aligned!");
+
+        Job* job = AllocateJob(parent);
+        new (job->Data) FunctionType(std::forward<Callable>(function));
+        job->Entry = [](void* data) {
+            FunctionType* fn = reinterpret_cast<FunctionType*>(data);
+            (*fn)();
+            fn->~FunctionType();
+        };
+        return job;
+    }
+
+    /// @brief Creates a job that does nothing, used as a parent to group other jobs.
+    /// @param parent Optional parent job.
+    /// @return The created job.
+    static Job* CreateEmptyJob(Job* parent = nullptr);
+
+    /// @brief Pushes a job in the calling thread's queue. If the queue is full the job is executed immediately.
+    /// @param job The job to schedule.
+    /// @param priority The queue to push the job in.
+    static void Run(Job* job, JobPriority priority = JobPriority::Normal);
+
+    /// @brief Pushes a job in a queue only worker threads pull from, so the main thread never ends up running it
+    /// while it waits on something else. Meant for long jobs overlapping the main thread, like recording a frame.
+    /// Without workers this is the same as Run().
+    /// @param job The job to schedule.
+    /// @param priority The queue to push the job in.
+    static void RunOnWorker(Job* job, JobPriority priority = JobPriority::Normal);
+
+    /// @brief Executes pending jobs on the calling thread until the given job is complete.
+    /// @param job The job to wait on.
+    static void Wait(Job* job);
+
+    /// @brief Checks whether a job and all of its children have completed.
+    /// @param job The job to check.
+    /// @return True if the job is done.
+    static bool IsDone(const Job* job) { return job->UnfinishedJobs.load(std::memory_order_acquire) == 0; }
+
+    /// @brief Runs a function over [0, count) split in batches across every thread, then waits.
+    /// @param count Number of iterations.
+    /// @param batchSize Minimum number of iterations processed by a single job.
+    /// @param function Callable invoked as function(index).
+    /// @param priority Priority of the batches.
+    template<typename Callable>
+    static void ParallelFor(UInt32 count, UInt32 batchSize, const Callable& function, JobPriority priority = JobPriority::Normal)
+    {
+        if (count == 0)
+            return;
+        if (batchSize == 0)
+            batchSize = 1;
+        if (sData.Threads.empty() || count <= batchSize) {
+            for (UInt32 i = 0; i < count; i++)
+                function(i);
+            return;
+        }
+
+        UInt32 batchCount = (count + batchSize - 1) / batchSize;
+        if (batchCount > MAX_PARALLEL_FOR_BATCHES) {
+            batchSize = (count + MAX_PARALLEL_FOR_BATCHES - 1) / MAX_PARALLEL_FOR_BATCHES;
+            batchCount = (count + batchSize - 1) / batchSize;
+        }
+
+        // The callable outlives every batch since we wait below, so batches only keep a pointer to it.
+        const Callable* callable = &function;
+        Job* root = CreateEmptyJob();
+        for (UInt32 batch = 0; batch < batchCount; batch++) {
+            UInt32 begin = batch * batchSize;
+            UInt32 end = std::min(begin + batchSize, count);
+            Run(CreateJob([callable, begin, end]() {
+                for (UInt32 i = begin; i < end; i++)
+                    (*callable)(i);
+            }, root), priority);
+        }
+        Run(root);
+        Wait(root);
+    }
+
+    /// @brief Gets the number of threads executing jobs, including the main thread.
+    static UInt32 GetThreadCount() { return static_cast<UInt32>(sData.Threads.size()) + 1; }
+
+    /// @brief Gets the job system index of the calling thread. 0 is the main thread.
+    static UInt32 GetThreadIndex();
+private:
+    /// @brief Double-ended job queue owned by a single thread.
+    struct JobQueue
+    {
+        std::mutex Mutex;
+        Array<Job*, MAX_JOB_COUNT> Jobs;
+        UInt64 Bottom = 0; ///< Next slot the owner pushes to.
+        UInt64 Top = 0; ///< Next slot thieves steal from.
+
+        bool Push(Job* job);
+        Job* Pop();
+        Job* Steal();
+    };
+
+    /// @brief Per-thread state: the job pool and one job queue per priority.
+    struct ThreadContext
+    {
+        Array<Job, MAX_JOB_COUNT> Pool;
+        UInt32 PoolIndex = 0;
+        Array<JobQueue, (UInt64)JobPriority::MAX> Queues;
+        UInt32 StealSeed = 0;
+    };
+
+    static Job* AllocateJob(Job* parent);
+    static Job* GetJob();
+    static Job* GetJob(JobPriority priority);
+    static void Execute(Job* job);
+    static void Finish(Job* job);
+    static void Notify();
+    static void WorkerLoop(UInt32 index);
+
+    static struct Data {
+        Vector<Unique<ThreadContext>> Contexts; ///< One per thread, index 0 is the main thread.
+        Vector<std::thread> Threads; ///< Worker threads.
+        Array<JobQueue, (UInt64)JobPriority::MAX> WorkerQueues; ///< Jobs only workers pull from, see RunOnWorker().
+
+        std::atomic<bool> Running = false;
+        std::atomic<Int32> PendingJobs = 0; ///< Jobs sitting in a queue, used to put idle workers to sleep.
+        std::mutex WakeMutex;
+        std::condition_variable WakeCondition;
+    } sData;
+};
@@ -15,6 +15,7 @@
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include <mutex>
 
 Ref<spdlog::logger> Logger::sLogger;
 Vector<Logger::LogEntry> Logger::sEntries;
@@ -60,6 +61,7 @@ public:
 
         // Convert the log message to a string and store it in the vector
         String log_message = fmt::format("{} [{}] {}", time_stream.str(), spdlog::level::to_string_view(msg.level), msg.payload);
+        std::lock_guard<std::mutex> lock(mMutex); // Jobs log from worker threads
         Logger::sEntries.push_back({ log_message, LevelToColor(msg.level) });
     }
 
@@ -86,11 +88,18 @@ public:
     ///
     /// @param sink_formatter A unique pointer to the formatter to set.
     void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override {}
+
+private:
+    std::mutex mMutex; ///< Guards Logger::sEntries.
 };
 
 
 void Logger::Init()
 {
+    // Tools that spin up several applications in a row (benchmarks) keep the first logger.
+    if (sLogger)
+        return;
+
     Vector<spdlog::sink_ptr> logSinks;
     logSinks.emplace_back(MakeRef<spdlog::sinks::stdout_color_sink_mt>());
     logSinks.emplace_back(MakeRef<spdlog::sinks::basic_file_sink_mt>("mnemen.log", true));
@@ -0,0 +1,121 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-10 09:20:03
+//
+
+#include <Core/MappedFile.hpp>
+#include <Core/Logger.hpp>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::Open(const String& path)
+{
+    Close();
+
+    // Sharing delete lets the cook move a fresh file over one that is still mapped, the mapping keeps the old contents
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR("Failed to open {0} for mapping", path);
+        return false;
+    }
+
+    LARGE_INTEGER size = {};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        LOG_ERROR("Cannot map empty file {0}", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        LOG_ERROR("Failed to create file mapping for {0}", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        LOG_ERROR("Failed to map {0}", path);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mFile = file;
+    mMapping = mapping;
+    mData = reinterpret_cast<const UInt8*>(view);
+    mSize = UInt64(size.QuadPart);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (mData) {
+        UnmapViewOfFile(mData);
+    }
+    if (mMapping) {
+        CloseHandle(mMapping);
+    }
+    if (mFile) {
+        CloseHandle(mFile);
+    }
+    mFile = nullptr;
+    mMapping = nullptr;
+    mData = nullptr;
+    mSize = 0;
+}
+#else
+bool MappedFile::Open(const String& path)
+{
+    Close();
+
+    int file = open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        LOG_ERROR("Failed to open {0} for mapping", path);
+        return false;
+    }
+
+    struct stat statistics;
+    if (fstat(file, &statistics) != 0 || statistics.st_size == 0) {
+        LOG_ERROR("Cannot map empty file {0}", path);
+        close(file);
+        return false;
+    }
+
+    // The mapping keeps its own reference to the file, the descriptor isn't needed past this point
+    void* view = mmap(nullptr, size_t(statistics.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (view == MAP_FAILED) {
+        LOG_ERROR("Failed to map {0}", path);
+        return false;
+    }
+    posix_madvise(view, size_t(statistics.st_size), POSIX_MADV_RANDOM);
+
+    mData = reinterpret_cast<const UInt8*>(view);
+    mSize = UInt64(statistics.st_size);
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (mData) {
+        munmap(const_cast<UInt8*>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0;
+}
+#endif
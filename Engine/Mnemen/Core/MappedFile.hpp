@@ -0,0 +1,44 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-10 09:12:44
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+/// @brief A read-only view of a whole file mapped in the address space.
+///
+/// Pages are loaded by the OS on first access and shared with the file cache, so reading from the
+/// mapping costs no system call and no copy into a buffer of our own.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @brief Maps a file, unmapping the previous one.
+    /// @param path The path of the file.
+    /// @return Whether the file could be mapped.
+    bool Open(const String& path);
+
+    /// @brief Unmaps the file.
+    void Close();
+
+    /// @brief Returns whether a file is mapped.
+    bool IsOpen() const { return mData != nullptr; }
+
+    /// @brief Gets the start of the mapping.
+    const UInt8* GetData() const { return mData; }
+
+    /// @brief Gets the size of the mapped file, in bytes.
+    UInt64 GetSize() const { return mSize; }
+private:
+    void* mFile = nullptr; ///< Win32 file handle, unused on POSIX where the mapping outlives the descriptor.
+    void* mMapping = nullptr; ///< Win32 file mapping handle, unused on POSIX.
+    const UInt8* mData = nullptr;
+    UInt64 mSize = 0;
+};
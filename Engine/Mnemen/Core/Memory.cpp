@@ -0,0 +1,245 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-07 10:31:05
+//
+
+#include "Memory.hpp"
+
+#include <Core/Counters.hpp>
+
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+/// @brief Stored right before every tracked block.
+struct AllocationHeader
+{
+    UInt64 Size; ///< Size requested by the caller.
+    UInt32 Offset; ///< Distance from the start of the malloc'd block to the user pointer.
+    UInt8 Tag; ///< MemoryTag of the allocation.
+    UInt8 AlignmentShift; ///< Log2 of the alignment of the allocation.
+    UInt16 Pad;
+};
+static_assert(sizeof(AllocationHeader) == 16, "The allocation header must keep 16-byte alignment!");
+
+// Constant-initialized, the global operator new can run before any dynamic initializer.
+Memory::Data Memory::sData;
+
+static thread_local MemoryTag sCurrentTag = MemoryTag::General;
+static thread_local MemoryAllocationCount sThreadAllocations;
+
+static Counter sFrameAllocations("Heap Allocations");
+static Counter sFrameAllocatedBytes("Heap Allocated Bytes");
+
+void* Memory::Allocate(UInt64 size, MemoryTag tag, UInt64 alignment)
+{
+    alignment = std::max<UInt64>(alignment, sizeof(AllocationHeader));
+
+    // malloc returns 16-byte aligned memory, so aligning past the header never needs more than alignment extra bytes.
+    UInt8* raw = static_cast<UInt8*>(std::malloc(size + alignment));
+    if (!raw)
+        return nullptr;
+
+    UInt64 address = reinterpret_cast<UInt64>(raw) + sizeof(AllocationHeader);
+    address = (address + alignment - 1) & ~(alignment - 1);
+    UInt8* user = reinterpret_cast<UInt8*>(address);
+
+    AllocationHeader* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+    header->Size = size;
+    header->Offset = static_cast<UInt32>(user - raw);
+    header->Tag = static_cast<UInt8>(tag);
+    header->AlignmentShift = static_cast<UInt8>(std::countr_zero(alignment));
+
+    TagCounters& counters = sData.Tags[(UInt32)tag];
+    UInt64 live = counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    counters.LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.TotalBytes.fetch_add(size, std::memory_order_relaxed);
+
+    sThreadAllocations.Allocations++;
+    sThreadAllocations.Bytes += size;
+
+    UInt64 peak = counters.PeakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+
+    return user;
+}
+
+void* Memory::Reallocate(void* ptr, UInt64 size, MemoryTag tag)
+{
+    if (!ptr)
+        return Allocate(size, tag);
+
+    AllocationHeader* header = static_cast<AllocationHeader*>(ptr) - 1;
+    void* result = Allocate(size, static_cast<MemoryTag>(header->Tag), 1ull << header->AlignmentShift);
+    if (!result)
+        return nullptr;
+
+    std::memcpy(result, ptr, std::min(size, header->Size));
+    Free(ptr);
+    return result;
+}
+
+void Memory::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    AllocationHeader* header = static_cast<AllocationHeader*>(ptr) - 1;
+    TagCounters& counters = sData.Tags[header->Tag];
+    counters.LiveBytes.fetch_sub(header->Size, std::memory_order_relaxed);
+    counters.LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+
+    std::free(static_cast<UInt8*>(ptr) - header->Offset);
+}
+
+MemoryTag Memory::GetCurrentTag()
+{
+    return sCurrentTag;
+}
+
+MemoryTagStats Memory::GetTagStats(MemoryTag tag)
+{
+    const TagCounters& counters = sData.Tags[(UInt32)tag];
+
+    MemoryTagStats stats;
+    stats.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+    stats.LiveAllocations = counters.LiveAllocations.load(std::memory_order_relaxed);
+    stats.TotalAllocations = counters.TotalAllocations.load(std::memory_order_relaxed);
+    stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+    stats.TotalBytes = counters.TotalBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+UInt64 Memory::GetTotalLiveBytes()
+{
+    UInt64 total = 0;
+    for (const TagCounters& counters : sData.Tags) {
+        total += counters.LiveBytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+const char* Memory::GetTagName(MemoryTag tag)
+{
+    switch (tag) {
+        case MemoryTag::General: return "General";
+        case MemoryTag::Asset: return "Asset";
+        case MemoryTag::Mesh: return "Mesh";
+        case MemoryTag::Physics: return "Physics";
+        case MemoryTag::Script: return "Script";
+        case MemoryTag::Audio: return "Audio";
+        case MemoryTag::Renderer: return "Renderer";
+        case MemoryTag::ECS: return "ECS";
+        default: return "Unknown";
+    }
+}
+
+void Memory::ResetPeaks()
+{
+    for (TagCounters& counters : sData.Tags) {
+        counters.PeakBytes.store(counters.LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+MemoryAllocationCount Memory::GetTotalAllocations()
+{
+    MemoryAllocationCount total;
+    for (const TagCounters& counters : sData.Tags) {
+        total.Allocations += counters.TotalAllocations.load(std::memory_order_relaxed);
+        total.Bytes += counters.TotalBytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+MemoryAllocationCount Memory::GetThreadAllocations()
+{
+    return sThreadAllocations;
+}
+
+void Memory::EndFrame()
+{
+    MemoryAllocationCount total = GetTotalAllocations();
+    sFrameAllocations.Add(total.Allocations - sData.LastTotal.Allocations);
+    sFrameAllocatedBytes.Add(total.Bytes - sData.LastTotal.Bytes);
+    sData.LastTotal = total;
+}
+
+MemoryScope::MemoryScope(MemoryTag tag)
+    : mPrevious(sCurrentTag)
+{
+    sCurrentTag = tag;
+}
+
+MemoryScope::~MemoryScope()
+{
+    sCurrentTag = mPrevious;
+}
+
+// Global operator new and delete, every C++ allocation of the engine goes through the tracker.
+
+void* operator new(std::size_t size)
+{
+    void* ptr = Memory::Allocate(size, Memory::GetCurrentTag());
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* ptr = Memory::Allocate(size, Memory::GetCurrentTag());
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    void* ptr = Memory::Allocate(size, Memory::GetCurrentTag(), static_cast<UInt64>(alignment));
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    void* ptr = Memory::Allocate(size, Memory::GetCurrentTag(), static_cast<UInt64>(alignment));
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Memory::Allocate(size, Memory::GetCurrentTag());
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Memory::Allocate(size, Memory::GetCurrentTag());
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Memory::Allocate(size, Memory::GetCurrentTag(), static_cast<UInt64>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return Memory::Allocate(size, Memory::GetCurrentTag(), static_cast<UInt64>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { Memory::Free(ptr); }
+void operator delete[](void* ptr) noexcept { Memory::Free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { Memory::Free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { Memory::Free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { Memory::Free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { Memory::Free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { Memory::Free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { Memory::Free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { Memory::Free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { Memory::Free(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { Memory::Free(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { Memory::Free(ptr); }
@@ -0,0 +1,124 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-07 10:12:44
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+#include <atomic>
+
+/// @brief Subsystem an allocation is attributed to.
+enum class MemoryTag : UInt8
+{
+    General,
+    Asset,
+    Mesh,
+    Physics,
+    Script,
+    Audio,
+    Renderer,
+    ECS,
+    MAX
+};
+
+/// @brief Memory usage of a tag.
+struct MemoryTagStats
+{
+    UInt64 LiveBytes = 0; ///< Bytes currently allocated.
+    UInt64 LiveAllocations = 0; ///< Allocations not freed yet.
+    UInt64 TotalAllocations = 0; ///< Allocations ever made.
+    UInt64 PeakBytes = 0; ///< Highest LiveBytes reached.
+    UInt64 TotalBytes = 0; ///< Bytes ever allocated.
+};
+
+/// @brief A number of allocations and the bytes they requested.
+struct MemoryAllocationCount
+{
+    UInt64 Allocations = 0; ///< Number of allocations.
+    UInt64 Bytes = 0; ///< Bytes requested by the allocations.
+};
+
+/// @brief Tracking allocator attributing every heap allocation to a MemoryTag.
+///
+/// The global operator new and delete go through it, using the tag set by the innermost MemoryScope
+/// of the calling thread. Third-party libraries with allocation hooks (Jolt, Lua, miniaudio) call it
+/// directly with their own tag. Each block carries a small header holding its size and tag, so frees
+/// are attributed correctly whichever thread or scope they happen in.
+class Memory
+{
+public:
+    /// @brief Allocates tracked memory.
+    /// @param size Size of the allocation, in bytes.
+    /// @param tag Subsystem the allocation belongs to.
+    /// @param alignment Alignment of the allocation, a power of two.
+    /// @return The allocated memory, or nullptr if the system is out of memory.
+    static void* Allocate(UInt64 size, MemoryTag tag, UInt64 alignment = 16);
+
+    /// @brief Resizes tracked memory, keeping its tag and alignment. A null pointer allocates.
+    /// @param ptr Memory returned by Allocate or Reallocate.
+    /// @param size New size of the allocation, in bytes.
+    /// @param tag Tag used if ptr is null.
+    static void* Reallocate(void* ptr, UInt64 size, MemoryTag tag);
+
+    /// @brief Frees memory returned by Allocate or Reallocate. Null pointers are ignored.
+    static void Free(void* ptr);
+
+    /// @brief Gets the tag new allocations of the calling thread are attributed to.
+    static MemoryTag GetCurrentTag();
+
+    /// @brief Gets the usage of a tag.
+    static MemoryTagStats GetTagStats(MemoryTag tag);
+
+    /// @brief Gets the number of bytes currently allocated across every tag.
+    static UInt64 GetTotalLiveBytes();
+
+    /// @brief Gets the display name of a tag.
+    static const char* GetTagName(MemoryTag tag);
+
+    /// @brief Resets the high-water marks to the current usage.
+    static void ResetPeaks();
+
+    /// @brief Gets the allocations ever made across every tag and thread.
+    static MemoryAllocationCount GetTotalAllocations();
+
+    /// @brief Gets the allocations ever made by the calling thread. Cheap enough to call around every profiler scope.
+    static MemoryAllocationCount GetThreadAllocations();
+
+    /// @brief Publishes the allocations made since the last call to the "Heap Allocations" and "Heap Allocated Bytes" counters.
+    ///
+    /// Called once per frame by the application, right before Counters::EndFrame().
+    static void EndFrame();
+private:
+    friend class MemoryScope;
+
+    /// Every thread hits the counters of the tag it allocates under, each tag gets its own cache line so
+    /// threads working under different tags don't bounce a shared one.
+    struct alignas(64) TagCounters
+    {
+        std::atomic<UInt64> LiveBytes = 0;
+        std::atomic<UInt64> LiveAllocations = 0;
+        std::atomic<UInt64> TotalAllocations = 0;
+        std::atomic<UInt64> PeakBytes = 0;
+        std::atomic<UInt64> TotalBytes = 0;
+    };
+
+    static struct Data {
+        Array<TagCounters, (UInt32)MemoryTag::MAX> Tags;
+        MemoryAllocationCount LastTotal; ///< Totals at the last EndFrame.
+    } sData;
+};
+
+/// @brief Attributes the allocations made by the calling thread to a tag until the scope ends.
+class MemoryScope
+{
+public:
+    MemoryScope(MemoryTag tag);
+    ~MemoryScope();
+
+    MemoryScope(const MemoryScope&) = delete;
+    MemoryScope& operator=(const MemoryScope&) = delete;
+private:
+    MemoryTag mPrevious;
+};
@@ -7,36 +7,83 @@
 
 #include <RHI/Uploader.hpp>
 #include <Core/Statistics.hpp>
+#include <Core/JobSystem.hpp>
+#include <Core/Logger.hpp>
+#include <Core/Memory.hpp>
+#include <Core/Counters.hpp>
+#include <Core/File.hpp>
 
 #include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <thread>
 #include <imgui.h>
 #include <FontAwesome/FontAwesome.hpp>
 
 Profiler::Data Profiler::sData = {};
 
-// ProfilerEntry constructor
-ProfilerEntry::ProfilerEntry(const String& name)
-    : mName(name), mFrame(Profiler::sData.CurrentFrame)
+static thread_local ProfilerThread* sThread = nullptr;
+static Counter sSkippedHitches("Skipped Hitches");
+static const std::chrono::steady_clock::time_point sEpoch = std::chrono::steady_clock::now();
+
+ProfilerScope::ProfilerScope(const char* name)
 {
-    mTimer.Restart();
+    Open(name);
 }
 
-ProfilerEntry::ProfilerEntry(const String& name, CommandBuffer::Ref commandBuffer)
-    : mName(name), mFrame(Profiler::sData.CurrentFrame)
+ProfilerScope::ProfilerScope(const char* name, CommandBuffer::Ref commandBuffer)
+    : mCommandBuffer(commandBuffer)
 {
-    mGPU = true;
     mTimerIndex = Profiler::StartGPUTimer(commandBuffer);
-    mCommandBuffer = commandBuffer;
+    Open(name);
+}
+
+void ProfilerScope::Open(const char* name)
+{
+    mThread = Profiler::GetThread();
+    mName = name;
+    mID = ++mThread->NextID;
+    mDepth = mThread->Depth;
+    mParent = mDepth > 0 ? mThread->Stack[std::min(mDepth, MAX_PROFILER_DEPTH) - 1] : 0;
+    if (mDepth < MAX_PROFILER_DEPTH)
+        mThread->Stack[mDepth] = mID;
+    mThread->Depth++;
+    mAllocations = Memory::GetThreadAllocations();
+    mFrame = Profiler::GetFrame();
+    mStart = Profiler::Now();
 }
 
-// Destructor automatically records elapsed time and pushes the entry
-ProfilerEntry::~ProfilerEntry()
+// Destructor records the end time and pushes the event in the thread's ring
+ProfilerScope::~ProfilerScope()
 {
-    mCPUTime = mTimer.GetElapsed();
-    if (mGPU) {
+    UInt64 end = Profiler::Now();
+    MemoryAllocationCount allocations = Memory::GetThreadAllocations();
+    if (mCommandBuffer) {
         Profiler::StopGPUTimer(mCommandBuffer, mTimerIndex);
     }
-    Profiler::PushEntry(*this);
+    mThread->Depth--;
+
+    UInt64 head = mThread->Head.load(std::memory_order_relaxed);
+    if (head - mThread->Tail.load(std::memory_order_acquire) >= MAX_PROFILER_EVENTS) {
+        mThread->Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ProfilerEvent& event = mThread->Events[head % MAX_PROFILER_EVENTS];
+    event.Name = mName;
+    event.Start = mStart;
+    event.End = end;
+    event.Frame = mFrame;
+    event.ID = mID;
+    event.Parent = mParent;
+    event.Depth = mDepth;
+    event.Thread = mThread->Index;
+    event.Allocations = static_cast<UInt32>(allocations.Allocations - mAllocations.Allocations);
+    event.AllocatedBytes = allocations.Bytes - mAllocations.Bytes;
+    mThread->Head.store(head + 1, std::memory_order_release);
 }
 
 void Profiler::Init(RHI::Ref rhi)
@@ -46,37 +93,452 @@ void Profiler::Init(RHI::Ref rhi)
 
 void Profiler::Exit()
 {
-    sData.EntryCount = 0;
-    sData.Resources.clear();
+    // A hitch dump might still be written by a worker.
+    while (sData.HitchWriting.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+
+    // Threads stay registered, their thread_local pointers still point at their rings.
+    sData.Events.clear();
+    {
+        std::lock_guard<std::mutex> lock(sData.ResourceMutex);
+        sData.Resources.clear();
+    }
     GPUTimer::Exit();
 }
 
-// BeginFrame: Move to next frame
+// BeginFrame: Move to next frame and drain every thread's ring
 void Profiler::BeginFrame()
 {
-    sData.CurrentFrame++;
+    sData.CurrentFrame.fetch_add(1, std::memory_order_relaxed);
+    sData.Collected.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(sData.ThreadMutex);
+        for (auto& thread : sData.Threads) {
+            UInt64 tail = thread->Tail.load(std::memory_order_relaxed);
+            UInt64 head = thread->Head.load(std::memory_order_acquire);
+            for (UInt64 i = tail; i < head; i++) {
+                sData.Collected.push_back(thread->Events[i % MAX_PROFILER_EVENTS]);
+            }
+            thread->Tail.store(head, std::memory_order_release);
+        }
+    }
+
+    bool captureDone = false;
+    {
+        std::lock_guard<std::mutex> lock(sData.CaptureMutex);
+        if (sData.Capturing) {
+            sData.CaptureEvents.insert(sData.CaptureEvents.end(), sData.Collected.begin(), sData.Collected.end());
+            captureDone = --sData.CaptureFramesLeft == 0;
+        }
+    }
+    if (captureDone) {
+        WriteCapture();
+    }
+
+    float frameTime = UpdateStats();
+    UpdateHitches(frameTime);
+
+    std::lock_guard<std::mutex> lock(sData.EventMutex);
+    sData.Events.swap(sData.Collected);
+}
+
+void ProfilerHistory::Push(float sample)
+{
+    Samples[SampleCount % PROFILER_HISTORY_SIZE] = sample;
+    SampleCount++;
+}
+
+ProfilerStats ProfilerHistory::GetStats() const
+{
+    ProfilerStats stats = {};
+    UInt32 count = static_cast<UInt32>(std::min<UInt64>(SampleCount, PROFILER_HISTORY_SIZE));
+    if (count == 0)
+        return stats;
+
+    Array<float, PROFILER_HISTORY_SIZE> sorted;
+    std::copy(Samples.begin(), Samples.begin() + count, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + count);
+
+    // Nearest-rank percentiles
+    auto percentile = [&](float p) {
+        UInt32 rank = static_cast<UInt32>(std::ceil(p * count));
+        return sorted[std::clamp(rank, 1u, count) - 1];
+    };
+
+    float sum = 0.0f;
+    for (UInt32 i = 0; i < count; i++) {
+        sum += sorted[i];
+    }
+
+    stats.Last = Samples[(SampleCount - 1) % PROFILER_HISTORY_SIZE];
+    stats.Min = sorted[0];
+    stats.Avg = sum / count;
+    stats.Max = sorted[count - 1];
+    stats.P95 = percentile(0.95f);
+    stats.P99 = percentile(0.99f);
+    stats.SampleCount = count;
+    stats.Allocations = LastAllocations.Allocations;
+    stats.AllocatedBytes = LastAllocations.Bytes;
+    return stats;
+}
+
+float Profiler::UpdateStats()
+{
+    std::lock_guard<std::mutex> lock(sData.StatsMutex);
+
+    UInt64 now = Now();
+    float frameTime = 0.0f;
+    if (sData.LastFrameStart != 0) {
+        frameTime = (now - sData.LastFrameStart) / 1'000'000.0f;
+        sData.FrameTimes.Push(frameTime);
+    }
+    sData.LastFrameStart = now;
+
+    for (const ProfilerEvent& event : sData.Collected) {
+        auto it = sData.ScopeLookup.find(event.Name);
+        UInt32 index = 0;
+        if (it != sData.ScopeLookup.end()) {
+            index = it->second;
+        } else {
+            // Identical names from different translation units can have different addresses, merge them by value.
+            auto [nameIt, inserted] = sData.ScopeIndices.try_emplace(event.Name, static_cast<UInt32>(sData.Scopes.size()));
+            if (inserted) {
+                sData.Scopes.emplace_back().Name = event.Name;
+            }
+            index = nameIt->second;
+            sData.ScopeLookup[event.Name] = index;
+        }
+
+        // Sum every run of the scope in a frame, and push the total once events of a later frame show up.
+        ProfilerHistory& history = sData.Scopes[index];
+        if (history.PendingFrame != event.Frame) {
+            if (history.PendingFrame != UINT64_MAX) {
+                history.Push(history.Pending);
+                history.LastAllocations = history.PendingAllocations;
+            }
+            history.PendingFrame = event.Frame;
+            history.Pending = 0.0f;
+            history.PendingAllocations = {};
+        }
+        history.Pending += event.GetTime();
+        history.PendingAllocations.Allocations += event.Allocations;
+        history.PendingAllocations.Bytes += event.AllocatedBytes;
+    }
+    return frameTime;
+}
+
+void Profiler::SetHitchBudget(float budget)
+{
+    sData.HitchBudget = std::max(budget, 0.0f);
+}
+
+void Profiler::UpdateHitches(float frameTime)
+{
+    if (sData.HitchBudget <= 0.0f)
+        return;
+
+    // Slots are reused, so once the ring went around this doesn't allocate.
+    ProfilerHitchFrame& slot = sData.HitchFrames[sData.HitchFrameCount % PROFILER_HITCH_FRAMES];
+    slot.Frame = GetFrame() - 1;
+    slot.Time = frameTime;
+    slot.Events.assign(sData.Collected.begin(), sData.Collected.end());
+    slot.Counters.swap(sData.HitchCounters);
+    sData.HitchCounters.clear();
+    sData.HitchFrameCount++;
+
+    if (frameTime <= sData.HitchBudget)
+        return;
+    // Dumps are at least PROFILER_HITCH_FRAMES apart, the hitches in between are only reported
+    if (sData.HitchFrameCount < sData.HitchCooldown || sData.HitchWriting.exchange(true, std::memory_order_acq_rel)) {
+        LOG_WARN("Frame {0} took {1:.2f}ms (budget {2:.2f}ms), too close to the last hitch to be dumped", slot.Frame, frameTime, sData.HitchBudget);
+        sSkippedHitches.Increment();
+        return;
+    }
+    sData.HitchCooldown = sData.HitchFrameCount + PROFILER_HITCH_FRAMES;
+
+    LOG_WARN("Frame {0} took {1:.2f}ms (budget {2:.2f}ms), dumping the last {3} frames", slot.Frame, frameTime, sData.HitchBudget, PROFILER_HITCH_FRAMES);
+
+    // Copy the ring oldest first and write it on its own thread: the frame already blew its budget,
+    // and a long file write shouldn't hold a job system worker either.
+    Vector<ProfilerHitchFrame> frames;
+    frames.reserve(PROFILER_HITCH_FRAMES);
+    for (UInt64 i = sData.HitchFrameCount - PROFILER_HITCH_FRAMES; i < sData.HitchFrameCount; i++) {
+        frames.push_back(sData.HitchFrames[i % PROFILER_HITCH_FRAMES]);
+    }
+    std::thread([frames = std::move(frames)]() {
+        WriteHitch(frames);
+        sData.HitchWriting.store(false, std::memory_order_release);
+    }).detach();
+}
+
+void Profiler::WriteHitch(const Vector<ProfilerHitchFrame>& frames)
+{
+    const ProfilerHitchFrame& hitch = frames.back();
+    String base = "Hitches/Hitch_" + std::to_string(hitch.Frame);
+    File::CreateDirectoryFromPath("Hitches");
+
+    Vector<ProfilerEvent> events;
+    Vector<ProfilerCounterSample> counters;
+    for (const ProfilerHitchFrame& frame : frames) {
+        events.insert(events.end(), frame.Events.begin(), frame.Events.end());
+        counters.insert(counters.end(), frame.Counters.begin(), frame.Counters.end());
+    }
+    WriteTrace(base + ".json", events, counters);
+
+    // Scope tree of the slow frame, one block per thread.
+    Vector<ProfilerEvent> tree = hitch.Events;
+    std::sort(tree.begin(), tree.end(), [](const ProfilerEvent& a, const ProfilerEvent& b) {
+        return a.Thread != b.Thread ? a.Thread < b.Thread : a.Start < b.Start;
+    });
+
+    std::ofstream stream(base + ".txt");
+    if (!stream.is_open()) {
+        LOG_ERROR("Failed to open hitch file {0}.txt", base);
+        return;
+    }
+    stream << std::fixed << std::setprecision(3);
+    stream << "Frame " << hitch.Frame << " took " << hitch.Time << "ms (budget " << sData.HitchBudget << "ms)\n";
+
+    UInt32 thread = UINT32_MAX;
+    for (const ProfilerEvent& event : tree) {
+        if (event.Thread != thread) {
+            thread = event.Thread;
+            stream << "\n" << GetThreadName(thread) << "\n";
+        }
+        stream << String((event.Depth + 1) * 2, ' ') << event.Name << " : " << event.GetTime() << "ms, " << event.Allocations << " allocs (" << event.AllocatedBytes << " bytes)\n";
+    }
+
+    if (!hitch.Counters.empty()) {
+        stream << "\nCounters\n";
+        for (const ProfilerCounterSample& sample : hitch.Counters) {
+            stream << "  " << sample.Name << " : " << std::setprecision(0) << sample.Value << std::setprecision(3) << "\n";
+        }
+    }
+
+    LOG_INFO("Wrote hitch of frame {0} to {1}.json and {1}.txt", hitch.Frame, base);
+}
+
+ProfilerStats Profiler::GetScopeStats(const String& name)
+{
+    std::lock_guard<std::mutex> lock(sData.StatsMutex);
+    auto it = sData.ScopeIndices.find(name);
+    if (it == sData.ScopeIndices.end())
+        return {};
+    return sData.Scopes[it->second].GetStats();
+}
+
+ProfilerStats Profiler::GetFrameStats()
+{
+    std::lock_guard<std::mutex> lock(sData.StatsMutex);
+    return sData.FrameTimes.GetStats();
+}
+
+Vector<UInt32> Profiler::GetFrameTimeHistogram(float bucketWidth, UInt32 bucketCount)
+{
+    Vector<UInt32> buckets(std::max(bucketCount, 1u), 0);
+
+    // Scripts can pass anything, a zero, negative or NaN width would divide into garbage bucket indices
+    if (!(bucketWidth >= PROFILER_MIN_BUCKET_WIDTH))
+        bucketWidth = PROFILER_MIN_BUCKET_WIDTH;
+
+    std::lock_guard<std::mutex> lock(sData.StatsMutex);
+    UInt64 count = std::min<UInt64>(sData.FrameTimes.SampleCount, PROFILER_HISTORY_SIZE);
+    for (UInt64 i = 0; i < count; i++) {
+        UInt64 bucket = static_cast<UInt64>(sData.FrameTimes.Samples[i] / bucketWidth);
+        buckets[std::min<UInt64>(bucket, buckets.size() - 1)]++;
+    }
+    return buckets;
+}
+
+Vector<String> Profiler::GetScopeNames()
+{
+    std::lock_guard<std::mutex> lock(sData.StatsMutex);
+    Vector<String> names;
+    for (const ProfilerHistory& history : sData.Scopes) {
+        names.push_back(history.Name);
+    }
+    return names;
+}
+
+void Profiler::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(sData.StatsMutex);
+    for (ProfilerHistory& history : sData.Scopes) {
+        history.SampleCount = 0;
+        history.PendingFrame = UINT64_MAX;
+        history.Pending = 0.0f;
+        history.PendingAllocations = {};
+        history.LastAllocations = {};
+    }
+    sData.FrameTimes.SampleCount = 0;
+    sData.LastFrameStart = 0;
+}
+
+void Profiler::RecordCounter(const char* name, double value)
+{
+    std::lock_guard<std::mutex> lock(sData.CaptureMutex);
+    if (!sData.Capturing)
+        return;
+    sData.CaptureCounters.push_back({ name, Now(), value });
+}
+
+void Profiler::RecordCounters()
+{
+    UInt32 count = Counters::GetCount();
+    if (sData.HitchBudget > 0.0f) {
+        UInt64 now = Now();
+        for (UInt32 i = 0; i < count; i++) {
+            sData.HitchCounters.push_back({ Counters::GetName(i), now, static_cast<double>(Counters::GetFrameValue(i)) });
+        }
+    }
+
+    if (!IsCapturing())
+        return;
+
+    for (UInt32 i = 0; i < count; i++) {
+        RecordCounter(Counters::GetName(i), Counters::GetFrameValue(i));
+    }
+}
+
+void Profiler::BeginCapture(UInt32 frameCount, const String& path)
+{
+    std::lock_guard<std::mutex> lock(sData.CaptureMutex);
+    if (sData.Capturing) {
+        LOG_WARN("A profiler capture is already running, ignoring capture to {0}", path);
+        return;
+    }
+
+    sData.Capturing = true;
+    sData.CaptureFramesLeft = std::max(frameCount, 1u);
+    sData.CapturePath = path;
+    sData.CaptureEvents.clear();
+    sData.CaptureCounters.clear();
+    LOG_INFO("Capturing {0} frames to {1}", sData.CaptureFramesLeft, path);
+}
+
+bool Profiler::IsCapturing()
+{
+    std::lock_guard<std::mutex> lock(sData.CaptureMutex);
+    return sData.Capturing;
+}
+
+String Profiler::GetThreadName(UInt32 thread)
+{
+    UInt32 jobThread = UINT32_MAX;
+    {
+        std::lock_guard<std::mutex> lock(sData.ThreadMutex);
+        if (thread < sData.Threads.size())
+            jobThread = sData.Threads[thread]->JobThread;
+    }
+    if (jobThread == 0)
+        return "Main Thread";
+    if (jobThread != UINT32_MAX)
+        return "Worker " + std::to_string(jobThread);
+    return "Thread " + std::to_string(thread);
 }
 
-// PushEntry: Reuse existing entries if possible
-void Profiler::PushEntry(const ProfilerEntry& entry)
+// Escapes a string for a JSON string literal
+static void WriteJSONString(std::ofstream& stream, const char* str)
 {
-    // Find an existing inactive entry (from an old frame)
-    for (UInt64 i = 0; i < sData.EntryCount; ++i) {
-        if (sData.Entries[i].GetFrame() != sData.CurrentFrame) {
-            sData.Entries[i] = entry;
-            return;
+    stream << '"';
+    for (const char* c = str; *c; c++) {
+        switch (*c) {
+            case '"': stream << "\\\""; break;
+            case '\\': stream << "\\\\"; break;
+            case '\n': stream << "\\n"; break;
+            case '\t': stream << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20)
+                    stream << ' ';
+                else
+                    stream << *c;
+                break;
         }
     }
+    stream << '"';
+}
+
+void Profiler::WriteCapture()
+{
+    Vector<ProfilerEvent> events;
+    Vector<ProfilerCounterSample> counters;
+    String path;
+    {
+        std::lock_guard<std::mutex> lock(sData.CaptureMutex);
+        events.swap(sData.CaptureEvents);
+        counters.swap(sData.CaptureCounters);
+        path.swap(sData.CapturePath);
+        sData.Capturing = false;
+    }
 
-    // If no reusable entry, add a new one
-    if (sData.EntryCount < MAX_PROFILER_ENTRIES) {
-        sData.Entries[sData.EntryCount++] = entry;
+    WriteTrace(path, events, counters);
+}
+
+void Profiler::WriteTrace(const String& path, const Vector<ProfilerEvent>& events, const Vector<ProfilerCounterSample>& counters)
+{
+    std::ofstream stream(path);
+    if (!stream.is_open()) {
+        LOG_ERROR("Failed to open profiler capture file {0}", path);
         return;
     }
 
-    // If the buffer is full, overwrite the oldest entry (ring buffer behavior)
-    UInt64 index = sData.EntryCount % MAX_PROFILER_ENTRIES;
-    sData.Entries[index] = entry;
+    // Chrome Trace Event format, timestamps are in microseconds.
+    stream << std::fixed << std::setprecision(3);
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    UInt32 threadCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(sData.ThreadMutex);
+        threadCount = static_cast<UInt32>(sData.Threads.size());
+    }
+    stream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"Mnemen\"}}";
+    for (UInt32 i = 0; i < threadCount; i++) {
+        stream << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << i << ",\"args\":{\"name\":";
+        WriteJSONString(stream, GetThreadName(i).c_str());
+        stream << "}}";
+    }
+
+    for (const ProfilerEvent& event : events) {
+        stream << ",\n{\"ph\":\"X\",\"pid\":0,\"tid\":" << event.Thread << ",\"name\":";
+        WriteJSONString(stream, event.Name);
+        stream << ",\"ts\":" << event.Start / 1000.0 << ",\"dur\":" << (event.End - event.Start) / 1000.0;
+        stream << ",\"args\":{\"frame\":" << event.Frame << ",\"allocs\":" << event.Allocations << ",\"allocBytes\":" << event.AllocatedBytes << "}}";
+    }
+
+    for (const ProfilerCounterSample& sample : counters) {
+        stream << ",\n{\"ph\":\"C\",\"pid\":0,\"name\":";
+        WriteJSONString(stream, sample.Name);
+        stream << ",\"ts\":" << sample.Time / 1000.0 << ",\"args\":{\"value\":" << sample.Value << "}}";
+    }
+    stream << "\n]}\n";
+
+    LOG_INFO("Wrote profiler trace with {0} events to {1}", events.size(), path);
+}
+
+UInt64 Profiler::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sEpoch).count();
+}
+
+const char* Profiler::Intern(const String& name)
+{
+    std::lock_guard<std::mutex> lock(sData.NameMutex);
+    return sData.Names.insert(name).first->c_str();
+}
+
+ProfilerThread* Profiler::GetThread()
+{
+    if (!sThread) {
+        std::lock_guard<std::mutex> lock(sData.ThreadMutex);
+        Unique<ProfilerThread> thread = MakeUnique<ProfilerThread>();
+        thread->Index = static_cast<UInt32>(sData.Threads.size());
+        thread->JobThread = JobSystem::GetThreadIndex();
+        sThread = thread.get();
+        sData.Threads.push_back(std::move(thread));
+    }
+    return sThread;
 }
 
 UInt32 Profiler::StartGPUTimer(CommandBuffer::Ref cmdList)
@@ -105,6 +567,7 @@ void Profiler::ReadbackGPUResults()
 Util::UUID Profiler::PushResource(UInt64 size, String Name)
 {
     Util::UUID uuid = Util::NewUUID();
+    std::lock_guard<std::mutex> lock(sData.ResourceMutex);
     sData.Resources[uuid] = {
         size, Name
     };
@@ -113,6 +576,7 @@ Util::UUID Profiler::PushResource(UInt64 size, String Name)
 
 void Profiler::SetResourceData(Util::UUID id, UInt32 width, UInt32 height, UInt32 depth, UInt32 levels)
 {
+    std::lock_guard<std::mutex> lock(sData.ResourceMutex);
     if (sData.Resources.empty())
         return;
     if (sData.Resources.count(id) == 0)
@@ -125,6 +589,7 @@ void Profiler::SetResourceData(Util::UUID id, UInt32 width, UInt32 height, UInt3
 
 void Profiler::TagResource(Util::UUID id, ResourceTag tag)
 {
+    std::lock_guard<std::mutex> lock(sData.ResourceMutex);
     if (sData.Resources.empty())
         return;
     if (sData.Resources.count(id) == 0)
@@ -134,6 +599,7 @@ void Profiler::TagResource(Util::UUID id, ResourceTag tag)
 
 void Profiler::PopResource(Util::UUID id)
 {
+    std::lock_guard<std::mutex> lock(sData.ResourceMutex);
     if (sData.Resources.empty())
         return;
     if (sData.Resources.count(id) == 0)
@@ -148,23 +614,37 @@ void Profiler::OnUI()
 
     ImGui::Begin(ICON_FA_CLOCK_O " Profiler");
     if (ImGui::TreeNodeEx("Statistics", ImGuiTreeNodeFlags_Framed)) {
-        ImGui::Text("Instance Count : %llu", Statistics::Get().InstanceCount);
-        ImGui::Text("Triangle Count : %llu", Statistics::Get().TriangleCount);
-        ImGui::Text("Meshlet Count : %llu", Statistics::Get().MeshletCount);
-        ImGui::Text("Draw Call Count : %llu", Statistics::Get().DrawCallCount);
-        ImGui::Text("Dispatch Count : %llu", Statistics::Get().DispatchCount);
+        if (ImGui::BeginTable("Counters", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Counter");
+            ImGui::TableSetupColumn("Last Frame");
+            ImGui::TableHeadersRow();
+            UInt32 count = Counters::GetCount();
+            for (UInt32 i = 0; i < count; i++) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text("%s", Counters::GetName(i));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", Counters::GetFrameValue(i));
+            }
+            ImGui::EndTable();
+        }
         ImGui::Separator();
         // Resources
         // VRAM
         {
-            UInt64 percentage = (Statistics::Get().UsedVRAM * 100) / Statistics::Get().MaxVRAM;
-            float stupidVRAMPercetange = percentage / 100.0f;
-            std::stringstream ss;
-            ss << ICON_FA_VIDEO_CAMERA << " VRAM Usage (" << percentage << "%%): " << (((Statistics::Get().UsedVRAM / 1024.0F) / 1024.0f) / 1024.0f) << "gb/" << (((Statistics::Get().MaxVRAM / 1024.0f) / 1024.0f) / 1024.0f) << "gb";
-            std::stringstream percents;
-            percents << percentage << "%";
-            ImGui::Text(ss.str().c_str());
-            ImGui::ProgressBar(stupidVRAMPercetange, ImVec2(0, 0), percents.str().c_str());
+            // No adapter reported its memory, there is nothing to compare the usage against
+            if (Statistics::Get().MaxVRAM == 0) {
+                ImGui::Text("%s VRAM Usage: %.3fgb/n/a", ICON_FA_VIDEO_CAMERA, ((Statistics::Get().UsedVRAM / 1024.0f) / 1024.0f) / 1024.0f);
+            } else {
+                UInt64 percentage = (Statistics::Get().UsedVRAM * 100) / Statistics::Get().MaxVRAM;
+                float stupidVRAMPercetange = percentage / 100.0f;
+                std::stringstream ss;
+                ss << ICON_FA_VIDEO_CAMERA << " VRAM Usage (" << percentage << "%%): " << (((Statistics::Get().UsedVRAM / 1024.0F) / 1024.0f) / 1024.0f) << "gb/" << (((Statistics::Get().MaxVRAM / 1024.0f) / 1024.0f) / 1024.0f) << "gb";
+                std::stringstream percents;
+                percents << percentage << "%";
+                ImGui::Text(ss.str().c_str());
+                ImGui::ProgressBar(stupidVRAMPercetange, ImVec2(0, 0), percents.str().c_str());
+            }
         }
         ImGui::Separator();
         // RAM
@@ -190,12 +670,138 @@ void Profiler::OnUI()
         }
         ImGui::TreePop();
     }
+    if (ImGui::TreeNodeEx("Memory", ImGuiTreeNodeFlags_Framed)) {
+        ImGui::Text("Tracked Heap : %.2fmb", Memory::GetTotalLiveBytes() / 1024.0f / 1024.0f);
+        if (ImGui::BeginTable("MemoryTags", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Tag");
+            ImGui::TableSetupColumn("Live (mb)");
+            ImGui::TableSetupColumn("Peak (mb)");
+            ImGui::TableSetupColumn("Live Allocations");
+            ImGui::TableSetupColumn("Total Allocations");
+            ImGui::TableHeadersRow();
+            for (UInt32 i = 0; i < (UInt32)MemoryTag::MAX; i++) {
+                MemoryTagStats stats = Memory::GetTagStats((MemoryTag)i);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%s", Memory::GetTagName((MemoryTag)i));
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", stats.LiveBytes / 1024.0f / 1024.0f);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", stats.PeakBytes / 1024.0f / 1024.0f);
+                ImGui::TableNextColumn(); ImGui::Text("%llu", stats.LiveAllocations);
+                ImGui::TableNextColumn(); ImGui::Text("%llu", stats.TotalAllocations);
+            }
+            ImGui::EndTable();
+        }
+        if (ImGui::Button("Reset Peaks")) {
+            Memory::ResetPeaks();
+        }
+        ImGui::TreePop();
+    }
+    if (ImGui::TreeNodeEx("Frame Times", ImGuiTreeNodeFlags_Framed)) {
+        ProfilerStats frame = GetFrameStats();
+        ImGui::Text("Frame : %.3fms avg, %.3fms min, %.3fms max", frame.Avg, frame.Min, frame.Max);
+        ImGui::Text("P95 : %.3fms, P99 : %.3fms (%u frames)", frame.P95, frame.P99, frame.SampleCount);
+
+        Vector<UInt32> histogram = GetFrameTimeHistogram();
+        Array<float, 34> values = {};
+        for (UInt64 i = 0; i < values.size(); i++) {
+            values[i] = static_cast<float>(histogram[i]);
+        }
+        ImGui::PlotHistogram("##FrameTimeHistogram", values.data(), static_cast<int>(values.size()), 0, "Frame times (1ms buckets)", 0.0f, FLT_MAX, ImVec2(0, 80));
+        if (ImGui::Button("Reset")) {
+            ResetStats();
+        }
+
+        if (ImGui::BeginTable("ScopeStats", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Scope");
+            ImGui::TableSetupColumn("Avg");
+            ImGui::TableSetupColumn("Min");
+            ImGui::TableSetupColumn("Max");
+            ImGui::TableSetupColumn("P95");
+            ImGui::TableSetupColumn("P99");
+            ImGui::TableSetupColumn("Allocs");
+            ImGui::TableSetupColumn("Alloc Bytes");
+            ImGui::TableHeadersRow();
+            for (const String& name : GetScopeNames()) {
+                ProfilerStats stats = GetScopeStats(name);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%s", name.c_str());
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.Avg);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.Min);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.Max);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.P95);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", stats.P99);
+                ImGui::TableNextColumn(); ImGui::Text("%llu", stats.Allocations);
+                ImGui::TableNextColumn(); ImGui::Text("%llu", stats.AllocatedBytes);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+    if (ImGui::TreeNodeEx("Capture", ImGuiTreeNodeFlags_Framed)) {
+        static int frameCount = 120;
+        ImGui::InputInt("Frames", &frameCount);
+        if (IsCapturing()) {
+            ImGui::Text("Capturing...");
+        } else if (ImGui::Button(ICON_FA_CIRCLE " Capture")) {
+            BeginCapture(std::max(frameCount, 1), "Capture_" + std::to_string(GetFrame()) + ".json");
+        }
+
+        float budget = sData.HitchBudget;
+        if (ImGui::DragFloat("Hitch Budget (ms)", &budget, 0.5f, 0.0f, 1000.0f)) {
+            SetHitchBudget(budget);
+        }
+        ImGui::Text("Frames over budget dump the last %u frames to the Hitches folder", PROFILER_HITCH_FRAMES);
+        ImGui::TreePop();
+    }
     if (ImGui::TreeNodeEx("CPU Profiler", ImGuiTreeNodeFlags_Framed)) {
-        for (UInt64 i = 0; i < sData.EntryCount; ++i) {
-            const ProfilerEntry& entry = sData.Entries[i];
-            if (!entry.IsGPU()) {
-                ImGui::Text("%s : %fms", entry.GetName().c_str(), entry.GetCPUTime());
+        // Children start after their parent on the same thread, so sorting puts every scope right after its parent.
+        static Vector<ProfilerEvent> sorted;
+        {
+            std::lock_guard<std::mutex> lock(sData.EventMutex);
+            sorted = sData.Events;
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const ProfilerEvent& a, const ProfilerEvent& b) {
+            if (a.Thread != b.Thread)
+                return a.Thread < b.Thread;
+            if (a.Start != b.Start)
+                return a.Start < b.Start;
+            return a.Depth < b.Depth;
+        });
+
+        struct OpenScope {
+            UInt32 ID;
+            bool Pushed;
+        };
+        static Vector<OpenScope> stack;
+        for (UInt64 i = 0; i < sorted.size(); i++) {
+            const ProfilerEvent& event = sorted[i];
+            if (i == 0 || sorted[i - 1].Thread != event.Thread) {
+                for (; !stack.empty(); stack.pop_back()) {
+                    if (stack.back().Pushed)
+                        ImGui::TreePop();
+                }
+                ImGui::Separator();
+                ImGui::Text("%s", GetThreadName(event.Thread).c_str());
             }
+
+            // Close the scopes this one isn't nested in. A scope whose parent finished after the last collection shows up as a root.
+            while (!stack.empty() && stack.back().ID != event.Parent) {
+                if (stack.back().Pushed)
+                    ImGui::TreePop();
+                stack.pop_back();
+            }
+            if (!stack.empty() && !stack.back().Pushed) {
+                stack.push_back({ event.ID, false });
+                continue;
+            }
+
+            bool leaf = i + 1 == sorted.size() || sorted[i + 1].Thread != event.Thread || sorted[i + 1].Parent != event.ID;
+            ImGuiTreeNodeFlags flags = leaf ? ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen : ImGuiTreeNodeFlags_DefaultOpen;
+            bool open = ImGui::TreeNodeEx((void*)(((UInt64)event.Thread << 32) | event.ID), flags, "%s : %fms (%u allocs)", event.Name, event.GetTime(), event.Allocations);
+            stack.push_back({ event.ID, open && !leaf });
+        }
+        for (; !stack.empty(); stack.pop_back()) {
+            if (stack.back().Pushed)
+                ImGui::TreePop();
         }
         ImGui::TreePop();
     }
@@ -214,6 +820,7 @@ void Profiler::OnUI()
             ImGui::PushStyleColor(ImGuiCol_HeaderActive, (ImVec4)ImColor::HSV(i / 7.0f, 0.8f, 0.8f));
 
             if (ImGui::TreeNodeEx(tags[i], ImGuiTreeNodeFlags_Framed)) {
+                std::lock_guard<std::mutex> lock(sData.ResourceMutex);
                 for (auto& item : sData.Resources) {
                     Util::UUID uuid = item.first;
                     ProfiledResource resource = item.second;
@@ -7,63 +7,145 @@
 
 #include <Core/Common.hpp>
 #include <Core/Timer.hpp>
+#include <Core/Memory.hpp>
 #include <Utility/UUID.hpp>
 
 #include <RHI/CommandBuffer.hpp>
 #include <RHI/GPUTimer.hpp>
 
-constexpr size_t MAX_PROFILER_ENTRIES = 1024;
+#include <atomic>
+#include <mutex>
 
-/// @struct ProfilerEntry
-/// @brief Represents a single profiling entry for CPU and GPU execution times.
-struct ProfilerEntry
+constexpr UInt32 MAX_PROFILER_EVENTS = 8192; ///< Size of each thread's event ring.
+constexpr UInt32 MAX_PROFILER_DEPTH = 64; ///< Deepest scope nesting tracked per thread.
+constexpr UInt32 PROFILER_HISTORY_SIZE = 512; ///< Number of frames kept by the rolling statistics.
+constexpr UInt32 PROFILER_HITCH_FRAMES = 256; ///< Number of frames kept for hitch dumps, a few seconds at interactive frame rates.
+constexpr float PROFILER_MIN_BUCKET_WIDTH = 0.01f; ///< Narrowest frame time histogram bucket, in milliseconds.
+
+/// @struct ProfilerEvent
+/// @brief A finished CPU scope.
+struct ProfilerEvent
 {
-public:
-    /// @brief Default constructor.
-    ProfilerEntry() = default;
+    const char* Name = nullptr; ///< Name of the scope, a string with static storage (see Profiler::Intern).
+    UInt64 Start = 0; ///< Start timestamp, in nanoseconds since the profiler started.
+    UInt64 End = 0; ///< End timestamp, in nanoseconds since the profiler started.
+    UInt64 Frame = 0; ///< Frame the scope started in.
+    UInt32 ID = 0; ///< Identifier of the scope, unique per thread.
+    UInt32 Parent = 0; ///< ID of the enclosing scope on the same thread, 0 for root scopes.
+    UInt32 Depth = 0; ///< Nesting depth, 0 for root scopes.
+    UInt32 Thread = 0; ///< Index of the thread that recorded the scope.
+    UInt32 Allocations = 0; ///< Heap allocations the thread made during the scope, children included.
+    UInt64 AllocatedBytes = 0; ///< Bytes requested by those allocations.
+
+    /// @brief Gets the duration of the scope.
+    /// @return Duration in milliseconds.
+    float GetTime() const { return (End - Start) / 1'000'000.0f; }
+};
 
-    /// @brief Constructs a CPU profiler entry.
-    /// @param name The name of the profiler entry.
-    ProfilerEntry(const String& name);
+/// @struct ProfilerCounterSample
+/// @brief A value of a named counter at a point in time.
+struct ProfilerCounterSample
+{
+    const char* Name = nullptr; ///< Name of the counter, a string with static storage.
+    UInt64 Time = 0; ///< Timestamp, in nanoseconds since the profiler started.
+    double Value = 0.0; ///< Value of the counter.
+};
 
-    /// @brief Constructs a GPU profiler entry.
-    /// @param name The name of the profiler entry.
-    /// @param commandBuffer The command buffer associated with the GPU query.
-    ProfilerEntry(const String& name, CommandBuffer::Ref commandBuffer);
+/// @struct ProfilerHitchFrame
+/// @brief Everything the profiler collected for one frame, kept around in case a later frame hitches.
+struct ProfilerHitchFrame
+{
+    UInt64 Frame = 0; ///< Index of the frame.
+    float Time = 0.0f; ///< Frame time, in milliseconds.
+    Vector<ProfilerEvent> Events; ///< Events collected at the end of the frame.
+    Vector<ProfilerCounterSample> Counters; ///< Counter values of the frame.
+};
 
-    /// @brief Destructor.
-    ~ProfilerEntry();
+/// @struct ProfilerStats
+/// @brief Statistics over the rolling window of a scope or of the frame time, in milliseconds.
+struct ProfilerStats
+{
+    float Last = 0.0f; ///< Most recent sample.
+    float Min = 0.0f; ///< Smallest sample.
+    float Avg = 0.0f; ///< Mean of the samples.
+    float Max = 0.0f; ///< Largest sample.
+    float P95 = 0.0f; ///< 95th percentile.
+    float P99 = 0.0f; ///< 99th percentile.
+    UInt32 SampleCount = 0; ///< Number of samples in the window.
+    UInt64 Allocations = 0; ///< Heap allocations made during the most recent sample.
+    UInt64 AllocatedBytes = 0; ///< Bytes requested by those allocations.
+};
 
-    /// @brief Gets the CPU execution time.
-    /// @return CPU execution time in milliseconds.
-    float GetCPUTime() const { return mCPUTime; }
+/// @struct ProfilerHistory
+/// @brief Rolling window of per-frame timings.
+struct ProfilerHistory
+{
+    String Name; ///< Name of the scope.
+    Array<float, PROFILER_HISTORY_SIZE> Samples = {}; ///< Ring of samples, in milliseconds.
+    UInt64 SampleCount = 0; ///< Number of samples ever pushed.
+    UInt64 PendingFrame = UINT64_MAX; ///< Frame the pending sample is accumulating for.
+    float Pending = 0.0f; ///< Time spent in the scope so far during PendingFrame.
+    MemoryAllocationCount PendingAllocations; ///< Allocations made in the scope so far during PendingFrame.
+    MemoryAllocationCount LastAllocations; ///< Allocations made in the scope during the most recent sample.
+
+    /// @brief Pushes a sample in the window, evicting the oldest one if it is full.
+    void Push(float sample);
+
+    /// @brief Computes the statistics of the window.
+    ProfilerStats GetStats() const;
+};
+
+/// @struct ProfilerThread
+/// @brief Event ring of a single thread.
+///
+/// Only the owning thread writes events and only Profiler::BeginFrame reads them, so the ring is a
+/// lock-free single producer/single consumer queue. Events are dropped when it is full.
+struct ProfilerThread
+{
+    Array<ProfilerEvent, MAX_PROFILER_EVENTS> Events; ///< Ring of finished scopes.
+    std::atomic<UInt64> Head = 0; ///< Next slot written by the owning thread.
+    std::atomic<UInt64> Tail = 0; ///< Next slot read by the profiler.
+    std::atomic<UInt64> Dropped = 0; ///< Number of events lost because the ring was full.
 
-    /// @brief Gets the GPU execution time.
-    /// @return GPU execution time in milliseconds.
-    float GetGPUTime() const { return mGPUTime; }
+    UInt32 Index = 0; ///< Order in which the thread was registered.
+    UInt32 JobThread = UINT32_MAX; ///< Job system index of the thread, UINT32_MAX if it isn't a job thread.
+
+    UInt32 NextID = 0; ///< Last scope ID handed out.
+    UInt32 Depth = 0; ///< Number of open scopes.
+    UInt32 Stack[MAX_PROFILER_DEPTH] = {}; ///< IDs of the open scopes.
+};
 
-    /// @brief Gets the name of the profiling entry.
-    /// @return The name of the entry.
-    const String& GetName() const { return mName; }
+/// @class ProfilerScope
+/// @brief Records a CPU scope from construction to destruction. Use the PROFILE_* macros.
+class ProfilerScope
+{
+public:
+    /// @brief Opens a CPU scope.
+    /// @param name The name of the scope. Must outlive the profiler, use a literal or Profiler::Intern.
+    ProfilerScope(const char* name);
 
-    /// @brief Gets the frame index for this entry.
-    /// @return The frame index.
-    UInt64 GetFrame() const { return mFrame; }
+    /// @brief Opens a CPU scope that also times the GPU.
+    /// @param name The name of the scope. Must outlive the profiler, use a literal or Profiler::Intern.
+    /// @param commandBuffer The command buffer associated with the GPU query.
+    ProfilerScope(const char* name, CommandBuffer::Ref commandBuffer);
 
-    /// @brief Checks if this is a GPU profiling entry.
-    /// @return True if it's a GPU entry, false otherwise.
-    const bool IsGPU() const { return mGPU; }
+    /// @brief Closes the scope and pushes its event.
+    ~ProfilerScope();
 
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
 private:
-    friend class Profiler;
-
-    Timer mTimer;                 ///< Timer object to measure CPU time.
-    String mName;                 ///< Name of the profiler entry.
-    float mCPUTime = 0.0f;        ///< CPU execution time in milliseconds.
-    float mGPUTime = 0.0f;        ///< GPU execution time in milliseconds.
-    bool mGPU = false;            ///< Flag to determine if it's a GPU entry.
-    UInt32 mTimerIndex = 0;       ///< Index for the GPU timer.
-    UInt64 mFrame = 0;            ///< Frame index.
+    void Open(const char* name);
+
+    ProfilerThread* mThread; ///< Thread the scope was opened on.
+    const char* mName; ///< Name of the scope.
+    UInt64 mStart; ///< Start timestamp.
+    UInt64 mFrame; ///< Frame the scope was opened in.
+    UInt32 mID; ///< ID of the scope.
+    UInt32 mParent; ///< ID of the enclosing scope.
+    UInt32 mDepth; ///< Nesting depth.
+    MemoryAllocationCount mAllocations; ///< Allocations of the thread when the scope opened.
+    UInt32 mTimerIndex = UINT32_MAX; ///< GPU timer index, if any.
     CommandBuffer::Ref mCommandBuffer; ///< Associated command buffer for GPU profiling.
 };
 
@@ -98,12 +180,72 @@ public:
     /// @brief Shuts down the profiler system.
     static void Exit();
 
-    /// @brief Marks the beginning of a new frame for profiling.
+    /// @brief Marks the beginning of a new frame for profiling, and collects the events every thread finished since the last one.
     static void BeginFrame();
 
-    /// @brief Pushes a new profiling entry into the profiler.
-    /// @param entry The profiling entry to be recorded.
-    static void PushEntry(const ProfilerEntry& entry);
+    /// @brief Gets the events collected by the last BeginFrame, grouped by thread.
+    /// @note Only safe to call from the thread calling BeginFrame.
+    static const Vector<ProfilerEvent>& GetEvents() { return sData.Events; }
+
+    /// @brief Gets the rolling statistics of a scope. A scope that runs several times in a frame is summed.
+    /// @param name The name of the scope.
+    /// @return The statistics, all zero if the scope never ran.
+    static ProfilerStats GetScopeStats(const String& name);
+
+    /// @brief Gets the rolling statistics of the frame time, measured between two BeginFrame calls.
+    static ProfilerStats GetFrameStats();
+
+    /// @brief Buckets the frame times of the rolling window.
+    /// @param bucketWidth Width of a bucket, in milliseconds. Clamped to PROFILER_MIN_BUCKET_WIDTH.
+    /// @param bucketCount Number of buckets. The last one also counts every slower frame.
+    /// @return The number of frames in each bucket.
+    static Vector<UInt32> GetFrameTimeHistogram(float bucketWidth = 1.0f, UInt32 bucketCount = 34);
+
+    /// @brief Gets the names of every scope with statistics.
+    static Vector<String> GetScopeNames();
+
+    /// @brief Clears the rolling statistics, e.g. once a benchmark scene is warmed up.
+    static void ResetStats();
+
+    /// @brief Records the value of a counter. Samples are only kept while a capture is running.
+    /// @param name The name of the counter, a string literal or a name returned by Profiler::Intern.
+    /// @param value The value of the counter.
+    static void RecordCounter(const char* name, double value);
+
+    /// @brief Records the per-frame value of every registered counter (see Counters) for captures and hitch dumps. Call it after Counters::EndFrame().
+    static void RecordCounters();
+
+    /// @brief Starts recording every event and counter of the next frames, then writes them as a Chrome Trace Event JSON file.
+    /// The file can be opened in chrome://tracing, Perfetto or Speedscope.
+    /// @param frameCount Number of frames to record.
+    /// @param path Path of the JSON file to write.
+    static void BeginCapture(UInt32 frameCount, const String& path);
+
+    /// @brief Checks if a capture is running.
+    static bool IsCapturing();
+
+    /// @brief Sets the frame time above which the last PROFILER_HITCH_FRAMES frames are dumped to the Hitches folder.
+    /// Each hitch writes a Chrome trace of the history and a text file with the scope tree of the slow frame.
+    /// After a dump, the next one waits until the history is full of new frames.
+    /// @param budget The budget in milliseconds, 0 disables hitch detection.
+    static void SetHitchBudget(float budget);
+
+    /// @brief Gets the hitch budget in milliseconds, 0 if hitch detection is disabled.
+    static float GetHitchBudget() { return sData.HitchBudget; }
+
+    /// @brief Gets the current frame index.
+    static UInt64 GetFrame() { return sData.CurrentFrame.load(std::memory_order_relaxed); }
+
+    /// @brief Gets the current timestamp.
+    /// @return Nanoseconds since the profiler started.
+    static UInt64 Now();
+
+    /// @brief Returns a copy of a name that lives as long as the profiler, for scopes with a name built at runtime.
+    /// @note Takes a lock, call it once and keep the result rather than every time the scope runs.
+    static const char* Intern(const String& name);
+
+    /// @brief Gets the event ring of the calling thread, registering it on first use.
+    static ProfilerThread* GetThread();
 
     /// @brief Displays profiling data in a UI panel.
     static void OnUI();
@@ -137,31 +279,80 @@ public:
     /// @brief Pops a resource in the render list
     static void PopResource(Util::UUID id);
 private:
-    friend class ProfilerEntry;
-
     /// @brief Internal profiler data structure.
     struct Data {
-        ProfilerEntry Entries[MAX_PROFILER_ENTRIES]; ///< Array of profiling entries.
-        UInt64 EntryCount = 0; ///< Number of active profiling entries.
-        UInt64 CurrentFrame = 0; ///< Current frame index.
+        Vector<Unique<ProfilerThread>> Threads; ///< Every thread that ever opened a scope.
+        std::mutex ThreadMutex; ///< Guards Threads.
+        Vector<ProfilerEvent> Events; ///< Events collected by the last BeginFrame.
+        Vector<ProfilerEvent> Collected; ///< Staging list BeginFrame drains the rings into.
+        std::mutex EventMutex; ///< Guards Events, the UI reads it from the render job.
+        std::atomic<UInt64> CurrentFrame = 0; ///< Current frame index.
+        Set<String> Names; ///< Names interned at runtime.
+        std::mutex NameMutex; ///< Guards Names.
         UnorderedMap<Util::UUID, ProfiledResource> Resources; ///< List of profiled resources
+        std::mutex ResourceMutex; ///< Guards Resources, textures can be created and freed from any thread.
+
+        std::mutex StatsMutex; ///< Guards the rolling statistics.
+        Vector<ProfilerHistory> Scopes; ///< Rolling statistics of every scope.
+        UnorderedMap<String, UInt32> ScopeIndices; ///< Scope name to index in Scopes.
+        UnorderedMap<const char*, UInt32> ScopeLookup; ///< Cache of name pointer to index in Scopes, skips hashing the string.
+        ProfilerHistory FrameTimes; ///< Rolling frame times.
+        UInt64 LastFrameStart = 0; ///< Timestamp of the last BeginFrame.
+
+        std::mutex CaptureMutex; ///< Guards the capture state.
+        bool Capturing = false; ///< If a capture is running.
+        UInt32 CaptureFramesLeft = 0; ///< Frames left to record.
+        String CapturePath; ///< Where to write the capture.
+        Vector<ProfilerEvent> CaptureEvents; ///< Events recorded by the capture.
+        Vector<ProfilerCounterSample> CaptureCounters; ///< Counter samples recorded by the capture.
+
+        float HitchBudget = 0.0f; ///< Frame time that triggers a hitch dump, in milliseconds. 0 disables it.
+        Array<ProfilerHitchFrame, PROFILER_HITCH_FRAMES> HitchFrames; ///< Ring of the last frames, only touched by the main thread.
+        UInt64 HitchFrameCount = 0; ///< Number of frames ever pushed in the ring.
+        UInt64 HitchCooldown = PROFILER_HITCH_FRAMES; ///< No dump is written before the ring holds this many frames.
+        Vector<ProfilerCounterSample> HitchCounters; ///< Counter values of the current frame, moved to the ring by BeginFrame.
+        std::atomic<bool> HitchWriting = false; ///< If a dump is being written by a worker.
     };
 
+    /// @brief Gets a display name for a registered thread.
+    static String GetThreadName(UInt32 thread);
+
+    /// @brief Adds the collected events to the rolling statistics.
+    /// @return The time of the frame that just ended in milliseconds, 0 on the first frame.
+    static float UpdateStats();
+
+    /// @brief Writes the finished capture to disk.
+    static void WriteCapture();
+
+    /// @brief Writes events and counter samples as a Chrome Trace Event JSON file.
+    static void WriteTrace(const String& path, const Vector<ProfilerEvent>& events, const Vector<ProfilerCounterSample>& counters);
+
+    /// @brief Pushes the collected events in the hitch ring, and dumps the ring if the frame is over budget.
+    /// @param frameTime The time of the frame that just ended, in milliseconds.
+    static void UpdateHitches(float frameTime);
+
+    /// @brief Writes a hitch dump to disk.
+    /// @param frames The frames of the ring, oldest first. The last one is the slow frame.
+    static void WriteHitch(const Vector<ProfilerHitchFrame>& frames);
+
     static Data sData; ///< Static instance of profiler data.
 };
 
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
 /// @def PROFILE_FUNCTION()
-/// @brief Creates a profiler entry for the current function.
-/// @note Uses the function name as the profiling entry name.
-#define PROFILE_FUNCTION() ProfilerEntry entry(__FUNCTION__)
+/// @brief Profiles the current function.
+/// @note Uses the function name as the scope name.
+#define PROFILE_FUNCTION() ProfilerScope PROFILE_CONCAT(profilerScope, __LINE__)(__FUNCTION__)
 
 /// @def PROFILE_SCOPE(name)
-/// @brief Creates a profiler entry for a custom named scope.
-/// @param name The name of the profiling entry.
-#define PROFILE_SCOPE(name) ProfilerEntry entry(name)
+/// @brief Profiles the rest of the current scope.
+/// @param name The name of the scope, a string literal or a name returned by Profiler::Intern.
+#define PROFILE_SCOPE(name) ProfilerScope PROFILE_CONCAT(profilerScope, __LINE__)(name)
 
 /// @def PROFILE_SCOPE_GPU(name, list)
-/// @brief Creates a profiler entry for GPU profiling within a named scope.
-/// @param name The name of the profiling entry.
+/// @brief Profiles the rest of the current scope on the CPU and the GPU.
+/// @param name The name of the scope, a string literal or a name returned by Profiler::Intern.
 /// @param list The command buffer associated with the GPU execution.
-#define PROFILE_SCOPE_GPU(name, list) ProfilerEntry entry(name, list)
+#define PROFILE_SCOPE_GPU(name, list) ProfilerScope PROFILE_CONCAT(profilerScope, __LINE__)(name, list)
@@ -29,6 +29,11 @@ void Project::Load(const String& path)
         auto& settings = root["settings"];
 
         Settings.PhysicsRefreshRate = settings.value("physicsRefreshRate", 90.0f);
+        Settings.MaxPhysicsSubsteps = settings.value("maxPhysicsSubsteps", 4u);
+        Settings.HitchBudget = settings.value("hitchBudget", 50.0f);
+        Settings.CookMemoryBudget = settings.value("cookMemoryBudget", 2048u);
+        Settings.AssetUploadBudget = settings.value("assetUploadBudget", 64u);
+        Settings.TextureStreamingBudget = settings.value("textureStreamingBudget", 1024u);
 
         String compressionFormat = settings.value("compressionFormat", "bc3");
         if (compressionFormat == "bc3")
@@ -56,6 +61,11 @@ void Project::Save(const String& path)
     
     // Save settings
     root["settings"]["physicsRefreshRate"] = Settings.PhysicsRefreshRate;
+    root["settings"]["maxPhysicsSubsteps"] = Settings.MaxPhysicsSubsteps;
+    root["settings"]["hitchBudget"] = Settings.HitchBudget;
+    root["settings"]["cookMemoryBudget"] = Settings.CookMemoryBudget;
+    root["settings"]["assetUploadBudget"] = Settings.AssetUploadBudget;
+    root["settings"]["textureStreamingBudget"] = Settings.TextureStreamingBudget;
     root["settings"]["compressionFormat"] = (Settings.Format == CompressionFormat::BC7) ? "bc7" : "bc3";
     
     // Write to file
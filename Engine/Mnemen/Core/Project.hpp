@@ -15,8 +15,13 @@ enum class CompressionFormat
 
 struct ProjectSettings
 {
-    CompressionFormat Format;
-    float PhysicsRefreshRate;
+    CompressionFormat Format = CompressionFormat::BC3;
+    float PhysicsRefreshRate = 90.0f;
+    UInt32 MaxPhysicsSubsteps = 4; // Physics steps allowed per frame before simulation time is dropped
+    float HitchBudget = 50.0f; // Frame time in milliseconds above which the profiler dumps its recent history, 0 disables it
+    UInt32 CookMemoryBudget = 2048; // Megabytes of decoded textures the asset cook keeps in flight across threads
+    UInt32 TextureStreamingBudget = 1024; // Megabytes of VRAM cooked textures may stream mips into, 0 keeps every mip resident
+    UInt32 AssetUploadBudget = 64; // Megabytes of asynchronously loaded assets turned into GPU resources per frame, at least one asset always goes through
 };
 
 struct Project
@@ -7,11 +7,15 @@
 
 #include <random>
 
+static std::mt19937 sGenerator(std::random_device{}());
+
 float Random::Float(float min, float max)
 {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-
     std::uniform_real_distribution<float> dis(min, max);
-    return dis(gen);
+    return dis(sGenerator);
+}
+
+void Random::Seed(UInt32 seed)
+{
+    sGenerator.seed(seed);
 }
\ No newline at end of file
@@ -24,4 +24,11 @@ public:
     /// @param max The maximum value for the generated random number.
     /// @return A random floating-point number between [min, max].
     static float Float(float min, float max);
+
+    /// @brief Reseeds the generator, so the same seed always gives the same sequence.
+    /// 
+    /// Used by the replay system to make recorded sessions deterministic.
+    /// 
+    /// @param seed The new seed.
+    static void Seed(UInt32 seed);
 };
\ No newline at end of file
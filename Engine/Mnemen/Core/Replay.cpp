@@ -0,0 +1,220 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-09 14:20:11
+//
+
+#include <Core/Replay.hpp>
+#include <Core/Logger.hpp>
+#include <Core/Random.hpp>
+
+#include <Input/Input.hpp>
+
+#include <cstddef>
+#include <random>
+
+Replay::Data Replay::sData;
+
+constexpr UInt8 REPLAY_FLAG_SCENE_PLAYING = 1 << 0;
+constexpr UInt8 REPLAY_FLAG_MOUSE = 1 << 1;
+
+struct ReplayHeader
+{
+    UInt32 Magic;
+    UInt32 Version;
+    UInt32 Seed; ///< Seed of the Random generator.
+    UInt32 FrameCount;
+};
+
+template<typename T>
+static void Write(std::fstream& stream, const T& value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool Read(std::fstream& stream, T& value)
+{
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return stream.good();
+}
+
+// Walks the frame records up to the end of the file, a partly written last frame isn't counted
+static UInt32 CountFrames(std::fstream& stream)
+{
+    stream.seekg(0, std::ios::end);
+    std::streamoff size = stream.tellg();
+    stream.seekg(sizeof(ReplayHeader));
+
+    UInt32 count = 0;
+    while (true) {
+        float deltaTime = 0.0f;
+        UInt8 flags = 0;
+        UInt16 eventCount = 0;
+        if (!Read(stream, deltaTime) || !Read(stream, flags))
+            break;
+        if (flags & REPLAY_FLAG_MOUSE)
+            stream.seekg(sizeof(glm::vec2) * 2, std::ios::cur);
+        if (!Read(stream, eventCount))
+            break;
+        stream.seekg(std::streamoff(eventCount) * (sizeof(InputEvent::Type) + sizeof(InputEvent::Button) + sizeof(InputEvent::Key)), std::ios::cur);
+        if (!stream.good() || stream.tellg() > size)
+            break;
+        count++;
+    }
+    stream.clear();
+    stream.seekg(sizeof(ReplayHeader));
+    return count;
+}
+
+bool Replay::BeginRecording(const String& path)
+{
+    End();
+
+    sData.Stream.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!sData.Stream.is_open()) {
+        LOG_ERROR("[Replay] Failed to open {0} for recording", path);
+        return false;
+    }
+
+    ReplayHeader header = {};
+    header.Magic = REPLAY_MAGIC;
+    header.Version = REPLAY_VERSION;
+    header.Seed = std::random_device{}();
+    header.FrameCount = 0; // Patched by End()
+    Write(sData.Stream, header);
+    Random::Seed(header.Seed);
+
+    sData.Mode = ReplayMode::Recording;
+    sData.Path = path;
+    sData.FrameCount = 0;
+    sData.FrameIndex = 0;
+    sData.MousePosition = Input::GetMousePosition();
+    sData.MouseDelta = Input::GetMouseDelta();
+
+    LOG_INFO("[Replay] Recording to {0}", path);
+    return true;
+}
+
+bool Replay::BeginPlayback(const String& path)
+{
+    End();
+
+    sData.Stream.open(path, std::ios::in | std::ios::binary);
+    if (!sData.Stream.is_open()) {
+        LOG_ERROR("[Replay] Failed to open {0}", path);
+        return false;
+    }
+
+    ReplayHeader header = {};
+    if (!Read(sData.Stream, header) || header.Magic != REPLAY_MAGIC) {
+        LOG_ERROR("[Replay] {0} isn't a replay file", path);
+        sData.Stream.close();
+        return false;
+    }
+    if (header.Version != REPLAY_VERSION) {
+        LOG_ERROR("[Replay] {0} has version {1}, expected {2}", path, header.Version, REPLAY_VERSION);
+        sData.Stream.close();
+        return false;
+    }
+    // Only End() writes the frame count, a session that crashed while recording still has 0 in there
+    if (header.FrameCount == 0) {
+        header.FrameCount = CountFrames(sData.Stream);
+        LOG_WARN("[Replay] {0} wasn't closed properly, found {1} frames in it", path, header.FrameCount);
+    }
+    Random::Seed(header.Seed);
+    Input::SetLiveInput(false);
+
+    sData.Mode = ReplayMode::Playing;
+    sData.Path = path;
+    sData.FrameCount = header.FrameCount;
+    sData.FrameIndex = 0;
+    sData.MousePosition = glm::vec2(0.0f);
+    sData.MouseDelta = glm::vec2(0.0f);
+
+    LOG_INFO("[Replay] Playing {0} frames from {1}", header.FrameCount, path);
+    return true;
+}
+
+void Replay::End()
+{
+    if (sData.Mode == ReplayMode::Recording) {
+        sData.Stream.seekp(offsetof(ReplayHeader, FrameCount));
+        Write(sData.Stream, sData.FrameCount);
+        LOG_INFO("[Replay] Recorded {0} frames to {1}", sData.FrameCount, sData.Path);
+    } else if (sData.Mode == ReplayMode::Playing) {
+        Input::SetLiveInput(true);
+        LOG_INFO("[Replay] Played {0} of {1} frames from {2}", sData.FrameIndex, sData.FrameCount, sData.Path);
+    }
+
+    if (sData.Stream.is_open())
+        sData.Stream.close();
+    sData.Mode = ReplayMode::None;
+}
+
+void Replay::RecordFrame(const ReplayFrame& frame)
+{
+    if (sData.Mode != ReplayMode::Recording)
+        return;
+
+    glm::vec2 position = Input::GetMousePosition();
+    glm::vec2 delta = Input::GetMouseDelta();
+    const Vector<InputEvent>& events = Input::GetFrameEvents();
+
+    UInt8 flags = 0;
+    if (frame.ScenePlaying)
+        flags |= REPLAY_FLAG_SCENE_PLAYING;
+    if (position != sData.MousePosition || delta != sData.MouseDelta)
+        flags |= REPLAY_FLAG_MOUSE;
+
+    Write(sData.Stream, frame.DeltaTime);
+    Write(sData.Stream, flags);
+    if (flags & REPLAY_FLAG_MOUSE) {
+        Write(sData.Stream, position);
+        Write(sData.Stream, delta);
+        sData.MousePosition = position;
+        sData.MouseDelta = delta;
+    }
+
+    Write(sData.Stream, UInt16(events.size()));
+    for (const InputEvent& event : events) {
+        Write(sData.Stream, event.Type);
+        Write(sData.Stream, event.Button);
+        Write(sData.Stream, event.Key);
+    }
+    sData.FrameCount++;
+}
+
+bool Replay::ReadFrame(ReplayFrame& frame)
+{
+    if (sData.Mode != ReplayMode::Playing || sData.FrameIndex >= sData.FrameCount)
+        return false;
+
+    UInt8 flags = 0;
+    UInt16 eventCount = 0;
+    if (!Read(sData.Stream, frame.DeltaTime) || !Read(sData.Stream, flags)) {
+        LOG_ERROR("[Replay] {0} is truncated at frame {1}", sData.Path, sData.FrameIndex);
+        return false;
+    }
+    frame.ScenePlaying = flags & REPLAY_FLAG_SCENE_PLAYING;
+    if (flags & REPLAY_FLAG_MOUSE) {
+        Read(sData.Stream, sData.MousePosition);
+        Read(sData.Stream, sData.MouseDelta);
+    }
+    Input::SetMouseState(sData.MousePosition, sData.MouseDelta);
+
+    Read(sData.Stream, eventCount);
+    for (UInt16 i = 0; i < eventCount; i++) {
+        InputEvent event = {};
+        Read(sData.Stream, event.Type);
+        Read(sData.Stream, event.Button);
+        Read(sData.Stream, event.Key);
+        Input::ProcessEvent(event);
+    }
+
+    if (!sData.Stream.good()) {
+        LOG_ERROR("[Replay] {0} is truncated at frame {1}", sData.Path, sData.FrameIndex);
+        return false;
+    }
+    sData.FrameIndex++;
+    return true;
+}
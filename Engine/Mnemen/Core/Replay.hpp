@@ -0,0 +1,86 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-09 14:02:37
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+#include <glm/glm.hpp>
+#include <fstream>
+
+constexpr UInt32 REPLAY_MAGIC = 0x4C50524D; ///< "MRPL", little endian.
+constexpr UInt32 REPLAY_VERSION = 1; ///< Bumped whenever the frame layout changes.
+
+/// @brief What the replay system is doing.
+enum class ReplayMode
+{
+    None,      ///< Input and time come from the OS.
+    Recording, ///< Every frame is written to the replay file.
+    Playing    ///< Every frame is read from the replay file.
+};
+
+/// @brief The parts of a frame the application drives, rather than the input system.
+struct ReplayFrame
+{
+    float DeltaTime = 0.0f; ///< Frame time, in seconds.
+    bool ScenePlaying = false; ///< Whether the scene was playing during the frame.
+};
+
+/// @brief Records a session's input, frame times and scene transitions, and plays them back.
+///
+/// A replay file is a small header followed by one record per frame:
+/// - The delta time.
+/// - A flag byte: scene playing, and whether the mouse moved.
+/// - The mouse position and delta, only if the mouse moved.
+/// - The input events received during the previous frame.
+///
+/// Playing a file back drives the application with the recorded delta times instead of the wall clock,
+/// so two runs of the same session do the same simulation work and their profiles can be compared.
+class Replay
+{
+public:
+    /// @brief Starts writing frames to a file and reseeds Random with a seed stored in the file.
+    /// @param path Path of the replay file.
+    /// @return Whether the file could be opened.
+    static bool BeginRecording(const String& path);
+
+    /// @brief Starts reading frames from a file, ignores the OS input, and reseeds Random with the recorded seed.
+    /// @param path Path of the replay file.
+    /// @return Whether the file is a valid replay.
+    static bool BeginPlayback(const String& path);
+
+    /// @brief Closes the replay file and gives input back to the OS.
+    static void End();
+
+    /// @brief Writes a frame, along with the input state accumulated since the last one.
+    /// @param frame The frame to write.
+    static void RecordFrame(const ReplayFrame& frame);
+
+    /// @brief Reads the next frame and feeds its input to the input system.
+    /// @param frame Receives the frame.
+    /// @return False once every frame was played.
+    static bool ReadFrame(ReplayFrame& frame);
+
+    /// @brief Gets what the replay system is doing.
+    static ReplayMode GetMode() { return sData.Mode; }
+
+    /// @brief Returns whether a file is being recorded or played.
+    static bool IsActive() { return sData.Mode != ReplayMode::None; }
+
+    /// @brief Gets the number of frames in the file being played, or written so far.
+    static UInt32 GetFrameCount() { return sData.FrameCount; }
+private:
+    static struct Data {
+        ReplayMode Mode = ReplayMode::None;
+        std::fstream Stream;
+        String Path;
+
+        UInt32 FrameCount = 0; ///< Frames in the file.
+        UInt32 FrameIndex = 0; ///< Next frame to read.
+
+        glm::vec2 MousePosition = glm::vec2(0.0f); ///< Last mouse position written or read.
+        glm::vec2 MouseDelta = glm::vec2(0.0f); ///< Last mouse delta written or read.
+    } sData;
+};
@@ -4,12 +4,22 @@
 //
 
 #include "Statistics.hpp"
+
+#include <Core/Memory.hpp>
+
+#if defined(_WIN32)
 #include <Windows.h>
 #include <Psapi.h>
+#else
+#include <fstream>
+#include <sstream>
+#endif
 
+#if defined(_WIN32)
 void Statistics::Update()
 {
     Statistics& stats = Get();
+    stats.TrackedRAM = Memory::GetTotalLiveBytes();
 
     // Ram
     {
@@ -33,3 +43,41 @@ void Statistics::Update()
         stats.Battery = status.BatteryLifePercent;
     }
 }
+#else
+// Reads a "Key: value kB" line from a /proc file.
+static UInt64 ReadProcKilobytes(const char* path, const String& key)
+{
+    std::ifstream stream(path);
+    String line;
+    while (std::getline(stream, line)) {
+        if (line.compare(0, key.size(), key) == 0 && line.size() > key.size() && line[key.size()] == ':') {
+            std::istringstream value(line.substr(key.size() + 1));
+            UInt64 kilobytes = 0;
+            value >> kilobytes;
+            return kilobytes * 1024;
+        }
+    }
+    return 0;
+}
+
+void Statistics::Update()
+{
+    Statistics& stats = Get();
+    stats.TrackedRAM = Memory::GetTotalLiveBytes();
+
+    // Ram
+    {
+        stats.UsedRAM = ReadProcKilobytes("/proc/self/status", "VmRSS");
+        stats.MaxRAM = ReadProcKilobytes("/proc/meminfo", "MemTotal");
+    }
+
+    // Battery, desktops without one report a full charge like Windows does
+    {
+        std::ifstream capacity("/sys/class/power_supply/BAT0/capacity");
+        int battery = 100;
+        if (capacity.is_open())
+            capacity >> battery;
+        stats.Battery = battery;
+    }
+}
+#endif
@@ -7,20 +7,16 @@
 
 Timer::Timer()
 {
-    QueryPerformanceFrequency(&mFrequency);
-    QueryPerformanceCounter(&mStart);
+    mStart = std::chrono::steady_clock::now();
 }
 
 float Timer::GetElapsed()
 {
-    LARGE_INTEGER end;
-
-    QueryPerformanceCounter(&end);
-
-    return (end.QuadPart - mStart.QuadPart) * 1000.0 / mFrequency.QuadPart;
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - mStart;
+    return static_cast<float>(elapsed.count());
 }
 
 void Timer::Restart()
 {
-    QueryPerformanceCounter(&mStart);
+    mStart = std::chrono::steady_clock::now();
 }
\ No newline at end of file
@@ -7,7 +7,7 @@
 
 #define TO_SECONDS(Value) Value / 1000.0f
 
-#include <Windows.h>
+#include <chrono>
 
 /// @brief A class for measuring elapsed time.
 /// 
@@ -35,9 +35,6 @@ public:
     void Restart();
 
 private:
-    /// @brief The frequency of the high-resolution timer (ticks per second).
-    LARGE_INTEGER mFrequency;
-
     /// @brief The timestamp of when the timer was started.
-    LARGE_INTEGER mStart;
+    std::chrono::steady_clock::time_point mStart;
 };
\ No newline at end of file
@@ -124,46 +124,78 @@ void Input::Init()
 
 void Input::Update(SDL_Event* event)
 {
-    UInt64 timestamp = SDL_GetTicks();
-
-    sData.MousePos = GetMousePosition();
+    if (!sData.LiveInput)
+        return;
 
     switch (event->type) {
         case SDL_EVENT_KEY_DOWN: {
-            SDL_Keycode key = event->key.key;
-            if (event->key.repeat) {
-                sData.Keys[key].State = KeyState::Held;
-            } else {
-                sData.Keys[key].State = KeyState::Pressed;
-            }
-            sData.Keys[key].TimeStamp = timestamp;
+            ProcessEvent({ event->key.repeat ? InputEventType::KeyRepeat : InputEventType::KeyDown, 0, event->key.key });
             break;
         };
         case SDL_EVENT_KEY_UP: {
-            SDL_Keycode key = event->key.key;
-            sData.Keys[key].State = KeyState::Up;
-            sData.Keys[key].TimeStamp = timestamp;
+            ProcessEvent({ InputEventType::KeyUp, 0, event->key.key });
             break;
         };
         case SDL_EVENT_MOUSE_BUTTON_DOWN: {
-            sData.Buttons[event->button.button] = true;
+            ProcessEvent({ InputEventType::ButtonDown, event->button.button, 0 });
             break;
         };
         case SDL_EVENT_MOUSE_BUTTON_UP: {
-            sData.Buttons[event->button.button] = false;
+            ProcessEvent({ InputEventType::ButtonUp, event->button.button, 0 });
+            break;
+        };
+    }
+}
+
+void Input::ProcessEvent(const InputEvent& event)
+{
+    switch (event.Type) {
+        case InputEventType::KeyDown: {
+            sData.Keys[event.Key].State = KeyState::Pressed;
+            sData.Keys[event.Key].TimeStamp = sData.Frame;
+            break;
+        };
+        case InputEventType::KeyRepeat: {
+            sData.Keys[event.Key].State = KeyState::Held;
+            sData.Keys[event.Key].TimeStamp = sData.Frame;
+            break;
+        };
+        case InputEventType::KeyUp: {
+            sData.Keys[event.Key].State = KeyState::Up;
+            sData.Keys[event.Key].TimeStamp = sData.Frame;
+            break;
+        };
+        case InputEventType::ButtonDown: {
+            sData.Buttons[event.Button] = true;
+            break;
+        };
+        case InputEventType::ButtonUp: {
+            sData.Buttons[event.Button] = false;
             break;
         };
     }
+    sData.FrameEvents.push_back(event);
 }
 
 void Input::PostUpdate()
 {
-    sData.MouseDelta = GetMousePosition() - sData.MousePos;
+    // Keys are timestamped with input frames rather than wall-clock time, so a replayed session
+    // sees a key as pressed for exactly as many frames as the recorded one did.
+    sData.Frame++;
+    sData.FrameEvents.clear();
+
+    if (sData.LiveInput) {
+        Float32 x, y;
+        SDL_GetGlobalMouseState(&x, &y);
+
+        glm::vec2 position(x, y);
+        sData.MouseDelta = position - sData.MousePos;
+        sData.MousePos = position;
+    }
 
     for (auto& key : sData.Keys) {
-        UInt64 timestamp = SDL_GetTicks();
-        if (sData.Keys[key.first].State == KeyState::Pressed && sData.Keys[key.first].TimeStamp != timestamp)
-            sData.Keys[key.first].State = KeyState::Held;
+        if (key.second.State == KeyState::Pressed && key.second.TimeStamp != sData.Frame)
+            key.second.State = KeyState::Held;
     }
 }
 
@@ -204,12 +236,21 @@ bool Input::IsButtonUp(UInt8 button)
 
 glm::vec2 Input::GetMousePosition()
 {
-    Float32 x, y;
-    SDL_GetGlobalMouseState(&x, &y);
-    return glm::vec2(x, y);
+    return sData.MousePos;
 }
 
 glm::vec2 Input::GetMouseDelta()
 {
     return sData.MouseDelta;
 }
+
+void Input::SetLiveInput(bool enabled)
+{
+    sData.LiveInput = enabled;
+}
+
+void Input::SetMouseState(glm::vec2 position, glm::vec2 delta)
+{
+    sData.MousePos = position;
+    sData.MouseDelta = delta;
+}
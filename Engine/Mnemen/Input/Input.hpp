@@ -22,6 +22,27 @@ enum class KeyState
     Up       ///< The key has been released.
 };
 
+/// @brief The kind of an input event.
+enum class InputEventType : UInt8
+{
+    KeyDown,    ///< A key went down.
+    KeyRepeat,  ///< The OS repeated a key that is held down.
+    KeyUp,      ///< A key was released.
+    ButtonDown, ///< A mouse button went down.
+    ButtonUp    ///< A mouse button was released.
+};
+
+/// @brief A key or mouse button change, stripped of everything the input system doesn't use.
+/// 
+/// Unlike SDL events, input events don't carry timestamps, so they can be recorded and fed back
+/// to the input system to reproduce a session (see Replay).
+struct InputEvent
+{
+    InputEventType Type; ///< What happened.
+    UInt8 Button = 0; ///< The mouse button, for button events.
+    SDL_Keycode Key = 0; ///< The key, for key events.
+};
+
 /// @brief A system for handling input events from the user.
 /// 
 /// The `Input` class provides static methods for initializing, updating, and querying the 
@@ -44,6 +65,13 @@ public:
     /// @param event The SDL event to process.
     static void Update(SDL_Event* event);
 
+    /// @brief Applies an input event to the key and button states.
+    /// 
+    /// SDL events go through this once translated, the replay system calls it directly.
+    /// 
+    /// @param event The event to apply.
+    static void ProcessEvent(const InputEvent& event);
+
     /// @brief Sets flags that the input system will use in the next frame.
     /// 
     /// This method prepares the input system for the next frame, setting any flags or 
@@ -106,7 +134,7 @@ public:
 
     /// @brief Returns the current mouse position.
     /// 
-    /// This method retrieves the current position of the mouse relative to the window.
+    /// This method retrieves the position of the mouse, sampled once per frame by PostUpdate.
     /// 
     /// @return The current mouse position as a `glm::vec2`.
     static glm::vec2 GetMousePosition();
@@ -118,11 +146,30 @@ public:
     /// @return The mouse delta as a `glm::vec2`.
     static glm::vec2 GetMouseDelta();
 
+    /// @brief Returns the events received since the last PostUpdate.
+    /// 
+    /// @return The events, in the order they were applied.
+    static const Vector<InputEvent>& GetFrameEvents() { return sData.FrameEvents; }
+
+    /// @brief Enables or disables input coming from the OS.
+    /// 
+    /// While disabled, SDL events and the real mouse are ignored, and the state only changes
+    /// through ProcessEvent and SetMouseState. Used when replaying a recorded session.
+    /// 
+    /// @param enabled Whether to listen to the OS.
+    static void SetLiveInput(bool enabled);
+
+    /// @brief Overrides the mouse position and delta until the next call.
+    /// 
+    /// @param position The mouse position.
+    /// @param delta The mouse delta.
+    static void SetMouseState(glm::vec2 position, glm::vec2 delta);
+
 private:
     /// @brief Holds the state information for a single key.
     struct KeyInfo {
         KeyState State; ///< The current state of the key (pressed, held, or up).
-        UInt64 TimeStamp; ///< The timestamp when the key state was last updated.
+        UInt64 TimeStamp; ///< The input frame in which the key state was last updated.
     };
 
     /// @brief Holds input data for the current frame.
@@ -133,6 +180,10 @@ private:
 
         UnorderedMap<UInt8, bool> Buttons; ///< The state of the mouse buttons.
         UnorderedMap<SDL_Keycode, KeyInfo> Keys; ///< The state of the keys.
+
+        Vector<InputEvent> FrameEvents; ///< Events received since the last PostUpdate.
+        UInt64 Frame = 0; ///< Number of PostUpdate calls, used to turn pressed keys into held keys.
+        bool LiveInput = true; ///< Whether SDL events and the real mouse are listened to.
     };
 
     /// @brief Static instance of the input data.
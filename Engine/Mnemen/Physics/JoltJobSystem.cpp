@@ -0,0 +1,56 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-03 10:22:53
+//
+
+#include "JoltJobSystem.hpp"
+
+#include <Core/JobSystem.hpp>
+
+// NOTE(amelie): Inside the adapter, JobSystem and Job name Jolt's types, hence the :: everywhere we talk to the engine scheduler.
+
+JoltJobSystem::JoltJobSystem(JPH::uint maxJobs, JPH::uint maxBarriers)
+    : JPH::JobSystemWithBarrier(maxBarriers)
+{
+    mJobs.Init(maxJobs, maxJobs);
+}
+
+int JoltJobSystem::GetMaxConcurrency() const
+{
+    return static_cast<int>(::JobSystem::GetThreadCount());
+}
+
+JoltJobSystem::JobHandle JoltJobSystem::CreateJob(const char* name, JPH::ColorArg color, const JobFunction& function, JPH::uint32 numDependencies)
+{
+    JPH::uint32 index = mJobs.ConstructObject(name, color, this, function, numDependencies);
+    JPH_ASSERT(index != decltype(mJobs)::cInvalidObjectIndex);
+    Job* job = &mJobs.Get(index);
+
+    // The handle keeps a reference so the job survives until the caller is done with it
+    JobHandle handle(job);
+    if (numDependencies == 0)
+        QueueJob(job);
+    return handle;
+}
+
+void JoltJobSystem::QueueJob(Job* job)
+{
+    // Held until the engine job ran, released right after
+    job->AddRef();
+    ::JobSystem::Run(::JobSystem::CreateJob([job]() {
+        job->Execute();
+        job->Release();
+    }), JobPriority::High);
+}
+
+void JoltJobSystem::QueueJobs(Job** jobs, JPH::uint jobCount)
+{
+    for (JPH::uint i = 0; i < jobCount; i++) {
+        QueueJob(jobs[i]);
+    }
+}
+
+void JoltJobSystem::FreeJob(Job* job)
+{
+    mJobs.DestructObject(job);
+}
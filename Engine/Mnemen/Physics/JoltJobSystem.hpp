@@ -0,0 +1,36 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-03 10:22:47
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
+
+/// @brief Jolt job system that forwards every physics job to the engine's JobSystem.
+///
+/// Jolt jobs are still allocated from Jolt's own free list (they carry dependency counts and barriers),
+/// but their execution happens on the engine workers at high priority, so physics shares one pool of
+/// threads with the rest of the engine instead of spawning its own.
+class JoltJobSystem final : public JPH::JobSystemWithBarrier
+{
+public:
+    /// @brief Creates the adapter.
+    /// @param maxJobs Maximum number of Jolt jobs alive at once.
+    /// @param maxBarriers Maximum number of barriers alive at once.
+    JoltJobSystem(JPH::uint maxJobs, JPH::uint maxBarriers);
+    ~JoltJobSystem() override = default;
+
+    int GetMaxConcurrency() const override;
+    JobHandle CreateJob(const char* name, JPH::ColorArg color, const JobFunction& function, JPH::uint32 numDependencies = 0) override;
+protected:
+    void QueueJob(Job* job) override;
+    void QueueJobs(Job** jobs, JPH::uint jobCount) override;
+    void FreeJob(Job* job) override;
+private:
+    JPH::FixedSizeFreeList<Job> mJobs;
+};
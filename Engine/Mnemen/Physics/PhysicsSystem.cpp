@@ -6,6 +6,7 @@
 #include "PhysicsSystem.hpp"
 
 #include <Core/Logger.hpp>
+#include <Core/Memory.hpp>
 
 PhysicsSystem::Data PhysicsSystem::sData;
 
@@ -125,13 +126,40 @@ public:
     }
 };
 
+// Jolt allocation hooks, so everything Jolt allocates shows up under the Physics memory tag
+static void* JoltAllocate(size_t size)
+{
+    return Memory::Allocate(size, MemoryTag::Physics);
+}
+
+static void* JoltReallocate(void* block, size_t oldSize, size_t newSize)
+{
+    return Memory::Reallocate(block, newSize, MemoryTag::Physics);
+}
+
+static void* JoltAlignedAllocate(size_t size, size_t alignment)
+{
+    return Memory::Allocate(size, MemoryTag::Physics, alignment);
+}
+
+static void JoltFree(void* block)
+{
+    Memory::Free(block);
+}
+
 BPLayerInterfaceImpl JoltBroadphaseLayerInterface = BPLayerInterfaceImpl();
 ObjectVsBroadPhaseLayerFilterImpl JoltObjectVSBroadphaseLayerFilter = ObjectVsBroadPhaseLayerFilterImpl();
 ObjectLayerPairFilterImpl JoltObjectVSObjectLayerFilter;
 
-void PhysicsSystem::Init()
+void PhysicsSystem::Init(PhysicsJobBackend backend)
 {
-    JPH::RegisterDefaultAllocator();
+    JPH::Allocate = JoltAllocate;
+#if JPH_VERSION_MAJOR >= 5
+    JPH::Reallocate = JoltReallocate;
+#endif
+    JPH::Free = JoltFree;
+    JPH::AlignedAllocate = JoltAlignedAllocate;
+    JPH::AlignedFree = JoltFree;
     JPH::Factory::sInstance = new JPH::Factory();
 
     JPH::RegisterTypes();
@@ -149,7 +177,11 @@ void PhysicsSystem::Init()
     sData.System->SetGravity(JPH::Vec3(0.0f, -3.0f, 0.0f));
 
     sData.BodyInterface = &sData.System->GetBodyInterface();
-    sData.JobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+    if (backend == PhysicsJobBackend::Engine) {
+        sData.JobSystem = new JoltJobSystem(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+    } else {
+        sData.JobSystem = new JPH::JobSystemThreadPool(JPH::cMaxPhysicsJobs, JPH::cMaxPhysicsBarriers);
+    }
     sData.DebugDraw = new PhysicsDebugDraw;
 
     JPH::DebugRenderer::sInstance = sData.DebugDraw;
@@ -172,13 +204,15 @@ void PhysicsSystem::Exit()
     JPH::Factory::sInstance = nullptr;
 }
 
-void PhysicsSystem::Update(Ref<Scene> scene, float minStepDuration)
+void PhysicsSystem::Update(Ref<Scene> scene, float stepDuration)
 {
+    MemoryScope memoryScope(MemoryTag::Physics);
+
     int collisionSteps = 1;
     try {
         auto allocator = MakeRef<JPH::TempAllocatorMalloc>();
 
-        auto error = sData.System->Update(minStepDuration, collisionSteps, allocator.get(), sData.JobSystem);
+        auto error = sData.System->Update(stepDuration, collisionSteps, allocator.get(), sData.JobSystem);
         if (error != JPH::EPhysicsUpdateError::None) {
             const char* errMessage = "";
             switch (error) {
@@ -198,11 +232,11 @@ void PhysicsSystem::Update(Ref<Scene> scene, float minStepDuration)
         LOG_CRITICAL("Jolt failed to update physics!");
     }
 
-    // Update transforms
+    // Record poses, the transforms are written by Interpolate once the frame is done stepping
     auto registry = scene->GetRegistry();
-    auto view = registry->view<TransformComponent, Rigidbody>();
+    auto view = registry->view<Rigidbody>();
 
-    for (auto [id, transform, rb] : view.each()) {
+    for (auto [id, rb] : view.each()) {
         auto body = rb.GetBody();
         if (!body)
             continue;
@@ -210,8 +244,26 @@ void PhysicsSystem::Update(Ref<Scene> scene, float minStepDuration)
         JPH::Vec3 pos = body->GetCenterOfMassPosition();
         JPH::Quat rot = body->GetRotation();
 
-        transform.Position = glm::vec3(pos.GetX(), pos.GetY(), pos.GetZ());
-        transform.Rotation = glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ());
+        rb.PreviousPosition = rb.CurrentPosition;
+        rb.PreviousRotation = rb.CurrentRotation;
+        rb.CurrentPosition = glm::vec3(pos.GetX(), pos.GetY(), pos.GetZ());
+        rb.CurrentRotation = glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ());
+    }
+}
+
+void PhysicsSystem::Interpolate(Ref<Scene> scene, float alpha)
+{
+    alpha = glm::clamp(alpha, 0.0f, 1.0f);
+
+    auto registry = scene->GetRegistry();
+    auto view = registry->view<TransformComponent, Rigidbody>();
+
+    for (auto [id, transform, rb] : view.each()) {
+        if (!rb.GetBody())
+            continue;
+
+        transform.Position = glm::mix(rb.PreviousPosition, rb.CurrentPosition, alpha);
+        transform.Rotation = glm::slerp(rb.PreviousRotation, rb.CurrentRotation, alpha);
     }
 }
 
@@ -225,6 +277,14 @@ void PhysicsSystem::OnAwake(Ref<Scene> scene)
             continue;
         
         sData.BodyInterface->AddBody(rb.GetBody()->GetID(), JPH::EActivation::Activate);
+
+        // Start from the body's pose so the first frames don't blend from a stale one
+        JPH::Vec3 pos = rb.GetBody()->GetCenterOfMassPosition();
+        JPH::Quat rot = rb.GetBody()->GetRotation();
+        rb.CurrentPosition = glm::vec3(pos.GetX(), pos.GetY(), pos.GetZ());
+        rb.CurrentRotation = glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ());
+        rb.PreviousPosition = rb.CurrentPosition;
+        rb.PreviousRotation = rb.CurrentRotation;
     }
     sData.System->OptimizeBroadPhase();
 }
@@ -38,6 +38,7 @@
 #include <Jolt/Physics/Collision/ShapeCast.h>
 
 #include "PhysicsDebugDraw.hpp"
+#include "JoltJobSystem.hpp"
 
 class BPLayerInterfaceImpl;
 class MyContactListener;
@@ -52,12 +53,27 @@ namespace PhysicsLayers
     static constexpr UInt8 NUM_LAYERS = 5;
 };
 
+/// @brief Which scheduler runs Jolt's internal jobs.
+enum class PhysicsJobBackend
+{
+    Engine, ///< Jolt jobs go through the engine JobSystem (default)
+    JoltThreadPool ///< Jolt spawns its own thread pool, kept around for comparison
+};
+
 class PhysicsSystem
 {
 public:
-    static void Init();
+    static void Init(PhysicsJobBackend backend = PhysicsJobBackend::Engine);
     static void Exit();
-    static void Update(Ref<Scene> scene, float minStepDuration);
+    /// @brief Advances the simulation by exactly one fixed step and records the resulting body poses.
+    /// @param scene The scene owning the rigidbodies.
+    /// @param stepDuration The fixed step, in seconds. Always pass the same value to keep the simulation deterministic.
+    static void Update(Ref<Scene> scene, float stepDuration);
+
+    /// @brief Writes the pose between the last two steps into the transforms, for rendering.
+    /// @param scene The scene owning the rigidbodies.
+    /// @param alpha How far we are between the previous step (0) and the current one (1).
+    static void Interpolate(Ref<Scene> scene, float alpha);
 
     static void OnAwake(Ref<Scene> scene);
     static void OnStop(Ref<Scene> scene);
@@ -66,7 +82,7 @@ public:
 private:
     static struct Data {
         JPH::PhysicsSystem* System;
-        JPH::JobSystemThreadPool* JobSystem;
+        JPH::JobSystem* JobSystem;
         JPH::BodyInterface* BodyInterface;
         PhysicsDebugDraw* DebugDraw;
 
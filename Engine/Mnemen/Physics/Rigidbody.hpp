@@ -7,6 +7,8 @@
 
 #include "Colliders.hpp"
 
+#include <glm/gtc/quaternion.hpp>
+
 class Rigidbody
 {
 public:
@@ -17,6 +19,12 @@ public:
     void Create(PhysicsShape& shape, float mass = 1.0f, bool isStatic = false);
 
     JPH::Body* GetBody() { return mBody; }
+
+    // Body pose after the last two physics steps, blended by PhysicsSystem::Interpolate
+    glm::vec3 PreviousPosition = glm::vec3(0.0f);
+    glm::quat PreviousRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 CurrentPosition = glm::vec3(0.0f);
+    glm::quat CurrentRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
 private:
     JPH::Body* mBody = nullptr;
 };
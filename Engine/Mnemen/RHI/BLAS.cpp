@@ -15,7 +15,7 @@ BLAS::BLAS(Device::Ref device, DescriptorHeaps& heaps, Buffer::Ref vertex, Buffe
     // mGeometryDesc.Triangles.IndexCount = idxCount;
     // mGeometryDesc.Triangles.IndexFormat = DXGI_FORMAT_R32_UINT;
     // mGeometryDesc.Triangles.VertexCount = vtxCount;
-    // mGeometryDesc.Triangles.VertexFormat = DXGI_FORMAT_R32G32B32_FLOAT;
+    // mGeometryDesc.Triangles.VertexFormat = DXGI_FORMAT_R16G16B16A16_UNORM; // Packed positions, the primitive's Dequantize matrix goes in Transform3x4
     // mGeometryDesc.Triangles.VertexBuffer.StartAddress = vertex->GetAddress();
     // mGeometryDesc.Triangles.VertexBuffer.StrideInBytes = vertex->GetStride();
     // mGeometryDesc.Triangles.Transform3x4 = 0;
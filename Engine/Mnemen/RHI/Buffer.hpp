@@ -129,5 +129,9 @@ private:
 
     D3D12_VERTEX_BUFFER_VIEW mVBV; ///< Vertex Buffer View, used for vertex buffers.
     D3D12_INDEX_BUFFER_VIEW mIBV; ///< Index Buffer View, used for index buffers.
+
+#if defined(MNEMEN_RHI_NULL)
+    Vector<UInt8> mHostMemory; ///< CPU memory handed out by Map() in the null backend.
+#endif
 };
 
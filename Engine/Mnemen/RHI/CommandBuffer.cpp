@@ -7,7 +7,7 @@
 #include <RHI/Utilities.hpp>
 
 #include <Core/Assert.hpp>
-#include <Core/Statistics.hpp>
+#include <Core/Counters.hpp>
 
 #include <imgui.h>
 #include <imgui_impl_dx12.h>
@@ -16,6 +16,12 @@
 
 #include <PIX/pix3.h>
 
+static Counter sDrawCalls("Draw Calls");
+static Counter sDispatches("Dispatches");
+static Counter sBarriers("Barriers");
+static Counter sTriangles("Triangles");
+static Counter sMeshlets("Meshlets");
+
 CommandBuffer::CommandBuffer(Device::Ref device, Queue::Ref queue, DescriptorHeaps heaps, bool singleTime)
     : mSingleTime(singleTime), mParentQueue(queue), mHeaps(heaps), mDevice(device)
 {
@@ -57,6 +63,7 @@ void CommandBuffer::UAVBarrier(::Ref<Resource> resource)
     Barrier.UAV.pResource = resource->GetResource();
 
     mList->ResourceBarrier(1, &Barrier);
+    sBarriers.Increment();
 }
 
 void CommandBuffer::Barrier(::Ref<Resource> resource, ResourceLayout layout, UInt32 mip)
@@ -78,6 +85,7 @@ void CommandBuffer::Barrier(::Ref<Resource> resource, ResourceLayout layout, UIn
     
     mList->ResourceBarrier(1, &Barrier);
     resource->SetLayout(layout);
+    sBarriers.Increment();
 }
 
 void CommandBuffer::SetViewport(float x, float y, float width, float height)
@@ -126,16 +134,19 @@ void CommandBuffer::SetComputePipeline(ComputePipeline::Ref pipeline)
     mList->SetComputeRootSignature(pipeline->GetSignature()->GetSignature());
 }
 
-void CommandBuffer::SetRenderTargets(const Vector<View::Ref> targets, View::Ref depth)
+void CommandBuffer::SetRenderTargets(std::initializer_list<View::Ref> targets, View::Ref depth)
 {
-    Vector<D3D12_CPU_DESCRIPTOR_HANDLE> cpus;
+    ASSERT(targets.size() <= D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT, "Too many render targets!");
+
+    Array<D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT> cpus;
+    UInt32 count = 0;
     for (auto& target : targets) {
-        cpus.push_back(target->GetDescriptor().CPU);
+        cpus[count++] = target->GetDescriptor().CPU;
     }
     D3D12_CPU_DESCRIPTOR_HANDLE depth_cpu = {};
     if (depth) depth_cpu = depth->GetDescriptor().CPU;
 
-    mList->OMSetRenderTargets(cpus.size(), cpus.data(), false, depth ? &depth_cpu : nullptr);
+    mList->OMSetRenderTargets(count, cpus.data(), false, depth ? &depth_cpu : nullptr);
 }
 
 void CommandBuffer::SetVertexBuffer(Buffer::Ref buffer)
@@ -172,28 +183,28 @@ void CommandBuffer::ClearRenderTarget(View::Ref view, float r, float g, float b)
 void CommandBuffer::Draw(int vertexCount)
 {
     mList->DrawInstanced(vertexCount, 1, 0, 0);
-    Statistics::Get().DrawCallCount++;
+    sDrawCalls.Increment();
 }
 
 void CommandBuffer::DispatchMesh(int meshletCount, int triangleCount)
 {
     mList->DispatchMesh(meshletCount, 1, 1);
-    Statistics::Get().MeshletCount += meshletCount;
-    Statistics::Get().TriangleCount += triangleCount;
-    Statistics::Get().DrawCallCount++;
+    sMeshlets.Add(meshletCount);
+    sTriangles.Add(triangleCount);
+    sDrawCalls.Increment();
 }
 
 void CommandBuffer::DrawIndexed(int indexCount)
 {
     mList->DrawIndexedInstanced(indexCount, 1, 0, 0, 0);
-    Statistics::Get().TriangleCount += indexCount / 3;
-    Statistics::Get().DrawCallCount++;
+    sTriangles.Add(indexCount / 3);
+    sDrawCalls.Increment();
 }
 
 void CommandBuffer::Dispatch(int x, int y, int z)
 {
     mList->Dispatch(x, y, z);
-    Statistics::Get().DispatchCount += 1;
+    sDispatches.Increment();
 }
 
 void CommandBuffer::CopyBufferToBuffer(::Ref<Resource> dst, ::Ref<Resource> src)
@@ -257,9 +268,9 @@ void CommandBuffer::End()
     mList->Close();
 }
 
-void CommandBuffer::BeginMarker(const String& name)
+void CommandBuffer::BeginMarker(const char* name)
 {
-    PIXBeginEvent(mList, PIX_COLOR_DEFAULT, name.data());
+    PIXBeginEvent(mList, PIX_COLOR_DEFAULT, name);
 }
 
 void CommandBuffer::EndMarker()
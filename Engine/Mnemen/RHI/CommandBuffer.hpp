@@ -15,6 +15,10 @@
 #include <RHI/AccelerationStructure.hpp>
 #include <RHI/TLAS.hpp>
 
+#if defined(MNEMEN_RHI_NULL)
+    #include <RHI/Null/NullCommand.hpp>
+#endif
+
 /// @brief Enum for different primitive topologies.
 enum class Topology
 {
@@ -66,10 +70,10 @@ public:
     void End();
 
     /// @brief Marks the beginning of a debug section.
-    /// @param name The name of the debug marker.
+    /// @param name The name of the debug marker. Takes a C string so literal names don't build a String every frame.
     ///
     /// This helps with GPU debugging and profiling by adding a named section.
-    void BeginMarker(const String& name);
+    void BeginMarker(const char* name);
 
     /// @brief Marks the end of a debug section.
     ///
@@ -128,8 +132,8 @@ public:
     /// @param targets The color render targets.
     /// @param depth The depth buffer target.
     ///
-    /// These define the surfaces where rendered images are stored.
-    void SetRenderTargets(const Vector<View::Ref> targets, View::Ref depth);
+    /// These define the surfaces where rendered images are stored. Takes an initializer list so binding targets doesn't allocate.
+    void SetRenderTargets(std::initializer_list<View::Ref> targets, View::Ref depth);
 
     /// @brief Binds a vertex buffer.
     /// @param buffer The vertex buffer to bind.
@@ -244,6 +248,11 @@ public:
     /// @brief Converts the command buffer to a raw Direct3D command list.
     operator ID3D12CommandList*() { return mList; }
 
+#if defined(MNEMEN_RHI_NULL)
+    /// @brief Gets the commands recorded since the last call to Begin(). Null backend only.
+    const Vector<NullCommand>& GetCommands() const { return mCommands; }
+#endif
+
 private:
     bool mSingleTime; ///< Indicates whether the command buffer is a single-use buffer.
     Device::Ref mDevice; ///< Reference to the device that owns this command buffer.
@@ -251,5 +260,9 @@ private:
     DescriptorHeaps mHeaps; ///< Descriptor heap manager for resource binding.
     ID3D12CommandAllocator* mAllocator; ///< D3D12 command allocator used for memory management of command lists.
     ID3D12GraphicsCommandList10* mList; ///< D3D12 graphics command list used to record commands.
+
+#if defined(MNEMEN_RHI_NULL)
+    Vector<NullCommand> mCommands; ///< Commands recorded by the null backend, cleared but never shrunk.
+#endif
 };
 
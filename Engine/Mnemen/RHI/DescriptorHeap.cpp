@@ -7,6 +7,18 @@
 #include <RHI/Utilities.hpp>
 #include <Core/Assert.hpp>
 
+DescriptorHeap::Descriptor::Descriptor(DescriptorHeap* heap, int index)
+    : Parent(heap), Index(index), Valid(true)
+{
+    CPU = Parent->mHeap->GetCPUDescriptorHandleForHeapStart();
+    CPU.ptr += index * Parent->mIncrementSize;
+
+    if (Parent->mShaderVisible) {
+        GPU = Parent->mHeap->GetGPUDescriptorHandleForHeapStart();
+        GPU.ptr += index * Parent->mIncrementSize;
+    }
+}
+
 DescriptorHeap::DescriptorHeap(Device::Ref device, DescriptorHeapType type, UInt32 size)
     : mType(type), mHeapSize(size), mShaderVisible(false)
 {
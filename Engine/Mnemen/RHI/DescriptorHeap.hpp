@@ -39,17 +39,7 @@ public:
         /// @brief Creates a descriptor from a heap.
         /// @param heap The parent descriptor heap.
         /// @param index The index in the heap.
-        Descriptor(DescriptorHeap* heap, int index)
-            : Parent(heap), Index(index), Valid(true)
-        {
-            CPU = Parent->mHeap->GetCPUDescriptorHandleForHeapStart();
-            CPU.ptr += index * Parent->mIncrementSize;
-
-            if (Parent->mShaderVisible) {
-                GPU = Parent->mHeap->GetGPUDescriptorHandleForHeapStart();
-                GPU.ptr += index * Parent->mIncrementSize;
-            }
-        }
+        Descriptor(DescriptorHeap* heap, int index);
     };
 
     /// @brief Creates a descriptor heap.
@@ -104,6 +104,13 @@ Device::Device()
     Statistics::Get().MaxVRAM = desc.DedicatedVideoMemory;
 }
 
+UInt64 Device::GetCopyableFootprints(const D3D12_RESOURCE_DESC& desc, D3D12_PLACED_SUBRESOURCE_FOOTPRINT* footprints, UInt32* numRows, UInt64* rowSizes)
+{
+    UInt64 totalSize = 0;
+    mDevice->GetCopyableFootprints(&desc, 0, desc.MipLevels, 0, footprints, numRows, rowSizes, &totalSize);
+    return totalSize;
+}
+
 Device::~Device()
 {
     D3DUtils::Release(mDevice);
@@ -5,8 +5,12 @@
 
 #pragma once
 
-#include <Agility/d3d12.h>
-#include <dxgi1_6.h>
+#if defined(MNEMEN_RHI_NULL)
+    #include <RHI/Null/NullD3D12.hpp>
+#else
+    #include <Agility/d3d12.h>
+    #include <dxgi1_6.h>
+#endif
 
 #include <Core/Common.hpp>
 
@@ -31,6 +35,14 @@ public:
     /// @return Pointer to the DXGI factory.
     IDXGIFactory6* GetFactory() { return mFactory; }
 
+    /// @brief Computes how a resource's subresources are laid out in an upload buffer.
+    /// @param desc The description of the resource.
+    /// @param footprints Optional, receives one footprint per mip.
+    /// @param numRows Optional, receives the row count of each mip.
+    /// @param rowSizes Optional, receives the unpadded row size of each mip.
+    /// @return The total size of the upload buffer, in bytes.
+    UInt64 GetCopyableFootprints(const D3D12_RESOURCE_DESC& desc, D3D12_PLACED_SUBRESOURCE_FOOTPRINT* footprints = nullptr, UInt32* numRows = nullptr, UInt64* rowSizes = nullptr);
+
 private:
     IDXGIFactory6* mFactory = nullptr; ///< DXGI factory for creating adapters.
     IDXGIAdapter1* mAdapter = nullptr; ///< Selected GPU adapter.
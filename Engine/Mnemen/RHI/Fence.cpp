@@ -28,6 +28,11 @@ UInt64 Fence::Signal(::Ref<Queue> queue)
     return mValue;
 }
 
+UInt64 Fence::GetCompletedValue()
+{
+    return mFence->GetCompletedValue();
+}
+
 void Fence::Wait(UInt64 value)
 {
     HANDLE event = ::CreateEventA(nullptr, false, false, "Fence Wait Event");
@@ -35,7 +35,7 @@ public:
 
     /// @brief Retrieves the most recently completed fence value.
     /// @return The completed fence value.
-    UInt64 GetCompletedValue() { return mFence->GetCompletedValue(); }
+    UInt64 GetCompletedValue();
 
     /// @brief Retrieves the underlying Direct3D 12 fence object.
     /// @return Pointer to the ID3D12Fence.
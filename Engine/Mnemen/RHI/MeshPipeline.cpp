@@ -5,6 +5,8 @@
 
 #include "MeshPipeline.hpp"
 
+#include <Agility/d3dx12/d3dx12.h>
+
 #include <Core/Logger.hpp>
 
 MeshPipeline::MeshPipeline(Device::Ref devicePtr, GraphicsPipelineSpecs& specs)
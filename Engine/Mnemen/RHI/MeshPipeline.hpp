@@ -7,8 +7,6 @@
 
 #include "GraphicsPipeline.hpp"
 
-#include <Agility/d3dx12/d3dx12.h>
-
 /// @brief Represents a mesh pipeline state for handling mesh shaders.
 class MeshPipeline
 {
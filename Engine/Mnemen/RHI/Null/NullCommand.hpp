@@ -0,0 +1,46 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 11:20:03
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+/// @brief Every command the null backend's CommandBuffer can record.
+enum class NullCommandType : UInt8
+{
+    Begin,
+    End,
+    BeginMarker,
+    EndMarker,
+    Barrier,
+    UAVBarrier,
+    SetViewport,
+    SetTopology,
+    SetPipeline,
+    SetRenderTargets,
+    SetVertexBuffer,
+    SetIndexBuffer,
+    PushConstants,
+    ClearDepth,
+    ClearRenderTarget,
+    Draw,
+    DrawIndexed,
+    DispatchMesh,
+    Dispatch,
+    Copy,
+    BuildAccelerationStructure,
+    GUI,
+    MAX
+};
+
+/// @brief A command recorded by the null backend.
+///
+/// Only the type and a few integer arguments (vertex count, group counts, push constant size...)
+/// are kept, which is enough for tests to check what a pass recorded without the cost of a real list.
+struct NullCommand
+{
+    NullCommandType Type; ///< What was recorded.
+    UInt32 Args[3] = { 0, 0, 0 }; ///< Command specific arguments.
+};
@@ -0,0 +1,195 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 12:44:26
+//
+
+#include <RHI/CommandBuffer.hpp>
+
+#include <Core/Counters.hpp>
+
+#include <imgui.h>
+#include <imgui_impl_sdl3.h>
+#include <ImGuizmo/ImGuizmo.h>
+
+static Counter sDrawCalls("Draw Calls");
+static Counter sDispatches("Dispatches");
+static Counter sBarriers("Barriers");
+static Counter sTriangles("Triangles");
+static Counter sMeshlets("Meshlets");
+
+CommandBuffer::CommandBuffer(Device::Ref device, Queue::Ref queue, DescriptorHeaps heaps, bool singleTime)
+    : mSingleTime(singleTime), mParentQueue(queue), mHeaps(heaps), mDevice(device), mAllocator(nullptr), mList(nullptr)
+{
+}
+
+CommandBuffer::~CommandBuffer()
+{
+}
+
+void CommandBuffer::Begin()
+{
+    if (!mSingleTime) {
+        mCommands.clear();
+    }
+    mCommands.push_back({ NullCommandType::Begin });
+}
+
+void CommandBuffer::UAVBarrier(::Ref<Resource> resource)
+{
+    mCommands.push_back({ NullCommandType::UAVBarrier });
+    sBarriers.Increment();
+}
+
+void CommandBuffer::Barrier(::Ref<Resource> resource, ResourceLayout layout, UInt32 mip)
+{
+    bool uavToUav = resource->GetLayout() == ResourceLayout::Storage && layout == ResourceLayout::Storage;
+    if (!uavToUav && resource->GetLayout() == layout)
+        return;
+
+    mCommands.push_back({ uavToUav ? NullCommandType::UAVBarrier : NullCommandType::Barrier, { (UInt32)resource->GetLayout(), (UInt32)layout, mip } });
+    resource->SetLayout(layout);
+    sBarriers.Increment();
+}
+
+void CommandBuffer::SetViewport(float x, float y, float width, float height)
+{
+    if (width < 0 || height < 0)
+        return;
+    mCommands.push_back({ NullCommandType::SetViewport, { (UInt32)width, (UInt32)height } });
+}
+
+void CommandBuffer::SetTopology(Topology topology)
+{
+    mCommands.push_back({ NullCommandType::SetTopology, { (UInt32)topology } });
+}
+
+void CommandBuffer::SetGraphicsPipeline(GraphicsPipeline::Ref pipeline)
+{
+    mCommands.push_back({ NullCommandType::SetPipeline });
+}
+
+void CommandBuffer::SetMeshPipeline(MeshPipeline::Ref pipeline)
+{
+    mCommands.push_back({ NullCommandType::SetPipeline });
+}
+
+void CommandBuffer::SetComputePipeline(ComputePipeline::Ref pipeline)
+{
+    mCommands.push_back({ NullCommandType::SetPipeline });
+}
+
+void CommandBuffer::SetRenderTargets(std::initializer_list<View::Ref> targets, View::Ref depth)
+{
+    mCommands.push_back({ NullCommandType::SetRenderTargets, { (UInt32)targets.size(), depth ? 1u : 0u } });
+}
+
+void CommandBuffer::SetVertexBuffer(Buffer::Ref buffer)
+{
+    mCommands.push_back({ NullCommandType::SetVertexBuffer, { (UInt32)buffer->GetSize(), (UInt32)buffer->GetStride() } });
+}
+
+void CommandBuffer::SetIndexBuffer(Buffer::Ref buffer)
+{
+    mCommands.push_back({ NullCommandType::SetIndexBuffer, { (UInt32)buffer->GetSize() } });
+}
+
+void CommandBuffer::GraphicsPushConstants(const void *data, UInt32 size, int index)
+{
+    mCommands.push_back({ NullCommandType::PushConstants, { size, (UInt32)index } });
+}
+
+void CommandBuffer::ComputePushConstants(const void *data, UInt32 size, int index)
+{
+    mCommands.push_back({ NullCommandType::PushConstants, { size, (UInt32)index } });
+}
+
+void CommandBuffer::ClearDepth(View::Ref view)
+{
+    mCommands.push_back({ NullCommandType::ClearDepth });
+}
+
+void CommandBuffer::ClearRenderTarget(View::Ref view, float r, float g, float b)
+{
+    mCommands.push_back({ NullCommandType::ClearRenderTarget });
+}
+
+void CommandBuffer::Draw(int vertexCount)
+{
+    mCommands.push_back({ NullCommandType::Draw, { (UInt32)vertexCount } });
+    sDrawCalls.Increment();
+}
+
+void CommandBuffer::DispatchMesh(int meshletCount, int triangleCount)
+{
+    mCommands.push_back({ NullCommandType::DispatchMesh, { (UInt32)meshletCount, (UInt32)triangleCount } });
+    sMeshlets.Add(meshletCount);
+    sTriangles.Add(triangleCount);
+    sDrawCalls.Increment();
+}
+
+void CommandBuffer::DrawIndexed(int indexCount)
+{
+    mCommands.push_back({ NullCommandType::DrawIndexed, { (UInt32)indexCount } });
+    sTriangles.Add(indexCount / 3);
+    sDrawCalls.Increment();
+}
+
+void CommandBuffer::Dispatch(int x, int y, int z)
+{
+    mCommands.push_back({ NullCommandType::Dispatch, { (UInt32)x, (UInt32)y, (UInt32)z } });
+    sDispatches.Increment();
+}
+
+void CommandBuffer::CopyBufferToBuffer(::Ref<Resource> dst, ::Ref<Resource> src)
+{
+    mCommands.push_back({ NullCommandType::Copy, { (UInt32)dst->GetSize() } });
+}
+
+void CommandBuffer::CopyBufferToTexture(::Ref<Resource> dst, ::Ref<Resource> src)
+{
+    D3D12_RESOURCE_DESC desc = dst->GetResourceDesc();
+    mCommands.push_back({ NullCommandType::Copy, { (UInt32)src->GetSize(), desc.MipLevels } });
+}
+
+void CommandBuffer::UpdateTLAS(TLAS::Ref tlas, Buffer::Ref instanceBuffer, int numInstances)
+{
+    mCommands.push_back({ NullCommandType::BuildAccelerationStructure, { (UInt32)numInstances } });
+}
+
+void CommandBuffer::BuildAccelerationStructure(::Ref<AccelerationStructure> as)
+{
+    mCommands.push_back({ NullCommandType::BuildAccelerationStructure });
+}
+
+void CommandBuffer::End()
+{
+    mCommands.push_back({ NullCommandType::End });
+}
+
+void CommandBuffer::BeginMarker(const char* name)
+{
+    mCommands.push_back({ NullCommandType::BeginMarker });
+}
+
+void CommandBuffer::EndMarker()
+{
+    mCommands.push_back({ NullCommandType::EndMarker });
+}
+
+void CommandBuffer::BeginGUI(int width, int height)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize.x = width;
+    io.DisplaySize.y = height;
+
+    ImGui_ImplSDL3_NewFrame();
+    ImGui::NewFrame();
+    ImGuizmo::BeginFrame();
+}
+
+void CommandBuffer::EndGUI()
+{
+    // The draw data is still generated so UI code costs the same as on a real backend, it just isn't drawn.
+    ImGui::Render();
+    mCommands.push_back({ NullCommandType::GUI, { (UInt32)ImGui::GetDrawData()->TotalVtxCount, (UInt32)ImGui::GetDrawData()->TotalIdxCount } });
+}
@@ -0,0 +1,276 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 10:02:14
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+
+// The RHI headers describe their enums and a few members with D3D12 types. When building the null
+// backend (MNEMEN_RHI_NULL) we don't have the Agility SDK, so this header declares just enough of it,
+// with the same names and values, for those headers to compile unchanged.
+//
+// Interfaces are only declared: nothing outside RHI/*.cpp dereferences them, and the null backend
+// never creates any. The command list ones are defined empty so CommandBuffer's conversion operator compiles.
+
+struct IUnknown;
+struct IDXGIFactory6;
+struct IDXGIAdapter1;
+struct IDXGISwapChain4;
+struct ID3D12Device14;
+struct ID3D12Debug1;
+struct ID3D12Resource;
+struct ID3D12Fence;
+struct ID3D12CommandQueue;
+struct ID3D12CommandAllocator;
+struct ID3D12CommandList {};
+struct ID3D12GraphicsCommandList10 : ID3D12CommandList {};
+struct ID3D12DescriptorHeap;
+struct ID3D12PipelineState;
+struct ID3D12RootSignature;
+struct ID3D12StateObject;
+struct ID3D12QueryHeap;
+struct ID3D12ShaderReflection;
+
+enum DXGI_FORMAT
+{
+    DXGI_FORMAT_UNKNOWN = 0,
+    DXGI_FORMAT_R32G32B32A32_FLOAT = 2,
+    DXGI_FORMAT_R32G32B32_FLOAT = 6,
+    DXGI_FORMAT_R16G16B16A16_FLOAT = 10,
+    DXGI_FORMAT_R16G16B16A16_UNORM = 11,
+    DXGI_FORMAT_R11G11B10_FLOAT = 26,
+    DXGI_FORMAT_R8G8B8A8_UNORM = 28,
+    DXGI_FORMAT_R8G8B8A8_UNORM_SRGB = 29,
+    DXGI_FORMAT_R16G16_FLOAT = 34,
+    DXGI_FORMAT_D32_FLOAT = 40,
+    DXGI_FORMAT_R32_FLOAT = 41,
+    DXGI_FORMAT_R32_UINT = 42,
+    DXGI_FORMAT_R8G8_UNORM = 49,
+    DXGI_FORMAT_R8_UNORM = 61,
+    DXGI_FORMAT_BC3_UNORM = 77,
+    DXGI_FORMAT_BC6H_UF16 = 95,
+    DXGI_FORMAT_BC7_UNORM = 98
+};
+
+enum D3D12_RESOURCE_STATES
+{
+    D3D12_RESOURCE_STATE_COMMON = 0,
+    D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER = 0x1,
+    D3D12_RESOURCE_STATE_INDEX_BUFFER = 0x2,
+    D3D12_RESOURCE_STATE_RENDER_TARGET = 0x4,
+    D3D12_RESOURCE_STATE_UNORDERED_ACCESS = 0x8,
+    D3D12_RESOURCE_STATE_DEPTH_WRITE = 0x10,
+    D3D12_RESOURCE_STATE_DEPTH_READ = 0x20,
+    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE = 0x40,
+    D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE = 0x80,
+    D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT = 0x200,
+    D3D12_RESOURCE_STATE_COPY_DEST = 0x400,
+    D3D12_RESOURCE_STATE_COPY_SOURCE = 0x800,
+    D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE = 0x400000,
+    D3D12_RESOURCE_STATE_GENERIC_READ = 0x1 | 0x2 | 0x40 | 0x80 | 0x200 | 0x800,
+    D3D12_RESOURCE_STATE_ALL_SHADER_RESOURCE = 0x40 | 0x80,
+    D3D12_RESOURCE_STATE_PRESENT = 0
+};
+
+enum D3D12_DESCRIPTOR_HEAP_TYPE
+{
+    D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV = 0,
+    D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER = 1,
+    D3D12_DESCRIPTOR_HEAP_TYPE_RTV = 2,
+    D3D12_DESCRIPTOR_HEAP_TYPE_DSV = 3,
+    D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES = 4
+};
+
+enum D3D12_COMMAND_LIST_TYPE
+{
+    D3D12_COMMAND_LIST_TYPE_DIRECT = 0,
+    D3D12_COMMAND_LIST_TYPE_BUNDLE = 1,
+    D3D12_COMMAND_LIST_TYPE_COMPUTE = 2,
+    D3D12_COMMAND_LIST_TYPE_COPY = 3,
+    D3D12_COMMAND_LIST_TYPE_VIDEO_DECODE = 4,
+    D3D12_COMMAND_LIST_TYPE_VIDEO_PROCESS = 5,
+    D3D12_COMMAND_LIST_TYPE_VIDEO_ENCODE = 6
+};
+
+enum D3D_PRIMITIVE_TOPOLOGY
+{
+    D3D_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+    D3D_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+    D3D_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+    D3D_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+    D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+    D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5
+};
+
+enum D3D12_FILL_MODE
+{
+    D3D12_FILL_MODE_WIREFRAME = 2,
+    D3D12_FILL_MODE_SOLID = 3
+};
+
+enum D3D12_CULL_MODE
+{
+    D3D12_CULL_MODE_NONE = 1,
+    D3D12_CULL_MODE_FRONT = 2,
+    D3D12_CULL_MODE_BACK = 3
+};
+
+enum D3D12_COMPARISON_FUNC
+{
+    D3D12_COMPARISON_FUNC_NONE = 0,
+    D3D12_COMPARISON_FUNC_NEVER = 1,
+    D3D12_COMPARISON_FUNC_LESS = 2,
+    D3D12_COMPARISON_FUNC_EQUAL = 3,
+    D3D12_COMPARISON_FUNC_LESS_EQUAL = 4,
+    D3D12_COMPARISON_FUNC_GREATER = 5
+};
+
+enum D3D12_DESCRIPTOR_RANGE_TYPE
+{
+    D3D12_DESCRIPTOR_RANGE_TYPE_SRV = 0,
+    D3D12_DESCRIPTOR_RANGE_TYPE_UAV = 1,
+    D3D12_DESCRIPTOR_RANGE_TYPE_CBV = 2,
+    D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER = 3
+};
+
+enum D3D12_TEXTURE_ADDRESS_MODE
+{
+    D3D12_TEXTURE_ADDRESS_MODE_WRAP = 1,
+    D3D12_TEXTURE_ADDRESS_MODE_MIRROR = 2,
+    D3D12_TEXTURE_ADDRESS_MODE_CLAMP = 3,
+    D3D12_TEXTURE_ADDRESS_MODE_BORDER = 4
+};
+
+enum D3D12_FILTER
+{
+    D3D12_FILTER_MIN_MAG_MIP_POINT = 0,
+    D3D12_FILTER_MIN_MAG_MIP_LINEAR = 0x15,
+    D3D12_FILTER_ANISOTROPIC = 0x55
+};
+
+enum D3D12_HEAP_TYPE
+{
+    D3D12_HEAP_TYPE_DEFAULT = 1,
+    D3D12_HEAP_TYPE_UPLOAD = 2,
+    D3D12_HEAP_TYPE_READBACK = 3
+};
+
+enum D3D12_RESOURCE_DIMENSION
+{
+    D3D12_RESOURCE_DIMENSION_UNKNOWN = 0,
+    D3D12_RESOURCE_DIMENSION_BUFFER = 1,
+    D3D12_RESOURCE_DIMENSION_TEXTURE1D = 2,
+    D3D12_RESOURCE_DIMENSION_TEXTURE2D = 3,
+    D3D12_RESOURCE_DIMENSION_TEXTURE3D = 4
+};
+
+enum D3D12_TEXTURE_LAYOUT
+{
+    D3D12_TEXTURE_LAYOUT_UNKNOWN = 0,
+    D3D12_TEXTURE_LAYOUT_ROW_MAJOR = 1
+};
+
+enum D3D12_RESOURCE_FLAGS
+{
+    D3D12_RESOURCE_FLAG_NONE = 0,
+    D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET = 0x1,
+    D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL = 0x2,
+    D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS = 0x4,
+    D3D12_RESOURCE_FLAG_RAYTRACING_ACCELERATION_STRUCTURE = 0x1000
+};
+
+inline constexpr D3D12_RESOURCE_FLAGS operator|(D3D12_RESOURCE_FLAGS x, D3D12_RESOURCE_FLAGS y)
+{
+    return static_cast<D3D12_RESOURCE_FLAGS>(static_cast<UInt32>(x) | static_cast<UInt32>(y));
+}
+
+inline D3D12_RESOURCE_FLAGS& operator|=(D3D12_RESOURCE_FLAGS& x, D3D12_RESOURCE_FLAGS y)
+{
+    x = x | y;
+    return x;
+}
+
+constexpr UInt64 D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT = 65536;
+constexpr UInt32 D3D12_TEXTURE_DATA_PITCH_ALIGNMENT = 256;
+constexpr UInt32 D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT = 512;
+constexpr UInt32 D3D12_RAYTRACING_SHADER_TABLE_BYTE_ALIGNMENT = 64;
+
+struct D3D12_CPU_DESCRIPTOR_HANDLE
+{
+    UInt64 ptr;
+};
+
+struct D3D12_GPU_DESCRIPTOR_HANDLE
+{
+    UInt64 ptr;
+};
+
+struct D3D12_VERTEX_BUFFER_VIEW
+{
+    UInt64 BufferLocation;
+    UInt32 SizeInBytes;
+    UInt32 StrideInBytes;
+};
+
+struct D3D12_INDEX_BUFFER_VIEW
+{
+    UInt64 BufferLocation;
+    UInt32 SizeInBytes;
+    DXGI_FORMAT Format;
+};
+
+struct DXGI_SAMPLE_DESC
+{
+    UInt32 Count;
+    UInt32 Quality;
+};
+
+struct D3D12_HEAP_PROPERTIES
+{
+    D3D12_HEAP_TYPE Type;
+};
+
+struct D3D12_RESOURCE_DESC
+{
+    D3D12_RESOURCE_DIMENSION Dimension;
+    UInt64 Alignment;
+    UInt64 Width;
+    UInt32 Height;
+    UInt16 DepthOrArraySize;
+    UInt16 MipLevels;
+    DXGI_FORMAT Format;
+    DXGI_SAMPLE_DESC SampleDesc;
+    D3D12_TEXTURE_LAYOUT Layout;
+    D3D12_RESOURCE_FLAGS Flags;
+};
+
+struct D3D12_SUBRESOURCE_FOOTPRINT
+{
+    DXGI_FORMAT Format;
+    UInt32 Width;
+    UInt32 Height;
+    UInt32 Depth;
+    UInt32 RowPitch;
+};
+
+struct D3D12_PLACED_SUBRESOURCE_FOOTPRINT
+{
+    UInt64 Offset;
+    D3D12_SUBRESOURCE_FOOTPRINT Footprint;
+};
+
+// Acceleration structures are stubbed out in the D3D12 backend as well, only the storage is needed.
+struct D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS
+{
+    UInt32 Type;
+    UInt32 Flags;
+    UInt32 NumDescs;
+};
+
+struct D3D12_RAYTRACING_GEOMETRY_DESC
+{
+    UInt32 Type;
+    UInt32 Flags;
+};
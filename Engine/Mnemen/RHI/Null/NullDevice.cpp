@@ -0,0 +1,251 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 11:31:17
+//
+
+#include <RHI/Device.hpp>
+#include <RHI/Fence.hpp>
+#include <RHI/Queue.hpp>
+#include <RHI/Surface.hpp>
+#include <RHI/DescriptorHeap.hpp>
+#include <RHI/CommandBuffer.hpp>
+#include <RHI/Null/NullStats.hpp>
+
+#include <Core/Assert.hpp>
+#include <Core/Logger.hpp>
+#include <Core/Statistics.hpp>
+
+#include <algorithm>
+
+/// Mirrors what a desktop GPU reports for CBV/SRV/UAV descriptors, only used to space out fake handles.
+constexpr int NULL_DESCRIPTOR_INCREMENT = 32;
+
+/// Dedicated memory the null device pretends to have, a common desktop budget so VRAM percentages stay meaningful.
+constexpr UInt64 NULL_DEDICATED_VIDEO_MEMORY = 8ull * 1024 * 1024 * 1024;
+
+static UInt32 BytesPerPixel(DXGI_FORMAT format)
+{
+    switch (format) {
+        case DXGI_FORMAT_R32G32B32A32_FLOAT:
+            return 16;
+        case DXGI_FORMAT_R32G32B32_FLOAT:
+            return 12;
+        case DXGI_FORMAT_R16G16B16A16_FLOAT:
+        case DXGI_FORMAT_R16G16B16A16_UNORM:
+            return 8;
+        case DXGI_FORMAT_R11G11B10_FLOAT:
+        case DXGI_FORMAT_R8G8B8A8_UNORM:
+        case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+        case DXGI_FORMAT_R16G16_FLOAT:
+        case DXGI_FORMAT_D32_FLOAT:
+        case DXGI_FORMAT_R32_FLOAT:
+        case DXGI_FORMAT_R32_UINT:
+            return 4;
+        case DXGI_FORMAT_R8G8_UNORM:
+            return 2;
+        case DXGI_FORMAT_R8_UNORM:
+            return 1;
+        default:
+            return 4;
+    }
+}
+
+/// BC3, BC6H and BC7 all store 16 bytes per 4x4 block.
+static bool IsBlockCompressed(DXGI_FORMAT format)
+{
+    return format == DXGI_FORMAT_BC3_UNORM || format == DXGI_FORMAT_BC6H_UF16 || format == DXGI_FORMAT_BC7_UNORM;
+}
+
+static UInt64 AlignUp(UInt64 value, UInt64 alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+Device::Device()
+{
+    LOG_INFO("Selecting null device, nothing will be sent to a GPU");
+
+    // Set max vram stat
+    Statistics::Get().MaxVRAM = NULL_DEDICATED_VIDEO_MEMORY;
+}
+
+Device::~Device()
+{
+}
+
+UInt64 Device::GetCopyableFootprints(const D3D12_RESOURCE_DESC& desc, D3D12_PLACED_SUBRESOURCE_FOOTPRINT* footprints, UInt32* numRows, UInt64* rowSizes)
+{
+    if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+        if (footprints) footprints[0] = { 0, { desc.Format, (UInt32)desc.Width, 1, 1, (UInt32)desc.Width } };
+        if (numRows) numRows[0] = 1;
+        if (rowSizes) rowSizes[0] = desc.Width;
+        return desc.Width;
+    }
+
+    // Same rules as the D3D12 runtime: rows are pitched to 256 bytes, subresources placed at 512 bytes,
+    // block compressed formats are laid out as rows of 4x4 blocks.
+    UInt64 offset = 0;
+    UInt64 totalSize = 0;
+    for (UInt32 mip = 0; mip < desc.MipLevels; mip++) {
+        UInt32 width = std::max<UInt32>(1, (UInt32)(desc.Width >> mip));
+        UInt32 height = std::max<UInt32>(1, desc.Height >> mip);
+
+        UInt64 rowSize = 0;
+        UInt32 rows = 0;
+        if (IsBlockCompressed(desc.Format)) {
+            rowSize = ((width + 3) / 4) * 16;
+            rows = (height + 3) / 4;
+        } else {
+            rowSize = width * BytesPerPixel(desc.Format);
+            rows = height;
+        }
+        UInt64 rowPitch = AlignUp(rowSize, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT);
+
+        offset = AlignUp(offset, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+        if (footprints) footprints[mip] = { offset, { desc.Format, width, height, 1, (UInt32)rowPitch } };
+        if (numRows) numRows[mip] = rows;
+        if (rowSizes) rowSizes[mip] = rowSize;
+
+        totalSize = offset + rowPitch * (rows - 1) + rowSize;
+        offset += rowPitch * rows;
+    }
+    return totalSize;
+}
+
+Fence::Fence(Device::Ref device)
+    : mValue(0)
+{
+}
+
+Fence::~Fence()
+{
+}
+
+UInt64 Fence::Signal(::Ref<Queue> queue)
+{
+    mValue++;
+    return mValue;
+}
+
+UInt64 Fence::GetCompletedValue()
+{
+    // There is no GPU to wait on, every value is reached as soon as it is signaled.
+    return UINT64_MAX;
+}
+
+void Fence::Wait(UInt64 value)
+{
+}
+
+Queue::Queue(Device::Ref device, QueueType type)
+    : mType(type)
+{
+}
+
+Queue::~Queue()
+{
+}
+
+void Queue::Wait(::Ref<Fence> fence, UInt64 value)
+{
+}
+
+void Queue::Signal(::Ref<Fence> fence, UInt64 value)
+{
+}
+
+void Queue::Submit(const Vector<::Ref<CommandBuffer>>& buffers)
+{
+    NullStats& stats = NullStats::Get();
+    for (auto& buffer : buffers) {
+        for (const NullCommand& command : buffer->GetCommands()) {
+            stats.Commands[(UInt64)command.Type].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    stats.SubmitCount.fetch_add(buffers.size(), std::memory_order_relaxed);
+}
+
+Surface::Surface(::Ref<Window> window, Device::Ref device, DescriptorHeaps heaps, Queue::Ref queue)
+{
+    int width, height;
+    window->PollSize(width, height);
+
+    for (int i = 0; i < FRAMES_IN_FLIGHT; i++) {
+        TextureDesc desc;
+        desc.Width = width;
+        desc.Height = height;
+        desc.Format = TextureFormat::RGBA8;
+        mBackbuffers[i] = MakeRef<Texture>(device, nullptr, desc);
+
+        mBackbufferViews[i] = MakeRef<View>(device, heaps, mBackbuffers[i], ViewType::RenderTarget, ViewDimension::Texture, TextureFormat::RGBA8);
+    }
+}
+
+Surface::~Surface()
+{
+}
+
+UInt32 Surface::GetBackbufferIndex()
+{
+    return mBackbufferIndex;
+}
+
+void Surface::Present(bool vsync)
+{
+    mBackbufferIndex = (mBackbufferIndex + 1) % FRAMES_IN_FLIGHT;
+    NullStats::Get().PresentCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+DescriptorHeap::Descriptor::Descriptor(DescriptorHeap* heap, int index)
+    : Parent(heap), Index(index), Valid(true)
+{
+    // Handles only need to be unique, start at one increment so a valid handle is never 0.
+    CPU.ptr = (index + 1) * Parent->mIncrementSize;
+    if (Parent->mShaderVisible) {
+        GPU.ptr = CPU.ptr;
+    }
+}
+
+DescriptorHeap::DescriptorHeap(Device::Ref device, DescriptorHeapType type, UInt32 size)
+    : mType(type), mHeapSize(size), mShaderVisible(false)
+{
+    if (type == DescriptorHeapType::ShaderResource || type == DescriptorHeapType::Sampler) {
+        mShaderVisible = true;
+    }
+
+    mLookupTable.resize(size, false);
+    mIncrementSize = NULL_DESCRIPTOR_INCREMENT;
+}
+
+DescriptorHeap::~DescriptorHeap()
+{
+}
+
+DescriptorHeap::Descriptor DescriptorHeap::Allocate()
+{
+    int index = -1;
+    for (UInt64 i = 0; i < mLookupTable.size(); i++) {
+        if (mLookupTable[i] == false) {
+            mLookupTable[i] = true;
+            index = i;
+            break;
+        }
+    }
+    ASSERT(index != -1, "Descriptor heap is full!");
+
+    NullStats& stats = NullStats::Get();
+    UInt32 inUse = stats.DescriptorsInUse[(UInt32)mType].fetch_add(1, std::memory_order_relaxed) + 1;
+    UInt32 peak = stats.DescriptorsPeak[(UInt32)mType].load(std::memory_order_relaxed);
+    while (inUse > peak && !stats.DescriptorsPeak[(UInt32)mType].compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+    }
+
+    return DescriptorHeap::Descriptor(this, index);
+}
+
+void DescriptorHeap::Free(DescriptorHeap::Descriptor& descriptor)
+{
+    if (!descriptor.Valid || !mLookupTable[descriptor.Index])
+        return;
+    mLookupTable[descriptor.Index] = false;
+    NullStats::Get().DescriptorsInUse[(UInt32)mType].fetch_sub(1, std::memory_order_relaxed);
+}
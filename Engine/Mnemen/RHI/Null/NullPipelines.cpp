@@ -0,0 +1,70 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 12:31:09
+//
+
+#include <RHI/RootSignature.hpp>
+#include <RHI/GraphicsPipeline.hpp>
+#include <RHI/MeshPipeline.hpp>
+#include <RHI/ComputePipeline.hpp>
+#include <RHI/RTPipeline.hpp>
+
+#include <Core/Logger.hpp>
+
+RootSignature::RootSignature(Device::Ref device)
+{
+}
+
+RootSignature::RootSignature(Device::Ref device, const Vector<RootType>& roots, UInt64 pushConstantSize)
+{
+}
+
+RootSignature::~RootSignature()
+{
+}
+
+GraphicsPipeline::GraphicsPipeline(Device::Ref device, GraphicsPipelineSpecs& specs)
+{
+    if (specs.Signature) {
+        mSignature = specs.Signature;
+    }
+}
+
+GraphicsPipeline::~GraphicsPipeline()
+{
+}
+
+MeshPipeline::MeshPipeline(Device::Ref devicePtr, GraphicsPipelineSpecs& specs)
+{
+    if (specs.Signature) {
+        mSignature = specs.Signature;
+    }
+}
+
+MeshPipeline::~MeshPipeline()
+{
+}
+
+ComputePipeline::ComputePipeline(Device::Ref device, Shader shader, RootSignature::Ref signature)
+    : mSignature(signature)
+{
+}
+
+ComputePipeline::~ComputePipeline()
+{
+}
+
+RTPipeline::RTPipeline(Device::Ref device, DescriptorHeaps& heaps, RTPipelineSpecs specs)
+{
+    if (!specs.Signature) {
+        LOG_CRITICAL("ho is u not giving a root signature to the rt pipeline?!");
+        return;
+    }
+
+    mSignature = specs.Signature;
+    mIDBuffer = MakeRef<Buffer>(device, heaps, 3 * D3D12_RAYTRACING_SHADER_TABLE_BYTE_ALIGNMENT, D3D12_RAYTRACING_SHADER_TABLE_BYTE_ALIGNMENT, BufferType::Constant, "ID Buffer");
+}
+
+RTPipeline::~RTPipeline()
+{
+}
@@ -0,0 +1,219 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 13:12:30
+//
+
+#include <RHI/RHI.hpp>
+#include <RHI/GPUTimer.hpp>
+#include <RHI/Uploader.hpp>
+#include <RHI/Null/NullStats.hpp>
+
+#include <imgui_impl_sdl3.h>
+
+#include <FontAwesome/FontAwesome.hpp>
+
+#include <Core/Logger.hpp>
+#include <Core/Profiler.hpp>
+
+RHI::RHI(::Ref<Window> window)
+    : mWindow(window)
+{
+    mDevice = MakeRef<Device>();
+
+    mGraphicsQueue = MakeRef<Queue>(mDevice, QueueType::AllGraphics);
+
+    mDescriptorHeaps[DescriptorHeapType::RenderTarget] = MakeRef<DescriptorHeap>(mDevice, DescriptorHeapType::RenderTarget, 2048);
+    mDescriptorHeaps[DescriptorHeapType::DepthTarget] = MakeRef<DescriptorHeap>(mDevice, DescriptorHeapType::DepthTarget, 2048);
+    mDescriptorHeaps[DescriptorHeapType::ShaderResource] = MakeRef<DescriptorHeap>(mDevice, DescriptorHeapType::ShaderResource, 1'000'000);
+    mDescriptorHeaps[DescriptorHeapType::Sampler] = MakeRef<DescriptorHeap>(mDevice, DescriptorHeapType::Sampler, 2048);
+
+    mSurface = MakeRef<Surface>(window, mDevice, mDescriptorHeaps, mGraphicsQueue);
+
+    mFrameFence = MakeRef<Fence>(mDevice);
+    mFrameIndex = 0;
+    for (int i = 0; i < FRAMES_IN_FLIGHT; i++) {
+        mFrameValues[i] = 0;
+        mCommandBuffers[i] = MakeRef<CommandBuffer>(mDevice, mGraphicsQueue, mDescriptorHeaps);
+    }
+
+    Uploader::Init(this, mDevice, mDescriptorHeaps, mGraphicsQueue);
+
+    mFontDescriptor = mDescriptorHeaps[DescriptorHeapType::ShaderResource]->Allocate();
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGui::StyleColorsLight();
+
+    ImGuiIO& IO = ImGui::GetIO();
+    IO.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+
+    ImFontConfig mergeConfig = {};
+    mergeConfig.MergeMode = true;
+
+    static const ImWchar rangesFixed[] = {
+    	0x0020, 0x00FF, // Basic Latin + Latin Supplement
+    	0x2026, 0x2026, // ellipsis
+    	0
+    };
+    static const ImWchar rangesIcons[] = {
+    	ICON_MIN_FA, ICON_MAX_FA,
+    	0
+    };
+
+    IO.Fonts->AddFontFromFileTTF("Assets/Fonts/Roboto-Regular.ttf", 18, NULL, rangesFixed);
+    IO.Fonts->AddFontFromFileTTF("Assets/Fonts/fontawesome-webfont.ttf", 14, &mergeConfig, rangesIcons);
+    mLargeFont = IO.Fonts->AddFontFromFileTTF("Assets/Fonts/fontawesome-webfont.ttf", 64, nullptr, rangesIcons);
+
+    // There is no renderer backend to upload the atlas, build it here so NewFrame() is happy.
+    IO.Fonts->Build();
+
+    ImGui_ImplSDL3_InitForOther(window->GetSDLHandle());
+
+    LOG_INFO("Initialized null RHI");
+}
+
+RHI::~RHI()
+{
+    ImGui_ImplSDL3_Shutdown();
+    ImGui::DestroyContext();
+    mFontDescriptor.Parent->Free(mFontDescriptor);
+}
+
+void RHI::Wait()
+{
+}
+
+void RHI::Submit(const Vector<CommandBuffer::Ref> buffers)
+{
+    mGraphicsQueue->Submit(buffers);
+}
+
+Frame RHI::Begin()
+{
+    NullStats::Reset();
+
+    Frame frame = {};
+    frame.FrameIndex = mSurface->GetBackbufferIndex();
+    frame.Backbuffer = mSurface->GetBackbuffer(frame.FrameIndex);
+    frame.BackbufferView = mSurface->GetBackbufferView(frame.FrameIndex);
+    frame.CommandBuffer = mCommandBuffers[frame.FrameIndex];
+
+    mFrameIndex = frame.FrameIndex;
+
+    mWindow->PollSize(frame.Width, frame.Height);
+
+    return frame;
+}
+
+void RHI::End()
+{
+    const UInt64 fenceValue = mFrameValues[mFrameIndex];
+    mGraphicsQueue->Signal(mFrameFence, fenceValue);
+    mFrameValues[mFrameIndex] = fenceValue + 1;
+}
+
+void RHI::Present(bool vsync)
+{
+    PROFILE_FUNCTION();
+    mSurface->Present(vsync);
+}
+
+RootSignature::Ref RHI::CreateRootSignature()
+{
+    return MakeRef<RootSignature>(mDevice);
+}
+
+RootSignature::Ref RHI::CreateRootSignature(const Vector<RootType>& entries, UInt64 pushConstantSize)
+{
+    return MakeRef<RootSignature>(mDevice, entries, pushConstantSize);
+}
+
+GraphicsPipeline::Ref RHI::CreateGraphicsPipeline(GraphicsPipelineSpecs& specs)
+{
+    return MakeRef<GraphicsPipeline>(mDevice, specs);
+}
+
+MeshPipeline::Ref RHI::CreateMeshPipeline(GraphicsPipelineSpecs& specs)
+{
+    return MakeRef<MeshPipeline>(mDevice, specs);
+}
+
+ComputePipeline::Ref RHI::CreateComputePipeline(Shader shader, RootSignature::Ref signature)
+{
+    return MakeRef<ComputePipeline>(mDevice, shader, signature);
+}
+
+CommandBuffer::Ref RHI::CreateCommandBuffer(bool close)
+{
+    return MakeRef<CommandBuffer>(mDevice, mGraphicsQueue, mDescriptorHeaps, close);
+}
+
+Buffer::Ref RHI::CreateBuffer(UInt64 size, UInt64 stride, BufferType type, const String& name)
+{
+    return MakeRef<Buffer>(mDevice, mDescriptorHeaps, size, stride, type, name);
+}
+
+Texture::Ref RHI::CreateTexture(TextureDesc desc)
+{
+    return MakeRef<Texture>(mDevice, desc);
+}
+
+View::Ref RHI::CreateView(::Ref<Resource> resource, ViewType type, ViewDimension dimension, TextureFormat format, UInt64 mip, UInt64 depthSlice)
+{
+    return MakeRef<View>(mDevice, mDescriptorHeaps, resource, type, dimension, format, mip, depthSlice);
+}
+
+Sampler::Ref RHI::CreateSampler(SamplerAddress address, SamplerFilter filter, bool mips, int anisotropyLevel, bool comparison)
+{
+    return MakeRef<Sampler>(mDevice, mDescriptorHeaps, address, filter, mips, anisotropyLevel, comparison);
+}
+
+BLAS::Ref RHI::CreateBLAS(Buffer::Ref vertex, Buffer::Ref index, UInt32 vtxCount, UInt32 idxCount, const String& name)
+{
+    return MakeRef<BLAS>(mDevice, mDescriptorHeaps, vertex, index, vtxCount, idxCount, name);
+}
+
+TLAS::Ref RHI::CreateTLAS(Buffer::Ref instanceBuffer, UInt32 numInstance, const String& name)
+{
+    return MakeRef<TLAS>(mDevice, mDescriptorHeaps, instanceBuffer, numInstance, name);
+}
+
+GPUTimer::Data GPUTimer::sData = {};
+
+void GPUTimer::Init(RHI::Ref rhi)
+{
+    sData.RHI = rhi;
+    sData.MaxTimers = 256;
+    sData.QueryHeap = nullptr;
+    sData.ReadbackBuffer = nullptr;
+    sData.Frequency = 1;
+    sData.Timestamps.resize(sData.MaxTimers * 2, 0);
+}
+
+void GPUTimer::Exit()
+{
+}
+
+void GPUTimer::Start(CommandBuffer::Ref cmdBuffer, UInt32 timerIndex)
+{
+}
+
+void GPUTimer::Stop(CommandBuffer::Ref cmdBuffer, UInt32 timerIndex)
+{
+}
+
+void GPUTimer::Resolve(CommandBuffer::Ref cmdBuffer)
+{
+}
+
+void GPUTimer::Readback()
+{
+}
+
+double GPUTimer::GetTime(UInt32 timerIndex)
+{
+    // Timestamps never move, so every GPU timer reads 0 ms.
+    UInt64 start = sData.Timestamps[timerIndex * 2];
+    UInt64 end = sData.Timestamps[timerIndex * 2 + 1];
+    return (end - start) * 1000.0 / sData.Frequency;
+}
@@ -0,0 +1,213 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 12:02:51
+//
+
+#include <RHI/Resource.hpp>
+#include <RHI/Buffer.hpp>
+#include <RHI/View.hpp>
+#include <RHI/Sampler.hpp>
+#include <RHI/Null/NullStats.hpp>
+
+#include <Core/Assert.hpp>
+#include <Core/Profiler.hpp>
+#include <Core/Statistics.hpp>
+
+static std::atomic<UInt64>& GetMemoryCounter(const D3D12_RESOURCE_DESC& desc)
+{
+    NullStats& stats = NullStats::Get();
+    return desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER ? stats.BufferMemory : stats.TextureMemory;
+}
+
+Resource::Resource(Device::Ref device)
+    : mParentDevice(device), mResource(nullptr), mLayout(ResourceLayout::Common)
+{
+}
+
+Resource::~Resource()
+{
+    if (mShouldFree) {
+        Statistics::Get().UsedVRAM -= mAllocSize;
+        GetMemoryCounter(mDesc).fetch_sub(mAllocSize, std::memory_order_relaxed);
+        NullStats::Get().ResourceCount.fetch_sub(1, std::memory_order_relaxed);
+        Profiler::PopResource(mUUID);
+    }
+}
+
+UInt64 Resource::GetAddress()
+{
+    // Never dereferenced, it only has to be unique and stable for as long as the resource lives.
+    return reinterpret_cast<UInt64>(this);
+}
+
+D3D12_RESOURCE_DESC Resource::GetResourceDesc()
+{
+    return mDesc;
+}
+
+void Resource::SetName(const String& string)
+{
+    mName = string;
+
+    mUUID = Profiler::PushResource(mAllocSize, mName);
+    Profiler::SetResourceData(mUUID, mDesc.Width, mDesc.Height, mDesc.DepthOrArraySize, mDesc.MipLevels);
+}
+
+void Resource::Tag(ResourceTag tag)
+{
+    mTags.push_back(tag);
+    Profiler::TagResource(mUUID, tag);
+}
+
+void Resource::CreateResource(D3D12_HEAP_PROPERTIES* heapProps, D3D12_RESOURCE_DESC* resourceDesc, D3D12_RESOURCE_STATES state)
+{
+    memcpy(&mDesc, resourceDesc, sizeof(mDesc));
+    mLayout = ResourceLayout(state);
+
+    mAllocSize = mParentDevice->GetCopyableFootprints(*resourceDesc);
+    Statistics::Get().UsedVRAM += mAllocSize;
+    GetMemoryCounter(mDesc).fetch_add(mAllocSize, std::memory_order_relaxed);
+    NullStats::Get().ResourceCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+Buffer::Buffer(Device::Ref device, DescriptorHeaps heaps, UInt64 size, UInt64 stride, BufferType type, const String& name)
+    : Resource(device), mType(type), mHeaps(heaps)
+{
+    mShouldFree = true;
+    mSize = size;
+    mStride = stride;
+
+    D3D12_HEAP_PROPERTIES heapProperties = {};
+    switch (type) {
+        case BufferType::Readback:
+            heapProperties.Type = D3D12_HEAP_TYPE_READBACK;
+            break;
+        case BufferType::Constant:
+        case BufferType::Copy:
+            heapProperties.Type = D3D12_HEAP_TYPE_UPLOAD;
+            break;
+        default:
+            heapProperties.Type = D3D12_HEAP_TYPE_DEFAULT;
+            break;
+    }
+
+    D3D12_RESOURCE_DESC resourceDesc = {};
+    resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    resourceDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    resourceDesc.Width = size;
+    resourceDesc.Height = 1;
+    resourceDesc.DepthOrArraySize = 1;
+    resourceDesc.MipLevels = 1;
+    resourceDesc.Format = DXGI_FORMAT_UNKNOWN;
+    resourceDesc.SampleDesc.Count = 1;
+    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+    resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+    if (type == BufferType::Constant) mLayout = ResourceLayout::GenericRead;
+    if (type == BufferType::AccelerationStructure) mLayout = ResourceLayout::AccelerationStructure;
+
+    CreateResource(&heapProperties, &resourceDesc, D3D12_RESOURCE_STATES(mLayout));
+    SetName(name);
+
+    switch (type) {
+        case BufferType::Vertex: {
+            mVBV.BufferLocation = GetAddress();
+            mVBV.SizeInBytes = size;
+            mVBV.StrideInBytes = stride;
+            break;
+        }
+        case BufferType::Index: {
+            mIBV.BufferLocation = GetAddress();
+            mIBV.SizeInBytes = size;
+            mIBV.Format = DXGI_FORMAT_R32_UINT;
+            break;
+        }
+    }
+}
+
+Buffer::~Buffer()
+{
+    mHeaps[DescriptorHeapType::ShaderResource]->Free(mCBV);
+    mHeaps[DescriptorHeapType::ShaderResource]->Free(mUAV);
+    mHeaps[DescriptorHeapType::ShaderResource]->Free(mSRV);
+}
+
+void Buffer::BuildCBV()
+{
+    if (mCBV.Valid == false)
+        mCBV = mHeaps[DescriptorHeapType::ShaderResource]->Allocate();
+}
+
+void Buffer::BuildUAV()
+{
+    if (mUAV.Valid == false)
+        mUAV = mHeaps[DescriptorHeapType::ShaderResource]->Allocate();
+}
+
+void Buffer::BuildSRV()
+{
+    if (mSRV.Valid == false)
+        mSRV = mHeaps[DescriptorHeapType::ShaderResource]->Allocate();
+}
+
+void Buffer::Map(int start, int end, void **data)
+{
+    // Only CPU visible heaps can be mapped, so only those ever get host memory behind them.
+    ASSERT(mType == BufferType::Constant || mType == BufferType::Copy || mType == BufferType::Readback, "Trying to map a buffer that lives in GPU memory!");
+    if (mHostMemory.empty()) {
+        mHostMemory.resize(mSize);
+    }
+    *data = mHostMemory.data();
+}
+
+void Buffer::Unmap(int start, int end)
+{
+}
+
+void Buffer::CopyMapped(void *data, UInt64 size)
+{
+    void* mapped = nullptr;
+    Map(0, 0, &mapped);
+    if (mapped) {
+        memcpy(mapped, data, size);
+    }
+    Unmap(0, 0);
+}
+
+View::View(Device::Ref device, DescriptorHeaps heaps, ::Ref<Resource> resource, ViewType type, ViewDimension dimension, TextureFormat format, UInt64 mip, UInt64 depthSlice)
+    : mParent(resource), mType(type), mDimension(dimension)
+{
+    switch (type)
+    {
+    case ViewType::ShaderResource:
+    case ViewType::Storage: {
+        mDescriptor = heaps[DescriptorHeapType::ShaderResource]->Allocate();
+        break;
+    }
+    case ViewType::RenderTarget: {
+        ASSERT(dimension != ViewDimension::Buffer, "Buffers cannot be render targets!");
+        mDescriptor = heaps[DescriptorHeapType::RenderTarget]->Allocate();
+        break;
+    }
+    case ViewType::DepthTarget: {
+        ASSERT(dimension != ViewDimension::Buffer, "Buffers cannot be depth targets!");
+        mDescriptor = heaps[DescriptorHeapType::DepthTarget]->Allocate();
+        break;
+    }
+    }
+}
+
+View::~View()
+{
+    mDescriptor.Parent->Free(mDescriptor);
+}
+
+Sampler::Sampler(Device::Ref device, DescriptorHeaps heaps, SamplerAddress address, SamplerFilter filter, bool mips, int anisotropyLevel, bool comparison)
+    : mHeaps(heaps), mAddress(address), mFilter(filter), mMips(mips), mAnisotropyLevel(anisotropyLevel)
+{
+    mDescriptor = heaps[DescriptorHeapType::Sampler]->Allocate();
+}
+
+Sampler::~Sampler()
+{
+    mDescriptor.Parent->Free(mDescriptor);
+}
@@ -0,0 +1,26 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 13:05:48
+//
+
+#include <Asset/Shader.hpp>
+
+#include <Core/File.hpp>
+#include <Core/Logger.hpp>
+
+Shader ShaderCompiler::Compile(const String& path, const String& entry, ShaderType type)
+{
+    // Still read the source so shader loading keeps its I/O cost, but there is nothing to compile it for.
+    String source = File::ReadFile(path);
+
+    Shader result = {};
+    result.Valid = !source.empty();
+    result.Type = type;
+    LOG_DEBUG("Skipped compiling shader {0}", path.c_str());
+    return result;
+}
+
+ID3D12ShaderReflection* ShaderCompiler::Reflect(Shader shader)
+{
+    return nullptr;
+}
@@ -0,0 +1,66 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-05 11:24:40
+//
+
+#pragma once
+
+#include <Core/Common.hpp>
+#include <RHI/Null/NullCommand.hpp>
+
+#include <atomic>
+
+/// @brief Number of descriptor heap types tracked by NullStats, matches DescriptorHeapType.
+constexpr UInt32 NULL_DESCRIPTOR_HEAP_TYPES = 4;
+
+/// @struct NullStats
+/// @brief What the null RHI backend did, in place of a GPU.
+///
+/// Command counts are tallied when command buffers are submitted, resource and descriptor counters
+/// track what is currently alive. Every counter is atomic since uploads and asset loads can create
+/// resources from job system workers.
+struct NullStats
+{
+    /// @brief Number of commands of each type submitted since the last Reset().
+    Array<std::atomic<UInt64>, (UInt64)NullCommandType::MAX> Commands;
+
+    /// @brief Number of command buffers submitted since the last Reset().
+    std::atomic<UInt64> SubmitCount = 0;
+
+    /// @brief Number of presents since the last Reset().
+    std::atomic<UInt64> PresentCount = 0;
+
+    /// @brief Number of live resources owning memory.
+    std::atomic<UInt64> ResourceCount = 0;
+
+    /// @brief Bytes allocated by live buffers.
+    std::atomic<UInt64> BufferMemory = 0;
+
+    /// @brief Bytes allocated by live textures.
+    std::atomic<UInt64> TextureMemory = 0;
+
+    /// @brief Descriptors currently allocated in each heap, indexed by DescriptorHeapType.
+    Array<std::atomic<UInt32>, NULL_DESCRIPTOR_HEAP_TYPES> DescriptorsInUse;
+
+    /// @brief Highest number of descriptors ever allocated at once in each heap.
+    Array<std::atomic<UInt32>, NULL_DESCRIPTOR_HEAP_TYPES> DescriptorsPeak;
+
+    /// @brief Resets the per-frame counters (commands, submits, presents).
+    ///
+    /// Resource and descriptor counters describe live objects and are left untouched.
+    static void Reset()
+    {
+        NullStats& stats = Get();
+        for (auto& count : stats.Commands)
+            count = 0;
+        stats.SubmitCount = 0;
+        stats.PresentCount = 0;
+    }
+
+    /// @brief Retrieves the singleton instance of the NullStats structure.
+    static NullStats& Get()
+    {
+        static NullStats stats;
+        return stats;
+    }
+};
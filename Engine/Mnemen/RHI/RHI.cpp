@@ -13,7 +13,6 @@
 
 #include <Core/Logger.hpp>
 #include <Core/Profiler.hpp>
-#include <Core/Statistics.hpp>
 
 // NOTE(amelie): Courtesy of Robert Ryan A.K.A Implodee
 DWORD AwaitFence(ID3D12Fence* fence, uint64_t val, uint64_t timeout)
@@ -132,8 +131,6 @@ void RHI::Submit(const Vector<CommandBuffer::Ref> buffers)
 
 Frame RHI::Begin()
 {
-    Statistics::Reset();
-
     Frame frame = {};
     frame.FrameIndex = mSurface->GetBackbufferIndex();
     frame.Backbuffer = mSurface->GetBackbuffer(frame.FrameIndex);
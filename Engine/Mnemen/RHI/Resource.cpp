@@ -25,6 +25,16 @@ Resource::~Resource()
     }
 }
 
+UInt64 Resource::GetAddress()
+{
+    return mResource->GetGPUVirtualAddress();
+}
+
+D3D12_RESOURCE_DESC Resource::GetResourceDesc()
+{
+    return mResource->GetDesc();
+}
+
 void Resource::SetName(const String& string)
 {
     mName = string;
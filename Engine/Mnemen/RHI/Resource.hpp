@@ -86,7 +86,11 @@ public:
 
     /// @brief Gets the GPU virtual address of the resource.
     /// @return The GPU virtual address.
-    UInt64 GetAddress() { return mResource->GetGPUVirtualAddress(); }
+    UInt64 GetAddress();
+
+    /// @brief Gets the description the resource was created with.
+    /// @return The resource description.
+    D3D12_RESOURCE_DESC GetResourceDesc();
 
     /// @brief Gets the name of the resource.
     /// @return The name of the resource.
@@ -49,6 +49,11 @@ Surface::~Surface()
     D3DUtils::Release(mSwapchain);
 }
 
+UInt32 Surface::GetBackbufferIndex()
+{
+    return mSwapchain->GetCurrentBackBufferIndex();
+}
+
 void Surface::Present(bool vsync)
 {
     mSwapchain->Present(vsync ? 1 : 0, vsync ? 0 : DXGI_PRESENT_ALLOW_TEARING);
@@ -38,7 +38,7 @@ public:
 
     /// @brief Retrieves the index of the current backbuffer.
     /// @return The index of the current backbuffer.
-    UInt32 GetBackbufferIndex() { return mSwapchain->GetCurrentBackBufferIndex(); }
+    UInt32 GetBackbufferIndex();
 
     /// @brief Retrieves a reference to a backbuffer at the specified index.
     /// @param idx The index of the backbuffer to retrieve.
@@ -54,5 +54,9 @@ private:
     IDXGISwapChain4* mSwapchain = nullptr; ///< The swap chain interface for presenting images to the screen.
     Array<Texture::Ref, FRAMES_IN_FLIGHT> mBackbuffers; ///< Array of backbuffers for double/triple buffering.
     Array<View::Ref, FRAMES_IN_FLIGHT> mBackbufferViews; ///< Array of views for the backbuffers.
+
+#if defined(MNEMEN_RHI_NULL)
+    UInt32 mBackbufferIndex = 0; ///< Backbuffer the null backend pretends to present next.
+#endif
 };
 
@@ -6,6 +6,11 @@
 #include <RHI/Uploader.hpp>
 #include <Core/Logger.hpp>
 #include <Core/Timer.hpp>
+#include <Core/Counters.hpp>
+
+static Counter sUploadedBytes("Uploaded Bytes");
+static Counter sUploadRequests("Upload Requests");
+static Counter sUploadFlushes("Upload Flushes");
 
 Uploader::Data Uploader::sData;
 
@@ -15,13 +20,15 @@ void Uploader::Init(RHI* rhi, Device::Ref device, DescriptorHeaps heaps, Queue::
     sData.Device = device;
     sData.Heaps = heaps;
     sData.UploadQueue = queue;
+    sData.UploadFence = MakeRef<Fence>(device);
+    sData.InFlight.clear();
     sData.CmdBuffer = nullptr;
     sData.BufferRequests = 0;
     sData.TextureRequests = 0;
     sData.UploadBatchSize = 0;
 }
 
-void Uploader::EnqueueTextureUpload(Vector<UInt8> buffer, Ref<Resource> texture)
+void Uploader::EnqueueTextureUpload(const void* data, UInt64 size, Ref<Resource> texture)
 {
     sData.TextureRequests++;
 
@@ -29,16 +36,27 @@ void Uploader::EnqueueTextureUpload(Vector<UInt8> buffer, Ref<Resource> texture)
     request.Type = UploadRequestType::TextureToGPU;
     request.Resource = texture;
     
-    D3D12_RESOURCE_DESC desc = texture->GetResource()->GetDesc();
+    D3D12_RESOURCE_DESC desc = texture->GetResourceDesc();
     Vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> footprints(desc.MipLevels);
     Vector<UInt32> numRows(desc.MipLevels);
     Vector<UInt64> rowSizes(desc.MipLevels);
-    uint64_t totalSize = 0;
 
-    sData.Device->GetDevice()->GetCopyableFootprints(&desc, 0, desc.MipLevels, 0, footprints.data(), numRows.data(), rowSizes.data(), &totalSize);
+    UInt64 totalSize = sData.Device->GetCopyableFootprints(desc, footprints.data(), numRows.data(), rowSizes.data());
+
+    // The data often points into a mapped file, never read past its end
+    UInt64 packedSize = 0;
+    for (int i = 0; i < desc.MipLevels; i++) {
+        packedSize += numRows[i] * rowSizes[i];
+    }
+    if (!data || size < packedSize) {
+        LOG_ERROR("Texture {0} needs {1} bytes of data, got {2}", texture->GetName(), packedSize, size);
+        sData.TextureRequests--;
+        return;
+    }
+
     request.StagingBuffer = MakeRef<Buffer>(sData.Device, sData.Heaps, totalSize, 0, BufferType::Copy, "Staging Buffer " + texture->GetName());
 
-    UInt8 *pixels = reinterpret_cast<UInt8*>(buffer.data());    
+    const UInt8 *pixels = reinterpret_cast<const UInt8*>(data);
     UInt8* mapped;
     request.StagingBuffer->Map(0, 0, (void**)&mapped);
     for (int i = 0; i < desc.MipLevels; i++) {
@@ -59,7 +77,12 @@ void Uploader::EnqueueTextureUpload(Vector<UInt8> buffer, Ref<Resource> texture)
     }
 }
 
-void Uploader::EnqueueTextureUpload(Image image, Ref<Resource> buffer)
+void Uploader::EnqueueTextureUpload(const Vector<UInt8>& buffer, Ref<Resource> texture)
+{
+    EnqueueTextureUpload(buffer.data(), buffer.size(), texture);
+}
+
+void Uploader::EnqueueTextureUpload(const Image& image, Ref<Resource> buffer)
 {
     sData.TextureRequests++;
 
@@ -67,16 +90,15 @@ void Uploader::EnqueueTextureUpload(Image image, Ref<Resource> buffer)
     request.Type = UploadRequestType::TextureToGPU;
     request.Resource = buffer;
     
-    D3D12_RESOURCE_DESC desc = buffer->GetResource()->GetDesc();
+    D3D12_RESOURCE_DESC desc = buffer->GetResourceDesc();
     Vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> footprints(desc.MipLevels);
     Vector<UInt32> numRows(desc.MipLevels);
     Vector<UInt64> rowSizes(desc.MipLevels);
-    uint64_t totalSize = 0;
 
-    sData.Device->GetDevice()->GetCopyableFootprints(&desc, 0, desc.MipLevels, 0, footprints.data(), numRows.data(), rowSizes.data(), &totalSize);
+    UInt64 totalSize = sData.Device->GetCopyableFootprints(desc, footprints.data(), numRows.data(), rowSizes.data());
     request.StagingBuffer = MakeRef<Buffer>(sData.Device, sData.Heaps, totalSize, 0, BufferType::Copy, "Staging Buffer " + buffer->GetName());
 
-    UInt8 *pixels = reinterpret_cast<UInt8*>(image.Pixels.data());    
+    const UInt8 *pixels = reinterpret_cast<const UInt8*>(image.Pixels.data());
     UInt8* mapped;
     request.StagingBuffer->Map(0, 0, (void**)&mapped);
     for (int i = 0; i < desc.MipLevels; i++) {
@@ -97,7 +119,7 @@ void Uploader::EnqueueTextureUpload(Image image, Ref<Resource> buffer)
     }
 }
 
-void Uploader::EnqueueBufferUpload(void* data, UInt64 size, Ref<Resource> buffer)
+void Uploader::EnqueueBufferUpload(const void* data, UInt64 size, Ref<Resource> buffer)
 {
     sData.BufferRequests++;
 
@@ -133,13 +155,14 @@ void Uploader::EnqueueAccelerationStructureBuild(Ref<AccelerationStructure> as)
 
 bool Uploader::Flush()
 {
+    ReleaseCompletedBatches();
     if (sData.Requests.empty())
         return false;
 
     sData.CmdBuffer = MakeRef<CommandBuffer>(sData.Device, sData.UploadQueue, sData.Heaps, true);
     sData.CmdBuffer->Begin();
 
-    LOG_INFO("Flushing {0} upload requests ({1} buffer uploads, {2} texture uploads, {3} acceleration structure builds)", sData.Requests.size(), sData.BufferRequests, sData.TextureRequests, sData.ASRequests);
+    LOG_DEBUG("Flushing {0} upload requests ({1} buffer uploads, {2} texture uploads, {3} acceleration structure builds)", sData.Requests.size(), sData.BufferRequests, sData.TextureRequests, sData.ASRequests);
     for (auto request : sData.Requests) {        
         switch (request.Type) {
             case UploadRequestType::BufferCPUToGPU: {
@@ -172,9 +195,23 @@ bool Uploader::Flush()
     sData.CmdBuffer->End();
     sData.UploadQueue->Submit({ sData.CmdBuffer });
 
-    // Wait and clear
-    sData.Rhi->Wait();
-    ClearRequests();
+    sUploadedBytes.Add(sData.UploadBatchSize);
+    sUploadRequests.Add(sData.Requests.size());
+    sUploadFlushes.Increment();
+
+    // The staging buffers must outlive the copies, the batch is released by a later flush once the fence went past it
+    UploadBatch batch;
+    batch.FenceValue = sData.UploadFence->Signal(sData.UploadQueue);
+    batch.CmdBuffer = std::move(sData.CmdBuffer);
+    batch.Requests = std::move(sData.Requests);
+    sData.InFlight.push_back(std::move(batch));
+
+    sData.UploadBatchSize = 0;
+    sData.BufferRequests = 0;
+    sData.TextureRequests = 0;
+    sData.ASRequests = 0;
+    sData.CmdBuffer.reset();
+    sData.Requests.clear();
     return true;
 }
 
@@ -186,4 +223,26 @@ void Uploader::ClearRequests()
     sData.ASRequests = 0;
     sData.CmdBuffer.reset();
     sData.Requests.clear();
+    sData.InFlight.clear();
+}
+
+UInt64 Uploader::GetNextFenceValue()
+{
+    return sData.UploadFence->GetValue() + 1;
+}
+
+bool Uploader::IsComplete(UInt64 value)
+{
+    return sData.UploadFence->GetCompletedValue() >= value;
+}
+
+void Uploader::ReleaseCompletedBatches()
+{
+    if (sData.InFlight.empty())
+        return;
+
+    UInt64 completed = sData.UploadFence->GetCompletedValue();
+    std::erase_if(sData.InFlight, [completed](const UploadBatch& batch) {
+        return batch.FenceValue <= completed;
+    });
 }
@@ -13,6 +13,7 @@
 #include <RHI/Queue.hpp>
 #include <RHI/Buffer.hpp>
 #include <RHI/AccelerationStructure.hpp>
+#include <RHI/Fence.hpp>
 #include <RHI/RHI.hpp>
 #include <Asset/Image.hpp>
 
@@ -34,35 +35,52 @@ public:
     /// @param queue The queue used to enqueue the upload operations.
     static void Init(RHI* rhi, Device::Ref device, DescriptorHeaps heaps, Queue::Ref queue);
 
+    /// @brief Enqueues a texture upload request from raw memory, copied straight into the staging buffer.
+    /// @param data The texture data, every mip tightly packed one after the other.
+    /// @param size Size of the data, in bytes.
+    /// @param texture The resource to which the texture is being uploaded.
+    static void EnqueueTextureUpload(const void* data, UInt64 size, Ref<Resource> texture);
+
     /// @brief Enqueues a texture upload request from a raw buffer.
     /// @param buffer A vector of UInt8 representing the texture data.
     /// @param texture The resource to which the texture is being uploaded.
-    static void EnqueueTextureUpload(Vector<UInt8> buffer, Ref<Resource> texture);
+    static void EnqueueTextureUpload(const Vector<UInt8>& buffer, Ref<Resource> texture);
 
     /// @brief Enqueues a texture upload request from an image.
     /// @param image The image containing texture data to upload.
     /// @param buffer The resource to which the texture is being uploaded.
-    static void EnqueueTextureUpload(Image image, Ref<Resource> buffer);
+    static void EnqueueTextureUpload(const Image& image, Ref<Resource> buffer);
 
     /// @brief Enqueues a buffer upload request.
     /// @param data Pointer to the data to be uploaded.
     /// @param size Size of the data to upload.
     /// @param buffer The buffer to which the data is being uploaded.
-    static void EnqueueBufferUpload(void* data, UInt64 size, Ref<Resource> buffer);
+    static void EnqueueBufferUpload(const void* data, UInt64 size, Ref<Resource> buffer);
 
     /// @brief Enqueues a request to build an acceleration structure.
     /// @param as Reference to the acceleration structure to be built.
     static void EnqueueAccelerationStructureBuild(Ref<AccelerationStructure> as);
 
     /// @brief Flushes all pending upload requests to the GPU.
-    /// @details This function will process all enqueued upload requests, ensuring that they are transferred to the GPU.
+    /// @details This function submits all enqueued upload requests and signals the upload fence, without waiting for the GPU.
+    ///          Work submitted to the upload queue afterwards runs after the copies. The staging buffers of every batch the GPU
+    ///          is done with are released here too.
     /// @return True if there was something to flush, otherwise false
     static bool Flush();
 
-    /// @brief Clears all enqueued upload requests.
-    /// @details This function clears all pending upload requests, effectively resetting the state of the uploader.
+    /// @brief Clears all enqueued upload requests and every batch still in flight.
+    /// @details Only call this while the GPU is idle, the staging buffers of batches in flight are released right away.
     static void ClearRequests();
 
+    /// @brief Gets the fence value the next flush will signal.
+    /// @return The fence value. Once IsComplete returns true for it, the GPU is done with everything submitted before that flush.
+    static UInt64 GetNextFenceValue();
+
+    /// @brief Checks whether the GPU went past an upload fence value.
+    /// @param value The fence value, as returned by GetNextFenceValue.
+    /// @return True if the value was signaled and reached, otherwise false.
+    static bool IsComplete(UInt64 value);
+
 private:
     /// @brief The maximum upload batch size (512 MB).
     /// @details Uploads exceeding this size will be split into multiple batches for processing.
@@ -86,6 +104,17 @@ private:
         Ref<AccelerationStructure> Acceleration = nullptr; ///< Acceleration structure associated with build requests.
     };
 
+    /// @brief A flushed batch of requests, kept alive until the GPU went past its fence value.
+    struct UploadBatch
+    {
+        UInt64 FenceValue = 0; ///< Value signaled on the upload queue after the batch.
+        CommandBuffer::Ref CmdBuffer = nullptr; ///< Command buffer the batch was recorded in.
+        Vector<UploadRequest> Requests; ///< Requests of the batch, holding their staging buffers.
+    };
+
+    /// @brief Releases the batches the GPU is done with.
+    static void ReleaseCompletedBatches();
+
     /// @brief Structure storing uploader's state data.
     static struct Data
     {
@@ -95,6 +124,8 @@ private:
         Queue::Ref UploadQueue = nullptr; ///< The queue used to enqueue the upload operations.
         CommandBuffer::Ref CmdBuffer = nullptr; ///< Command buffer used for batching upload operations.
         Vector<UploadRequest> Requests; ///< List of enqueued upload requests.
+        Fence::Ref UploadFence = nullptr; ///< Signaled on the upload queue after every flush.
+        Vector<UploadBatch> InFlight; ///< Flushed batches the GPU may still be copying from.
 
         int TextureRequests = 0; ///< Counter for texture upload requests.
         int BufferRequests = 0; ///< Counter for buffer upload requests.
@@ -21,9 +21,9 @@ ColorGrading::ColorGrading(RHI::Ref rhi)
 }
 
 
-void ColorGrading::Render(const Frame& frame, ::Ref<Scene> scene)
+void ColorGrading::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
-    CameraComponent* mainCamera = scene->GetMainCamera();
+    const RenderCamera* mainCamera = snapshot.GetMainCamera();
     if (!mainCamera)
         return;
 
@@ -64,29 +64,29 @@ void ColorGrading::Render(const Frame& frame, ::Ref<Scene> scene)
     } PushConstants = {
         //descriptor of the HDR texture to write to (storage view type)
         color->Descriptor(ViewType::Storage),
-        mainCamera->Volume->Volume.Brightness,
-        mainCamera->Volume->Volume.Exposure,
+        mainCamera->Volume.Brightness,
+        mainCamera->Volume.Exposure,
         0.0,
 
-        mainCamera->Volume->Volume.Contrast,
-        mainCamera->Volume->Volume.Saturation,
+        mainCamera->Volume.Contrast,
+        mainCamera->Volume.Saturation,
         glm::vec2(0.0f),
        
-        mainCamera->Volume->Volume.HueShift,
-        mainCamera->Volume->Volume.Balance,
+        mainCamera->Volume.HueShift,
+        mainCamera->Volume.Balance,
         glm::vec2(0.0f),
 
-        mainCamera->Volume->Volume.Shadows,
-        mainCamera->Volume->Volume.ColorFilter,
+        mainCamera->Volume.Shadows,
+        mainCamera->Volume.ColorFilter,
 
-        mainCamera->Volume->Volume.Highlights,
+        mainCamera->Volume.Highlights,
 
-        mainCamera->Volume->Volume.Temperature,
-        mainCamera->Volume->Volume.Tint,
+        mainCamera->Volume.Temperature,
+        mainCamera->Volume.Tint,
         glm::vec2(0.0f)
     };
 
-    if (mainCamera->Volume->Volume.EnableColorGrading) {
+    if (mainCamera->Volume.EnableColorGrading) {
         frame.CommandBuffer->BeginMarker("Color Grading");
         frame.CommandBuffer->Barrier(color->Texture, ResourceLayout::Storage);
         frame.CommandBuffer->SetComputePipeline(mPipeline);
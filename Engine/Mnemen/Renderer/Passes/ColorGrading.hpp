@@ -38,8 +38,8 @@ public:
     /// This function applies the color grading adjustments to the given frame and scene.
     ///
     /// @param frame The frame to render.
-    /// @param scene The scene to apply color grading to.
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    /// @param snapshot The render snapshot to apply color grading to.
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 
 private:
     /// @brief The compute pipeline used for the color grading effect.
@@ -36,11 +36,11 @@ Composite::Composite(RHI::Ref rhi)
     ldr->AddView(ViewType::RenderTarget);
 }
 
-void Composite::Render(const Frame& frame, ::Ref<Scene> scene)
+void Composite::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
-    auto camera = scene->GetMainCamera();
+    const RenderCamera* camera = snapshot.GetMainCamera();
 
     auto hdr = RendererTools::Get("HDRColorBuffer");
     auto ldr = RendererTools::Get("LDRColorBuffer");
@@ -61,7 +61,7 @@ void Composite::Render(const Frame& frame, ::Ref<Scene> scene)
         } PushConstants = {
             hdr->Descriptor(ViewType::ShaderResource),
             ldr->Descriptor(ViewType::Storage),
-            camera->Volume->Volume.GammaCorrection,
+            camera->Volume.GammaCorrection,
             0
         };
 
@@ -43,8 +43,8 @@ public:
     /// This method converts the main color buffer back to low dynamic range and copies to the backbuffer.
     /// 
     /// @param frame The frame data that includes rendering parameters.
-    /// @param scene The scene to apply the composite render pass to.
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    /// @param snapshot The render snapshot to apply the composite render pass to.
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 
 private:
     ComputePipeline::Ref mPipeline; ///< A reference to the compute pipeline used for the composite pass.
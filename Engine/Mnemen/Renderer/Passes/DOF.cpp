@@ -17,11 +17,11 @@ DOF::DOF(RHI::Ref rhi)
     mPipeline = mRHI->CreateComputePipeline(computeShader->Shader, signature);
 }
 
-void DOF::Render(const Frame& frame, ::Ref<Scene> scene)
+void DOF::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
-    CameraComponent* mainCamera = scene->GetMainCamera();
+    const RenderCamera* mainCamera = snapshot.GetMainCamera();
     if (!mainCamera)
         return;
 
@@ -43,11 +43,11 @@ void DOF::Render(const Frame& frame, ::Ref<Scene> scene)
 
         mainCamera->Near,
         mainCamera->Far,
-        mainCamera->Volume->Volume.FocusPoint,
-        mainCamera->Volume->Volume.FocusRange
+        mainCamera->Volume.FocusPoint,
+        mainCamera->Volume.FocusRange
     };
 
-    if (mainCamera->Volume->Volume.EnableDOF) {
+    if (mainCamera->Volume.EnableDOF) {
         frame.CommandBuffer->BeginMarker("Depth of field");
         frame.CommandBuffer->Barrier(color->Texture, ResourceLayout::Storage);
         frame.CommandBuffer->Barrier(depth->Texture, ResourceLayout::Shader);
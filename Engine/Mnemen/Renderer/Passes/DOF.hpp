@@ -22,5 +22,5 @@ public:
     ComputePipeline::Ref mPipeline;
 
     void Bake(::Ref<Scene> scene) {}
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 };
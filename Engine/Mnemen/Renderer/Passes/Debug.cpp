@@ -11,6 +11,7 @@
 #include <glm/gtx/rotate_vector.hpp>
 
 #include <Core/Profiler.hpp>
+#include <Core/Arena.hpp>
 
 Debug::Data Debug::sData;
 
@@ -38,22 +39,23 @@ Debug::Debug(RHI::Ref rhi)
     }
 }
 
-void Debug::Render(const Frame& frame, ::Ref<Scene> scene)
+void Debug::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
     auto cameraBuffer = RendererTools::Get("CameraRingBuffer");
     auto ldr = RendererTools::Get("LDRColorBuffer");
 
-    CameraComponent* camera = {};
-    if (scene) {
-        camera = scene->GetMainCamera();
-    }
+    const RenderCamera* camera = snapshot.GetMainCamera();
+    if (!camera)
+        return;
 
-    if (!sData.Lines.empty()) {
-        mLineCount = sData.Lines.size();
-        Vector<LineVertex> vertices;
-        for (Line line : sData.Lines) {
+    if (!snapshot.DebugLines.empty()) {
+        mLineCount = std::min<UInt64>(snapshot.DebugLines.size(), MAX_LINES / 2);
+        ArenaVector<LineVertex> vertices(FrameArena::Get());
+        vertices.reserve(mLineCount * 2);
+        for (UInt64 i = 0; i < mLineCount; i++) {
+            const Line& line = snapshot.DebugLines[i];
             vertices.push_back({ line.From, line.Color });
             vertices.push_back({ line.To, line.Color });
         }
@@ -83,13 +85,23 @@ void Debug::Render(const Frame& frame, ::Ref<Scene> scene)
         frame.CommandBuffer->GraphicsPushConstants(pushConstants, sizeof(pushConstants), 0);
         frame.CommandBuffer->Draw(vertices.size());
         frame.CommandBuffer->EndMarker();
-        
-        sData.Lines.clear();
     }
 }
 
+void Debug::ConsumeLines(Vector<Line>& lines)
+{
+    std::lock_guard<std::mutex> lock(sData.Mutex);
+    lines.swap(sData.Lines);
+    sData.Lines.clear();
+}
+
 void Debug::DrawLine(glm::vec3 from, glm::vec3 to, glm::vec3 color)
 {
+    std::lock_guard<std::mutex> lock(sData.Mutex);
+
+    // Render() only uploads MAX_LINES / 2 lines, dropping the rest here keeps the vector from growing without bound.
+    if (sData.Lines.size() >= MAX_LINES / 2)
+        return;
     sData.Lines.push_back(
         { from, to, color }
     );
@@ -97,15 +109,9 @@ void Debug::DrawLine(glm::vec3 from, glm::vec3 to, glm::vec3 color)
 
 void Debug::DrawTriangle(glm::vec3 a, glm::vec3 b, glm::vec3 c, glm::vec3 color)
 {
-    sData.Lines.push_back(
-        { a, b, color }
-    );
-    sData.Lines.push_back(
-        { b, c, color }
-    );
-    sData.Lines.push_back(
-        { c, a, color }
-    );
+    DrawLine(a, b, color);
+    DrawLine(b, c, color);
+    DrawLine(c, a, color);
 }
 
 void Debug::DrawArrow(glm::vec3 from, glm::vec3 to, glm::vec3 color, float size)
@@ -7,6 +7,8 @@
 
 #include <Renderer/RenderPass.hpp>
 
+#include <mutex>
+
 /// @class Debug
 /// @brief A class that handles debug rendering for visualizing geometries and scenes.
 ///
@@ -16,17 +18,8 @@
 class Debug : public RenderPass
 {
 public:
-    /// @struct Line
-    /// @brief A structure to represent a line in 3D space.
-    ///
-    /// This structure contains information about the start point, end point, and color
-    /// of a line to be rendered.
-    struct Line
-    {
-        glm::vec3 From; ///< The starting point of the line.
-        glm::vec3 To; ///< The ending point of the line.
-        glm::vec3 Color; ///< The color of the line.
-    };
+    /// @brief A line in 3D space, shared with the render snapshot.
+    using Line = DebugLine;
 
     /// @brief Constructs a Debug object.
     ///
@@ -51,8 +44,16 @@ public:
     /// This function renders the debug visuals (lines, shapes, etc.) for the provided frame and scene.
     ///
     /// @param frame The frame to render for.
-    /// @param scene The scene to render for.
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    /// @param snapshot The render snapshot to render for.
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
+
+    /// @brief Moves every line queued so far into the given vector.
+    ///
+    /// Called when extracting the render snapshot. Lines drawn after this call (including the ones
+    /// drawn by render passes themselves) show up in the next snapshot.
+    ///
+    /// @param lines The vector receiving the lines. Its previous content is discarded.
+    static void ConsumeLines(Vector<Line>& lines);
 
     /// @brief Draws a line from one point to another with a given color.
     ///
@@ -190,6 +191,7 @@ private:
     static struct Data
     {
         Vector<Line> Lines; ///< A vector holding the lines to be drawn.
+        std::mutex Mutex; ///< Lines can be queued from the simulation and the render thread.
         GraphicsPipeline::Ref Pipeline; ///< The graphics pipeline used for rendering.
         Array<Buffer::Ref, FRAMES_IN_FLIGHT> TransferBuffer; ///< Transfer buffers for each frame.
         Array<Buffer::Ref, FRAMES_IN_FLIGHT> VertexBuffer; ///< Vertex buffers for each frame.
@@ -88,14 +88,14 @@ Deferred::Deferred(RHI::Ref rhi)
     }
 }
 
-void Deferred::Render(const Frame& frame, ::Ref<Scene> scene)
+void Deferred::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
-    CameraComponent* mainCamera = scene->GetMainCamera();
+    const RenderCamera* mainCamera = snapshot.GetMainCamera();
     if (!mainCamera)
         return;
-    if (!mainCamera->Volume)
+    if (!mainCamera->HasVolume)
         return;
 
     auto sampler = RendererTools::Get("MaterialSampler");
@@ -159,8 +159,8 @@ void Deferred::Render(const Frame& frame, ::Ref<Scene> scene)
         colorBuffer->Descriptor(ViewType::Storage),
 
         pbrBuffer->Descriptor(ViewType::ShaderResource),
-        scene->GetSkybox()->IrradianceMapSRV->GetDescriptor().Index,
-        scene->GetSkybox()->PrefilterMapSRV->GetDescriptor().Index,
+        snapshot.Skybox->IrradianceMapSRV->GetDescriptor().Index,
+        snapshot.Skybox->PrefilterMapSRV->GetDescriptor().Index,
         brdf->Descriptor(ViewType::ShaderResource),
 
         cubeSampler->Descriptor(),
@@ -170,8 +170,8 @@ void Deferred::Render(const Frame& frame, ::Ref<Scene> scene)
 
         shadowSampler->Descriptor(),
         cameraBuffer->Descriptor(ViewType::None, frame.FrameIndex),
-        mainCamera->Volume->Volume.DirectLight,
-        mainCamera->Volume->Volume.IndirectLight
+        mainCamera->Volume.DirectLight,
+        mainCamera->Volume.IndirectLight
     };
 
     frame.CommandBuffer->BeginMarker("Light Accumulation");
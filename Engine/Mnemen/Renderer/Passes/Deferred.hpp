@@ -35,8 +35,8 @@ public:
     /// This method renders the scene using the deferred rendering technique.
     /// 
     /// @param frame The frame data that includes rendering parameters.
-    /// @param scene The scene to be rendered.
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    /// @param snapshot The render snapshot to be rendered.
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 
 private:
     ComputePipeline::Ref mBRDFPipeline; ///< A reference to the BRDF generation pipeline.
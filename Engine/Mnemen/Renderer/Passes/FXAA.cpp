@@ -35,16 +35,16 @@ FXAA::FXAA(RHI::Ref rhi)
     RendererTools::CreateSharedSampler("FXAASampler", SamplerFilter::Linear, SamplerAddress::Wrap);
 }
 
-void FXAA::Render(const Frame& frame, ::Ref<Scene> scene)
+void FXAA::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
-    CameraComponent* camera = scene->GetMainCamera();
+    const RenderCamera* camera = snapshot.GetMainCamera();
     if (!camera)
         return;
-    if (!camera->Volume)
+    if (!camera->HasVolume)
         return;
-    if (!camera->Volume->Volume.EnableFXAA)
+    if (!camera->Volume.EnableFXAA)
         return;
 
     auto hdr = RendererTools::Get("HDRColorBuffer");
@@ -13,7 +13,7 @@ public:
     FXAA(RHI::Ref rhi);
     ~FXAA() = default;
 
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 private:
     ComputePipeline::Ref mPipeline;
 };
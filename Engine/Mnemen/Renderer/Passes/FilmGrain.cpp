@@ -13,14 +13,14 @@ FilmGrain::FilmGrain(RHI::Ref rhi)
     mPipeline = mRHI->CreateComputePipeline(computeShader->Shader, signature);
 }
 
-void FilmGrain::Render(const Frame& frame, ::Ref<Scene> scene)
+void FilmGrain::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {   
-    CameraComponent* camera = scene->GetMainCamera();
+    const RenderCamera* camera = snapshot.GetMainCamera();
     if (!camera)
         return;
-    if (!camera->Volume)
+    if (!camera->HasVolume)
         return;
-    if (!camera->Volume->Volume.EnableFilmGrain)
+    if (!camera->Volume.EnableFilmGrain)
         return;
 
     auto color = RendererTools::Get("LDRColorBuffer");
@@ -33,11 +33,11 @@ void FilmGrain::Render(const Frame& frame, ::Ref<Scene> scene)
     } PushConstants = {
         color->Descriptor(ViewType::Storage),
         0,
-        camera->Volume->Volume.FilmGrainAmount,
+        camera->Volume.FilmGrainAmount,
         mTimer.GetElapsed(),
     };
     
-    // Your settings are in camera->Volume->Volume
+    // Your settings are in camera->Volume
     //
 
     frame.CommandBuffer->BeginMarker("Film Grain");
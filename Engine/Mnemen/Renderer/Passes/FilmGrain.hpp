@@ -14,7 +14,7 @@ public:
     FilmGrain(RHI::Ref rhi);
     ~FilmGrain() = default;
 
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 private:
     ComputePipeline::Ref mPipeline;
     Timer mTimer; 
@@ -8,7 +8,11 @@
 #include <Asset/AssetManager.hpp>
 #include <Core/Application.hpp>
 #include <Core/Profiler.hpp>
-#include <Core/Statistics.hpp>
+#include <Core/Counters.hpp>
+
+static Counter sVisiblePrimitives("GBuffer Visible Primitives");
+static Counter sCulledPrimitives("GBuffer Culled Primitives");
+static Counter sDrawnTriangles("GBuffer Triangles");
 
 GBuffer::GBuffer(RHI::Ref rhi)
     : RenderPass(rhi)
@@ -102,7 +106,7 @@ GBuffer::GBuffer(RHI::Ref rhi)
         specs.DepthEnabled = true;
         specs.DepthFormat = TextureFormat::Depth32;
         specs.CCW = false;
-        specs.Signature = mRHI->CreateRootSignature({ RootType::PushConstant }, sizeof(int) * 12 + (sizeof(glm::mat4) * 2));
+        specs.Signature = mRHI->CreateRootSignature({ RootType::PushConstant }, sizeof(int) * 16 + (sizeof(glm::mat4) * 2));
         specs.UseAmplification = true;
 
         mPipeline = mRHI->CreateMeshPipeline(specs);
@@ -112,7 +116,7 @@ GBuffer::GBuffer(RHI::Ref rhi)
     RendererTools::CreateSharedSampler("MaterialSampler", SamplerFilter::Linear, SamplerAddress::Wrap, true);
 }
 
-void GBuffer::Render(const Frame& frame, ::Ref<Scene> scene)
+void GBuffer::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
@@ -126,10 +130,7 @@ void GBuffer::Render(const Frame& frame, ::Ref<Scene> scene)
     auto whiteTexture = RendererTools::Get("WhiteTexture");
     auto blackTexture = RendererTools::Get("BlackTexture");
 
-    CameraComponent* camera = {};
-    if (scene) {
-        camera = scene->GetMainCamera();
-    }
+    const RenderCamera* camera = snapshot.GetMainCamera();
     if (!camera)
         return;
 
@@ -160,17 +161,26 @@ void GBuffer::Render(const Frame& frame, ::Ref<Scene> scene)
     frame.CommandBuffer->ClearDepth(depthBuffer->GetView(ViewType::DepthTarget));
     frame.CommandBuffer->SetMeshPipeline(mPipeline);
 
-    // Draw function for each model
-    std::function<void(Frame frame, MeshNode*, Mesh* model, glm::mat4 transform, MaterialComponent* material)> drawNode = [&](Frame frame, MeshNode* node, Mesh* model, glm::mat4 transform, MaterialComponent* material) {
+    // Textures still loading show the placeholder their slot would use without a texture
+    auto textureIndex = [](const Asset::Handle& texture, int fallback) -> int {
+        return texture && texture->IsReady() ? texture->ShaderView->GetDescriptor().Index : fallback;
+    };
+
+    // Draw function for each model. Recurses through itself rather than a std::function so walking the hierarchy doesn't allocate.
+    auto drawNode = [&](auto& self, MeshNode* node, Mesh* model, const glm::mat4& transform, const RenderInstance* material) -> void {
         if (!node) {
             return;
         }
 
-        for (MeshPrimitive primitive : node->Primitives) {
-            if (!primitive.IsBoxInFrustum(transform, camera->View, camera->Projection))
+        for (MeshPrimitive& primitive : node->Primitives) {
+            if (!primitive.IsBoxInFrustum(transform, camera->View, camera->Projection)) {
+                sCulledPrimitives.Increment();
                 continue;
-            Statistics::Get().InstanceCount++;
-            MeshMaterial meshMaterial = model->Materials[primitive.MaterialIndex];
+            }
+            sVisiblePrimitives.Increment();
+            const MeshLOD& lod = primitive.LODs[primitive.SelectLOD(transform, camera->View, camera->Projection, float(frame.Height))];
+            sDrawnTriangles.Add(lod.IndexCount / 3);
+            const MeshMaterial& meshMaterial = model->Materials[primitive.MaterialIndex];
 
             // NOTE(ame): Ugly disgusting piece of shit code but it'll do the trick. Yippee!!!
             int albedoIndex = whiteTexture->Descriptor(ViewType::ShaderResource);
@@ -178,18 +188,18 @@ void GBuffer::Render(const Frame& frame, ::Ref<Scene> scene)
             int pbrIndex = whiteTexture->Descriptor(ViewType::ShaderResource);
             if (material) {
                 if (material->InheritFromModel) {
-                    albedoIndex = meshMaterial.Albedo ? meshMaterial.AlbedoView->GetDescriptor().Index : whiteTexture->Descriptor(ViewType::ShaderResource);
-                    normalIndex = meshMaterial.Normal ? meshMaterial.NormalView->GetDescriptor().Index : -1;
-                    pbrIndex = meshMaterial.PBR ? meshMaterial.PBRView->GetDescriptor().Index : blackTexture->Descriptor(ViewType::ShaderResource);
+                    albedoIndex = textureIndex(meshMaterial.Albedo, whiteTexture->Descriptor(ViewType::ShaderResource));
+                    normalIndex = textureIndex(meshMaterial.Normal, -1);
+                    pbrIndex = textureIndex(meshMaterial.PBR, blackTexture->Descriptor(ViewType::ShaderResource));
                 } else {
-                    albedoIndex = material->Albedo ? material->Albedo->ShaderView->GetDescriptor().Index : whiteTexture->Descriptor(ViewType::ShaderResource);
-                    normalIndex = material->Normal ? material->Normal->ShaderView->GetDescriptor().Index : -1;
-                    pbrIndex = material->PBR ? material->PBR->ShaderView->GetDescriptor().Index : -1;
+                    albedoIndex = textureIndex(material->Albedo, whiteTexture->Descriptor(ViewType::ShaderResource));
+                    normalIndex = textureIndex(material->Normal, -1);
+                    pbrIndex = textureIndex(material->PBR, -1);
                 }
             } else {
-                albedoIndex = meshMaterial.Albedo ? meshMaterial.AlbedoView->GetDescriptor().Index : whiteTexture->Descriptor(ViewType::ShaderResource);
-                normalIndex = meshMaterial.Normal ? meshMaterial.NormalView->GetDescriptor().Index : -1;
-                pbrIndex = meshMaterial.PBR ? meshMaterial.PBRView->GetDescriptor().Index : -1;
+                albedoIndex = textureIndex(meshMaterial.Albedo, whiteTexture->Descriptor(ViewType::ShaderResource));
+                normalIndex = textureIndex(meshMaterial.Normal, -1);
+                pbrIndex = textureIndex(meshMaterial.PBR, -1);
             }
 
             struct PushConstants {
@@ -207,62 +217,58 @@ void GBuffer::Render(const Frame& frame, ::Ref<Scene> scene)
                 int ShowMeshlets;
                 
                 int MeshletBounds;
+                int PositionBuffer;
+                glm::ivec3 Pad;
+
                 glm::mat4 Transform;
                 glm::mat4 InvTransform;
             } data = {
                 cameraBuffer->Descriptor(ViewType::None, frame.FrameIndex),
                 primitive.VertexBuffer->SRV(),
-                primitive.IndexBuffer->SRV(),
-                primitive.MeshletBuffer->SRV(),
-                primitive.MeshletVertices->SRV(),
-                primitive.MeshletTriangles->SRV(),
+                lod.IndexBuffer->SRV(),
+                lod.MeshletBuffer->SRV(),
+                lod.MeshletVertices->SRV(),
+                lod.MeshletTriangles->SRV(),
                 albedoIndex,
                 normalIndex,
                 pbrIndex,
                 sampler->Descriptor(),
-                camera->Volume->Volume.VisualizeMeshlets,
-                primitive.MeshletBounds->SRV(),
-                
-                transform,
+                camera->Volume.VisualizeMeshlets,
+                lod.MeshletBounds->SRV(),
+                primitive.PositionBuffer->SRV(),
+                glm::ivec3(0),
+
+                // Positions are dequantized by the transform, normals only need the model's own inverse
+                transform * primitive.Dequantize,
                 glm::inverse(transform)
             };
-            UInt32 threadGroupCountX = static_cast<UInt32>((primitive.MeshletCount / 32) + 1);
+            UInt32 threadGroupCountX = static_cast<UInt32>((lod.MeshletCount / 32) + 1);
 
+            frame.CommandBuffer->Barrier(primitive.PositionBuffer, ResourceLayout::Shader);
             frame.CommandBuffer->Barrier(primitive.VertexBuffer, ResourceLayout::Shader);
-            frame.CommandBuffer->Barrier(primitive.IndexBuffer, ResourceLayout::Shader);
-            frame.CommandBuffer->Barrier(primitive.MeshletBuffer, ResourceLayout::Shader);
-            frame.CommandBuffer->Barrier(primitive.MeshletVertices, ResourceLayout::Shader);
-            frame.CommandBuffer->Barrier(primitive.MeshletTriangles, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(lod.IndexBuffer, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(lod.MeshletBuffer, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(lod.MeshletVertices, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(lod.MeshletTriangles, ResourceLayout::Shader);
             frame.CommandBuffer->GraphicsPushConstants(&data, sizeof(data), 0);
-            frame.CommandBuffer->DispatchMesh(threadGroupCountX, primitive.IndexCount / 3);
+            frame.CommandBuffer->DispatchMesh(threadGroupCountX, lod.IndexCount / 3);
+            frame.CommandBuffer->Barrier(primitive.PositionBuffer, ResourceLayout::Common);
             frame.CommandBuffer->Barrier(primitive.VertexBuffer, ResourceLayout::Common);
-            frame.CommandBuffer->Barrier(primitive.IndexBuffer, ResourceLayout::Common);
-            frame.CommandBuffer->Barrier(primitive.MeshletBuffer, ResourceLayout::Common);
-            frame.CommandBuffer->Barrier(primitive.MeshletVertices, ResourceLayout::Common);
-            frame.CommandBuffer->Barrier(primitive.MeshletTriangles, ResourceLayout::Common);
+            frame.CommandBuffer->Barrier(lod.IndexBuffer, ResourceLayout::Common);
+            frame.CommandBuffer->Barrier(lod.MeshletBuffer, ResourceLayout::Common);
+            frame.CommandBuffer->Barrier(lod.MeshletVertices, ResourceLayout::Common);
+            frame.CommandBuffer->Barrier(lod.MeshletTriangles, ResourceLayout::Common);
         }
         if (!node->Children.empty()) {
             for (MeshNode* child : node->Children) {
-                drawNode(frame, child, model, transform, material);
+                self(self, child, model, transform, material);
             }
         }
     };
 
-    if (scene) {
-        auto registry = scene->GetRegistry();
-        auto view = registry->view<TransformComponent, MeshComponent>();
-        for (auto [id, transform, mesh] : view.each()) {
-            Entity entity(registry);
-            entity.ID = id;
-            if (mesh.Loaded) {
-                MaterialComponent* component = nullptr;
-                if (entity.HasComponent<MaterialComponent>()) {
-                    component = &entity.GetComponent<MaterialComponent>();
-                }
-
-                drawNode(frame, mesh.MeshAsset->Mesh.Root, &mesh.MeshAsset->Mesh, entity.GetWorldTransform(), component);
-            }
-        }
+    for (const RenderInstance& instance : snapshot.Instances) {
+        const RenderInstance* material = instance.HasMaterial ? &instance : nullptr;
+        drawNode(drawNode, instance.MeshAsset->Mesh.Root, &instance.MeshAsset->Mesh, instance.Transform, material);
     }
     frame.CommandBuffer->Barrier(albedoBuffer->Texture, ResourceLayout::Shader);
     frame.CommandBuffer->Barrier(normalBuffer->Texture, ResourceLayout::Shader);
@@ -13,7 +13,7 @@ public:
     GBuffer(RHI::Ref rhi);
     ~GBuffer() = default;
 
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 private:
     MeshPipeline::Ref mPipeline;
 };
@@ -11,15 +11,15 @@ Pixelization::Pixelization(RHI::Ref rhi)
     // Code goes here
 }
 
-void Pixelization::Render(const Frame& frame, ::Ref<Scene> scene)
+void Pixelization::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
-    CameraComponent* camera = scene->GetMainCamera();
+    const RenderCamera* camera = snapshot.GetMainCamera();
     if (!camera)
         return;
-    if (!camera->Volume)
+    if (!camera->HasVolume)
         return;
 
-    // Your settings are in camera->Volume->Volume
+    // Your settings are in camera->Volume
     //
 
     frame.CommandBuffer->BeginMarker("Posterization");
@@ -13,7 +13,7 @@ public:
     Pixelization(RHI::Ref rhi);
     ~Pixelization() = default;
 
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 private:
     ComputePipeline::Ref mPipeline;
 };
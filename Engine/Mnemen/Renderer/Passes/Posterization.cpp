@@ -19,14 +19,14 @@ Posterization::Posterization(RHI::Ref rhi)
     mPipeline = mRHI->CreateComputePipeline(computerShader->Shader, signature);
 }
 
-void Posterization::Render(const Frame& frame, ::Ref<Scene> scene)
+void Posterization::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
-    CameraComponent* camera = scene->GetMainCamera();
+    const RenderCamera* camera = snapshot.GetMainCamera();
     if (!camera)
         return;
-    if (!camera->Volume)
+    if (!camera->HasVolume)
         return;
-    if (!camera->Volume->Volume.EnablePosterization)
+    if (!camera->Volume.EnablePosterization)
         return;
 
     auto color = RendererTools::Get("HDRColorBuffer");
@@ -35,12 +35,12 @@ void Posterization::Render(const Frame& frame, ::Ref<Scene> scene)
         float Levels;
     } PushConstants = {
         color->Descriptor(ViewType::Storage), 
-        camera->Volume->Volume.PosterizationLevels
+        camera->Volume.PosterizationLevels
     };
 
-    // Your settings are in camera->Volume->Volume
+    // Your settings are in camera->Volume
     //
-    float levels = camera->Volume->Volume.PosterizationLevels;
+    float levels = camera->Volume.PosterizationLevels;
 
     frame.CommandBuffer->BeginMarker("Posterization");
     frame.CommandBuffer->Barrier(color->Texture, ResourceLayout::Storage);
@@ -13,7 +13,7 @@ public:
     Posterization(RHI::Ref rhi);
     ~Posterization() = default;
 
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 private:
     ComputePipeline::Ref mPipeline;
 };
@@ -11,7 +11,7 @@ SSAO::SSAO(RHI::Ref rhi)
     // Alex
 }
 
-void SSAO::Render(const Frame& frame, ::Ref<Scene> scene)
+void SSAO::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
     // Alex
 }
@@ -19,5 +19,5 @@ public:
     ~SSAO() = default;
 
     void Bake(::Ref<Scene> scene) {}
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 };
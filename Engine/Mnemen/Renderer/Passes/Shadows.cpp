@@ -7,8 +7,19 @@
 
 #include <Utility/Math.hpp>
 #include <Core/Profiler.hpp>
+#include <Core/Counters.hpp>
+#include <RHI/Uploader.hpp>
 #include "Debug.hpp"
 
+#include <algorithm>
+#include <cstdio>
+
+static Counter sVisiblePrimitives("Shadow Visible Primitives");
+static Counter sCulledPrimitives("Shadow Culled Primitives");
+static Counter sDrawnTriangles("Shadow Triangles");
+
+static const char* CASCADE_MARKERS[SHADOW_CASCADE_COUNT] = { "Cascade 0", "Cascade 1", "Cascade 2", "Cascade 3" };
+
 Shadows::Shadows(RHI::Ref rhi)
     : RenderPass(rhi)
 {
@@ -62,55 +73,39 @@ Shadows::Shadows(RHI::Ref rhi)
     cascade3->AddView(ViewType::ShaderResource, ViewDimension::Texture, TextureFormat::R32Float);
 }
 
-void Shadows::Render(const Frame& frame, ::Ref<Scene> scene)
+void Shadows::Extract(RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
-  
-    auto view = scene->GetRegistry()->view<SpotLightComponent>();
-  
-    frame.CommandBuffer->BeginMarker("Shadows");
-    {
-        // Directional Lights
-        frame.CommandBuffer->BeginMarker("Cascaded Shadow Maps");
-        RenderCascades(frame, scene);
-        frame.CommandBuffer->EndMarker();
-
-        // Spot Lights
-        {
-            PROFILE_SCOPE("Shadows::RenderSpotLights");
-            frame.CommandBuffer->BeginMarker("Spot Shadow Maps");
-            for (auto [id, spot] : view.each()) {
-                Entity entity(scene->GetRegistry());
-                entity.ID = id;
 
-                RenderSpot(frame, scene, entity);
-            }
-            frame.CommandBuffer->EndMarker();
+    // The render job may still be drawing into these, free them once the GPU went past the next flush
+    std::erase_if(mRetiredSpotLightShadows, [](const RetiredSpotLightShadow& retired) {
+        return Uploader::IsComplete(retired.FenceValue);
+    });
+
+    // Forget about the shadow maps of lights that were deleted
+    for (auto it = mSpotLightShadows.begin(); it != mSpotLightShadows.end();) {
+        bool found = std::any_of(snapshot.SpotLights.begin(), snapshot.SpotLights.end(), [&](const RenderSpotLight& light) {
+            return light.ID == it->first && light.Light.CastShadows;
+        });
+        if (!found) {
+            mRetiredSpotLightShadows.push_back({ it->second, Uploader::GetNextFenceValue() });
+            it = mSpotLightShadows.erase(it);
+        } else {
+            ++it;
         }
-
-        // TODO: Point Lights?
     }
-    frame.CommandBuffer->EndMarker();
-}
 
-void Shadows::RenderSpot(const Frame& frame, ::Ref<Scene> scene, Entity entity)
-{
-    // Is this spot light a new shadow caster? Has the caster been disabled? Free the resources accordingly!!
-    SpotLightComponent& spot = entity.GetComponent<SpotLightComponent>();
-    if (mSpotLightShadows.contains(entity.ID)) {
-        if (!spot.CastShadows) {
-            mRHI->Wait();
-            spot.ShadowMap = -1;
-            mSpotLightShadows.erase(entity.ID);
-            return;
-        }
-    } else {
-        if (spot.CastShadows) {
+    for (RenderSpotLight& light : snapshot.SpotLights) {
+        if (!light.Light.CastShadows)
+            continue;
+
+        // Is this spot light a new shadow caster? Allocate its shadow map!
+        auto it = mSpotLightShadows.find(light.ID);
+        if (it == mSpotLightShadows.end()) {
             SpotLightShadow shadow;
-            shadow.Parent = &spot;
 
             TextureDesc desc;
-            desc.Name = entity.GetComponent<TagComponent>().Tag + " Spot Light Shadow Map";
+            desc.Name = light.Name + " Spot Light Shadow Map";
             desc.Usage = TextureUsage::DepthTarget;
             desc.Width = SPOT_LIGHT_SHADOW_DIMENSION;
             desc.Height = SPOT_LIGHT_SHADOW_DIMENSION;
@@ -122,40 +117,91 @@ void Shadows::RenderSpot(const Frame& frame, ::Ref<Scene> scene, Entity entity)
             shadow.SRV = mRHI->CreateView(shadow.ShadowMap, ViewType::ShaderResource, ViewDimension::Texture, TextureFormat::R32Float);
             shadow.DSV = mRHI->CreateView(shadow.ShadowMap, ViewType::DepthTarget, ViewDimension::Texture);
 
-            mSpotLightShadows[entity.ID] = shadow;
-        } else {
-            return;
+            it = mSpotLightShadows.emplace(light.ID, shadow).first;
         }
+        light.Shadow = it->second;
+        light.Light.ShadowMap = it->second.SRV->GetDescriptor().Index;
+    }
+}
+
+void Shadows::Prepare(const Frame& frame, RenderSnapshot& snapshot)
+{
+    PROFILE_FUNCTION();
+
+    for (RenderSpotLight& light : snapshot.SpotLights) {
+        SpotLightComponent& spot = light.Light;
+        if (!spot.CastShadows)
+            continue;
+
+        float aspect = (float)SPOT_LIGHT_SHADOW_DIMENSION / (float)SPOT_LIGHT_SHADOW_DIMENSION;
+        float nearPlane = 1.0f;
+        float farPlane = 25.0f;
+
+        spot.LightProj = glm::perspective(glm::radians(spot.OuterRadius) * 2, aspect, nearPlane, farPlane);
+        spot.LightView = glm::lookAt(spot.Position, spot.Position + spot.Direction, glm::vec3(0.0f, 1.0f, 0.0f));
     }
+}
 
-    // And then actually render the shadow map...
-    auto shadow = mSpotLightShadows[entity.ID];
-    float aspect = (float)SPOT_LIGHT_SHADOW_DIMENSION / (float)SPOT_LIGHT_SHADOW_DIMENSION;
-    float nearPlane = 1.0f;
-    float farPlane = 25.0f;
+void Shadows::Render(const Frame& frame, const RenderSnapshot& snapshot)
+{
+    PROFILE_FUNCTION();
+  
+    frame.CommandBuffer->BeginMarker("Shadows");
+    {
+        // Directional Lights
+        frame.CommandBuffer->BeginMarker("Cascaded Shadow Maps");
+        RenderCascades(frame, snapshot);
+        frame.CommandBuffer->EndMarker();
 
-    spot.LightProj = glm::perspective(glm::radians(spot.OuterRadius) * 2, aspect, nearPlane, farPlane);
-    spot.LightView = glm::lookAt(spot.Position, spot.Position + spot.Direction, glm::vec3(0.0f, 1.0f, 0.0f));
-    spot.ShadowMap = shadow.SRV->GetDescriptor().Index;
+        // Spot Lights
+        {
+            PROFILE_SCOPE("Shadows::RenderSpotLights");
+            frame.CommandBuffer->BeginMarker("Spot Shadow Maps");
+            for (const RenderSpotLight& light : snapshot.SpotLights) {
+                if (light.Light.CastShadows) {
+                    RenderSpot(frame, snapshot, light);
+                }
+            }
+            frame.CommandBuffer->EndMarker();
+        }
+
+        // TODO: Point Lights?
+    }
+    frame.CommandBuffer->EndMarker();
+}
 
-    frame.CommandBuffer->BeginMarker("Spot Shadows (" + entity.GetComponent<TagComponent>().Tag + ")");
+void Shadows::RenderSpot(const Frame& frame, const RenderSnapshot& snapshot, const RenderSpotLight& light)
+{
+    // Shadow map was allocated in Extract(), matrices were set up in Prepare()
+    const SpotLightComponent& spot = light.Light;
+    const SpotLightShadow& shadow = light.Shadow;
+
+    // Formatted on the stack, light names can be too long for the small string buffer.
+    char marker[128];
+    std::snprintf(marker, sizeof(marker), "Spot Shadows (%s)", light.Name.c_str());
+    frame.CommandBuffer->BeginMarker(marker);
     frame.CommandBuffer->SetMeshPipeline(mCascadePipeline);
     frame.CommandBuffer->Barrier(shadow.ShadowMap, ResourceLayout::DepthWrite);
     frame.CommandBuffer->SetRenderTargets({}, shadow.DSV);
     frame.CommandBuffer->ClearDepth(shadow.DSV);
     frame.CommandBuffer->SetViewport(0, 0, SPOT_LIGHT_SHADOW_DIMENSION, SPOT_LIGHT_SHADOW_DIMENSION);
     frame.CommandBuffer->SetTopology(Topology::TriangleList);
-    std::function<void(Frame frame, MeshNode*, Mesh* model, glm::mat4 transform)> drawNode = [&](Frame frame, MeshNode* node, Mesh* model, glm::mat4 transform) {
+    auto drawNode = [&](auto& self, MeshNode* node, Mesh* model, const glm::mat4& transform) -> void {
         if (!node) {
             return;
         }
 
-        for (MeshPrimitive primitive : node->Primitives) {
-            if (!primitive.IsBoxInFrustum(transform, spot.LightView, spot.LightProj))
+        for (MeshPrimitive& primitive : node->Primitives) {
+            if (!primitive.IsBoxInFrustum(transform, spot.LightView, spot.LightProj)) {
+                sCulledPrimitives.Increment();
                 continue;
+            }
+            sVisiblePrimitives.Increment();
+            const MeshLOD& lod = primitive.LODs[primitive.SelectLOD(transform, spot.LightView, spot.LightProj, SPOT_LIGHT_SHADOW_DIMENSION, SHADOW_LOD_BIAS)];
+            sDrawnTriangles.Add(lod.IndexCount / 3);
 
             struct PushConstants {
-                int VertexBuffer;
+                int PositionBuffer;
                 int IndexBuffer;
                 int MeshletBuffer;
                 int MeshletVertices;
@@ -166,61 +212,51 @@ void Shadows::RenderSpot(const Frame& frame, ::Ref<Scene> scene, Entity entity)
                 glm::mat4 View;
                 glm::mat4 Proj;
             } data = {
-                primitive.VertexBuffer->SRV(),
-                primitive.IndexBuffer->SRV(),
-                primitive.MeshletBuffer->SRV(),
-                primitive.MeshletVertices->SRV(),
-                primitive.MeshletTriangles->SRV(),
+                primitive.PositionBuffer->SRV(),
+                lod.IndexBuffer->SRV(),
+                lod.MeshletBuffer->SRV(),
+                lod.MeshletVertices->SRV(),
+                lod.MeshletTriangles->SRV(),
                 glm::ivec3(0),
                 
-                transform,
+                transform * primitive.Dequantize,
                 spot.LightView,
                 spot.LightProj
             };
-            frame.CommandBuffer->Barrier(primitive.VertexBuffer, ResourceLayout::Shader);
-            frame.CommandBuffer->Barrier(primitive.IndexBuffer, ResourceLayout::Shader);
-            frame.CommandBuffer->Barrier(primitive.MeshletBuffer, ResourceLayout::Shader);
-            frame.CommandBuffer->Barrier(primitive.MeshletVertices, ResourceLayout::Shader);
-            frame.CommandBuffer->Barrier(primitive.MeshletTriangles, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(primitive.PositionBuffer, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(lod.IndexBuffer, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(lod.MeshletBuffer, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(lod.MeshletVertices, ResourceLayout::Shader);
+            frame.CommandBuffer->Barrier(lod.MeshletTriangles, ResourceLayout::Shader);
             frame.CommandBuffer->GraphicsPushConstants(&data, sizeof(data), 0);
-            frame.CommandBuffer->DispatchMesh(primitive.MeshletCount, primitive.IndexCount / 3);
-            frame.CommandBuffer->Barrier(primitive.VertexBuffer, ResourceLayout::Common);
-            frame.CommandBuffer->Barrier(primitive.IndexBuffer, ResourceLayout::Common);
-            frame.CommandBuffer->Barrier(primitive.MeshletBuffer, ResourceLayout::Common);
-            frame.CommandBuffer->Barrier(primitive.MeshletVertices, ResourceLayout::Common);
-            frame.CommandBuffer->Barrier(primitive.MeshletTriangles, ResourceLayout::Common);
+            frame.CommandBuffer->DispatchMesh(lod.MeshletCount, lod.IndexCount / 3);
+            frame.CommandBuffer->Barrier(primitive.PositionBuffer, ResourceLayout::Common);
+            frame.CommandBuffer->Barrier(lod.IndexBuffer, ResourceLayout::Common);
+            frame.CommandBuffer->Barrier(lod.MeshletBuffer, ResourceLayout::Common);
+            frame.CommandBuffer->Barrier(lod.MeshletVertices, ResourceLayout::Common);
+            frame.CommandBuffer->Barrier(lod.MeshletTriangles, ResourceLayout::Common);
         }
         if (!node->Children.empty()) {
             for (MeshNode* child : node->Children) {
-                drawNode(frame, child, model, transform);
+                self(self, child, model, transform);
             }
         }
     };
-    if (scene) {
-        auto registry = scene->GetRegistry();
-        auto view = registry->view<TransformComponent, MeshComponent>();
-        for (auto [id, transform, mesh] : view.each()) {
-            Entity entity(registry);
-            entity.ID = id;
-            if (mesh.Loaded) {
-                drawNode(frame, mesh.MeshAsset->Mesh.Root, &mesh.MeshAsset->Mesh, entity.GetWorldTransform());
-            }
-        }
+    for (const RenderInstance& instance : snapshot.Instances) {
+        drawNode(drawNode, instance.MeshAsset->Mesh.Root, &instance.MeshAsset->Mesh, instance.Transform);
     }
     frame.CommandBuffer->Barrier(shadow.ShadowMap, ResourceLayout::Shader);
     frame.CommandBuffer->EndMarker();
 }
 
-void Shadows::RenderCascades(const Frame& frame, ::Ref<Scene> scene)
+void Shadows::RenderCascades(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
     // Select first dir light that cast shadows
     DirectionalLightComponent caster;
 
-    auto registry = scene->GetRegistry();
-    auto view = registry->view<DirectionalLightComponent>();
-    for (auto [id, dir] : view.each()) {
+    for (const DirectionalLightComponent& dir : snapshot.DirectionalLights) {
         if (dir.CastShadows) {
             caster = dir;
             break;
@@ -230,15 +266,15 @@ void Shadows::RenderCascades(const Frame& frame, ::Ref<Scene> scene)
         return;
 
     // Get main camera for settings
-    CameraComponent* camera = scene->GetMainCamera();
+    const RenderCamera* camera = snapshot.GetMainCamera();
     if (!camera)
         return;
-    if (!camera->Volume)
+    if (!camera->HasVolume)
         return;
 
     // Update
-    if (!camera->Volume->Volume.FreezeCascades) {
-        UpdateCascades(frame, scene, caster);
+    if (!camera->Volume.FreezeCascades) {
+        UpdateCascades(frame, snapshot, caster);
     } else {
         for (int i = 0; i < SHADOW_CASCADE_COUNT; i++) {
             Debug::DrawFrustum(mCascades[i].View, mCascades[i].Proj, glm::vec3(0.0f, 1.0f, 0.0f));
@@ -246,7 +282,7 @@ void Shadows::RenderCascades(const Frame& frame, ::Ref<Scene> scene)
     }
 
     // Render
-    Vector<::Ref<RenderPassResource>> cascades = {
+    Array<::Ref<RenderPassResource>, SHADOW_CASCADE_COUNT> cascades = {
         RendererTools::Get("ShadowCascade0"),
         RendererTools::Get("ShadowCascade1"),
         RendererTools::Get("ShadowCascade2"),
@@ -265,23 +301,28 @@ void Shadows::RenderCascades(const Frame& frame, ::Ref<Scene> scene)
 
     frame.CommandBuffer->SetMeshPipeline(mCascadePipeline);
     for (int i = 0; i < SHADOW_CASCADE_COUNT; i++) {
-        frame.CommandBuffer->BeginMarker("Cascade " + std::to_string(i));
+        frame.CommandBuffer->BeginMarker(CASCADE_MARKERS[i]);
         frame.CommandBuffer->Barrier(cascades[i]->Texture, ResourceLayout::DepthWrite);
         frame.CommandBuffer->SetRenderTargets({}, cascades[i]->GetView(ViewType::DepthTarget));
         frame.CommandBuffer->ClearDepth(cascades[i]->GetView(ViewType::DepthTarget));
         frame.CommandBuffer->SetViewport(0, 0, DIR_LIGHT_SHADOW_DIMENSION, DIR_LIGHT_SHADOW_DIMENSION);
         frame.CommandBuffer->SetTopology(Topology::TriangleList);
-        std::function<void(Frame frame, MeshNode*, Mesh* model, glm::mat4 transform)> drawNode = [&](Frame frame, MeshNode* node, Mesh* model, glm::mat4 transform) {
+        auto drawNode = [&](auto& self, MeshNode* node, Mesh* model, const glm::mat4& transform) -> void {
             if (!node) {
                 return;
             }
 
-            for (MeshPrimitive primitive : node->Primitives) {
-                if (!primitive.IsBoxInFrustum(transform, mCascades[i].View, mCascades[i].Proj))
+            for (MeshPrimitive& primitive : node->Primitives) {
+                if (!primitive.IsBoxInFrustum(transform, mCascades[i].View, mCascades[i].Proj)) {
+                    sCulledPrimitives.Increment();
                     continue;
+                }
+                sVisiblePrimitives.Increment();
+                const MeshLOD& lod = primitive.LODs[primitive.SelectLOD(transform, mCascades[i].View, mCascades[i].Proj, DIR_LIGHT_SHADOW_DIMENSION, SHADOW_LOD_BIAS)];
+                sDrawnTriangles.Add(lod.IndexCount / 3);
 
                 struct PushConstants {
-                    int VertexBuffer;
+                    int PositionBuffer;
                     int IndexBuffer;
                     int MeshletBuffer;
                     int MeshletVertices;
@@ -292,62 +333,54 @@ void Shadows::RenderCascades(const Frame& frame, ::Ref<Scene> scene)
                     glm::mat4 View;
                     glm::mat4 Proj;
                 } data = {
-                    primitive.VertexBuffer->SRV(),
-                    primitive.IndexBuffer->SRV(),
-                    primitive.MeshletBuffer->SRV(),
-                    primitive.MeshletVertices->SRV(),
-                    primitive.MeshletTriangles->SRV(),
+                    primitive.PositionBuffer->SRV(),
+                    lod.IndexBuffer->SRV(),
+                    lod.MeshletBuffer->SRV(),
+                    lod.MeshletVertices->SRV(),
+                    lod.MeshletTriangles->SRV(),
                     glm::ivec3(0),
                     
-                    transform,
+                    transform * primitive.Dequantize,
                     mCascades[i].View,
                     mCascades[i].Proj
                 };
-                frame.CommandBuffer->Barrier(primitive.VertexBuffer, ResourceLayout::Shader);
-                frame.CommandBuffer->Barrier(primitive.IndexBuffer, ResourceLayout::Shader);
-                frame.CommandBuffer->Barrier(primitive.MeshletBuffer, ResourceLayout::Shader);
-                frame.CommandBuffer->Barrier(primitive.MeshletVertices, ResourceLayout::Shader);
-                frame.CommandBuffer->Barrier(primitive.MeshletTriangles, ResourceLayout::Shader);
+                frame.CommandBuffer->Barrier(primitive.PositionBuffer, ResourceLayout::Shader);
+                frame.CommandBuffer->Barrier(lod.IndexBuffer, ResourceLayout::Shader);
+                frame.CommandBuffer->Barrier(lod.MeshletBuffer, ResourceLayout::Shader);
+                frame.CommandBuffer->Barrier(lod.MeshletVertices, ResourceLayout::Shader);
+                frame.CommandBuffer->Barrier(lod.MeshletTriangles, ResourceLayout::Shader);
                 frame.CommandBuffer->GraphicsPushConstants(&data, sizeof(data), 0);
-                frame.CommandBuffer->DispatchMesh(primitive.MeshletCount, primitive.IndexCount / 3);
-                frame.CommandBuffer->Barrier(primitive.VertexBuffer, ResourceLayout::Common);
-                frame.CommandBuffer->Barrier(primitive.IndexBuffer, ResourceLayout::Common);
-                frame.CommandBuffer->Barrier(primitive.MeshletBuffer, ResourceLayout::Common);
-                frame.CommandBuffer->Barrier(primitive.MeshletVertices, ResourceLayout::Common);
-                frame.CommandBuffer->Barrier(primitive.MeshletTriangles, ResourceLayout::Common);
+                frame.CommandBuffer->DispatchMesh(lod.MeshletCount, lod.IndexCount / 3);
+                frame.CommandBuffer->Barrier(primitive.PositionBuffer, ResourceLayout::Common);
+                frame.CommandBuffer->Barrier(lod.IndexBuffer, ResourceLayout::Common);
+                frame.CommandBuffer->Barrier(lod.MeshletBuffer, ResourceLayout::Common);
+                frame.CommandBuffer->Barrier(lod.MeshletVertices, ResourceLayout::Common);
+                frame.CommandBuffer->Barrier(lod.MeshletTriangles, ResourceLayout::Common);
             }
             if (!node->Children.empty()) {
                 for (MeshNode* child : node->Children) {
-                    drawNode(frame, child, model, transform);
+                    self(self, child, model, transform);
                 }
             }
         };
-        if (scene) {
-            auto registry = scene->GetRegistry();
-            auto view = registry->view<TransformComponent, MeshComponent>();
-            for (auto [id, transform, mesh] : view.each()) {
-                Entity entity(registry);
-                entity.ID = id;
-                if (mesh.Loaded) {
-                    drawNode(frame, mesh.MeshAsset->Mesh.Root, &mesh.MeshAsset->Mesh, entity.GetWorldTransform());
-                }
-            }
+        for (const RenderInstance& instance : snapshot.Instances) {
+            drawNode(drawNode, instance.MeshAsset->Mesh.Root, &instance.MeshAsset->Mesh, instance.Transform);
         }
         frame.CommandBuffer->Barrier(cascades[i]->Texture, ResourceLayout::Shader);
         frame.CommandBuffer->EndMarker();
     }
 }
 
-void Shadows::UpdateCascades(const Frame& frame, ::Ref<Scene> scene, DirectionalLightComponent caster)
+void Shadows::UpdateCascades(const Frame& frame, const RenderSnapshot& snapshot, DirectionalLightComponent caster)
 {
-    CameraComponent* camera = scene->GetMainCamera();
+    const RenderCamera* camera = snapshot.GetMainCamera();
     if (!camera)
         return;
-    if (!camera->Volume)
+    if (!camera->HasVolume)
         return;
 
     UInt32 cascadeSize = DIR_LIGHT_SHADOW_DIMENSION;
-    Vector<float> splits(SHADOW_CASCADE_COUNT + 1);
+    Array<float, SHADOW_CASCADE_COUNT + 1> splits;
 
     // Precompute cascade splits using logarithmic split
     splits[0] = camera->Near;
@@ -356,12 +389,12 @@ void Shadows::UpdateCascades(const Frame& frame, ::Ref<Scene> scene, Directional
         float fraction = static_cast<float>(i) / SHADOW_CASCADE_COUNT;
         float linearSplit = camera->Near + (camera->Far - camera->Near) * fraction;
         float logSplit = camera->Near * std::pow(camera->Far / camera->Near, fraction);
-        splits[i] = camera->Volume->Volume.CascadeSplitLambda * logSplit + (1.0f - camera->Volume->Volume.CascadeSplitLambda) * linearSplit;
+        splits[i] = camera->Volume.CascadeSplitLambda * logSplit + (1.0f - camera->Volume.CascadeSplitLambda) * linearSplit;
     }
 
     for (int i = 0; i < SHADOW_CASCADE_COUNT; ++i) {
         // Get frustum corners for the cascade in view space
-        Vector<glm::vec4> corners = Math::CascadeCorners(camera->View, glm::radians(camera->FOV), (float)frame.Width / (float)frame.Height, splits[i], splits[i + 1]);
+        Array<glm::vec4, 8> corners = Math::CascadeCorners(camera->View, glm::radians(camera->FOV), (float)frame.Width / (float)frame.Height, splits[i], splits[i + 1]);
 
         // Calculate center
         glm::vec3 center(0.0f);
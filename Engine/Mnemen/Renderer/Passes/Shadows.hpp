@@ -10,6 +10,7 @@
 constexpr int DIR_LIGHT_SHADOW_DIMENSION = 2048;
 constexpr int SPOT_LIGHT_SHADOW_DIMENSION = 2048;
 constexpr int SHADOW_CASCADE_COUNT = 4;
+constexpr float SHADOW_LOD_BIAS = 4.0f; // Shadow maps hide silhouette errors, they can use coarser levels of detail than the main view
 
 struct Cascade
 {
@@ -21,14 +22,11 @@ struct Cascade
     glm::mat4 Proj;
 };
 
-struct SpotLightShadow
+/// @brief A shadow map of a deleted spot light, kept until the GPU is done with it.
+struct RetiredSpotLightShadow
 {
-    int ParentID;
-    SpotLightComponent* Parent;
-    Texture::Ref ShadowMap;
-    
-    View::Ref SRV;
-    View::Ref DSV;
+    SpotLightShadow Shadow;
+    UInt64 FenceValue;
 };
 
 class Shadows : public RenderPass
@@ -37,14 +35,17 @@ public:
     Shadows(RHI::Ref rhi);
     ~Shadows() = default;
 
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
-    void RenderCascades(const Frame& frame, ::Ref<Scene> scene);
-    void RenderSpot(const Frame& frame, ::Ref<Scene> scene, Entity entity);
+    void Extract(RenderSnapshot& snapshot) override;
+    void Prepare(const Frame& frame, RenderSnapshot& snapshot) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
+    void RenderCascades(const Frame& frame, const RenderSnapshot& snapshot);
+    void RenderSpot(const Frame& frame, const RenderSnapshot& snapshot, const RenderSpotLight& light);
 private:
-    void UpdateCascades(const Frame& frame, ::Ref<Scene> scene, DirectionalLightComponent caster);
+    void UpdateCascades(const Frame& frame, const RenderSnapshot& snapshot, DirectionalLightComponent caster);
 
     MeshPipeline::Ref mCascadePipeline = nullptr;
     Array<Cascade, SHADOW_CASCADE_COUNT> mCascades;
-    UnorderedMap<entt::entity, SpotLightShadow> mSpotLightShadows;
+    UnorderedMap<entt::entity, SpotLightShadow> mSpotLightShadows; // Only touched by Extract(), on the simulation thread
+    Vector<RetiredSpotLightShadow> mRetiredSpotLightShadows;
     int once = 0;
 };
@@ -76,20 +76,20 @@ SkyboxForward::SkyboxForward(RHI::Ref rhi)
     Uploader::EnqueueBufferUpload((void*)CubeVertices, sizeof(CubeVertices), mCubeBuffer);
 }
 
-void SkyboxForward::Render(const Frame& frame, ::Ref<Scene> scene)
+void SkyboxForward::Render(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
-    CameraComponent* mainCamera = scene->GetMainCamera();
+    const RenderCamera* mainCamera = snapshot.GetMainCamera();
     if (!mainCamera)
         return;
-    if (!mainCamera->Volume)
+    if (!mainCamera->HasVolume)
         return;
-    if (!mainCamera->Volume->Volume.EnableSkybox)
+    if (!mainCamera->Volume.EnableSkybox)
         return;
 
     glm::mat4 mvp = mainCamera->Projection * glm::mat4(glm::mat3(mainCamera->View)) * glm::scale(glm::mat4(1.0f), glm::vec3(1000.0f));
-    ::Ref<Skybox> skybox = scene->GetSkybox();
+    ::Ref<Skybox> skybox = snapshot.Skybox;
 
     auto sampler = RendererTools::Get("MaterialSampler");
     auto depthBuffer = RendererTools::Get("GBufferDepth");
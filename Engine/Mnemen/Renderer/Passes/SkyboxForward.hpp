@@ -14,7 +14,7 @@ public:
     SkyboxForward(RHI::Ref rhi);
     ~SkyboxForward() = default;
 
-    void Render(const Frame& frame, ::Ref<Scene> scene) override;
+    void Render(const Frame& frame, const RenderSnapshot& snapshot) override;
 private:
     Buffer::Ref mCubeBuffer;
     GraphicsPipeline::Ref mPipeline;
@@ -7,7 +7,7 @@
 
 #include <RHI/RHI.hpp>
 
-#include "World/Scene.hpp"
+#include "RenderSnapshot.hpp"
 #include "RendererTools.hpp"
 
 /// @brief A class representing a render pass in the rendering pipeline.
@@ -36,15 +36,33 @@ public:
     /// cleanup. The render pass is responsible for its own cleanup when it goes out of scope.
     ~RenderPass() = default;
 
+    /// @brief Lets the pass create the GPU resources a freshly extracted snapshot needs.
+    /// 
+    /// Runs on the simulation thread right after the scene was extracted, while the previous
+    /// frame may still be recording. Resources must be created here and handed to the render job
+    /// through the snapshot, never from Prepare() or Render(). Does nothing by default.
+    /// 
+    /// @param snapshot The snapshot that was just extracted.
+    virtual void Extract(RenderSnapshot& snapshot) {}
+
+    /// @brief Lets the pass patch the snapshot before lights are uploaded and any pass renders.
+    /// 
+    /// Used by passes owning per-light GPU resources (e.g. shadow maps) to write their descriptors
+    /// into the snapshot. Does nothing by default.
+    /// 
+    /// @param frame The current frame that holds information such as time and buffers.
+    /// @param snapshot The render snapshot of the frame.
+    virtual void Prepare(const Frame& frame, RenderSnapshot& snapshot) {}
+
     /// @brief Renders the scene for this render pass.
     /// 
     /// This pure virtual function defines how a particular render pass should render the given 
-    /// frame and scene. Derived classes will implement this method to define the specifics 
+    /// frame and snapshot. Derived classes will implement this method to define the specifics 
     /// of rendering (e.g., forward pass, deferred pass, etc.).
     /// 
     /// @param frame The current frame that holds information such as time and buffers.
-    /// @param scene The scene to be rendered during this pass.
-    virtual void Render(const Frame& frame, ::Ref<Scene> scene) = 0;
+    /// @param snapshot The render data extracted from the scene for this frame.
+    virtual void Render(const Frame& frame, const RenderSnapshot& snapshot) = 0;
 
 protected:
     RHI::Ref mRHI; ///< The rendering hardware interface (RHI) used for GPU operations during this pass.
@@ -0,0 +1,122 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-04 09:12:38
+//
+
+#include "RenderSnapshot.hpp"
+
+#include <Core/Profiler.hpp>
+#include <Utility/Math.hpp>
+
+#include "Passes/Debug.hpp"
+
+void RenderSnapshot::Clear()
+{
+    HasCamera = false;
+    Camera = {};
+    Instances.clear();
+    DirectionalLights.clear();
+    PointLights.clear();
+    SpotLights.clear();
+    DebugLines.clear();
+    Skybox = nullptr;
+}
+
+void RenderSnapshot::Extract(::Ref<Scene> scene)
+{
+    PROFILE_FUNCTION();
+
+    Clear();
+    Debug::ConsumeLines(DebugLines);
+    if (!scene)
+        return;
+
+    auto registry = scene->GetRegistry();
+    Skybox = scene->GetSkybox();
+
+    // Camera
+    CameraComponent* camera = scene->GetMainCamera();
+    if (camera) {
+        HasCamera = true;
+        Camera.FOV = camera->FOV;
+        Camera.Near = camera->Near;
+        Camera.Far = camera->Far;
+        Camera.Position = camera->Position;
+        Camera.View = camera->View;
+        Camera.Projection = camera->Projection;
+        Camera.HasVolume = camera->Volume != nullptr;
+        if (camera->Volume) {
+            Camera.Volume = camera->Volume->Volume;
+        }
+    }
+
+    // Meshes
+    {
+        auto view = registry->view<TransformComponent, MeshComponent>();
+        for (auto [id, transform, mesh] : view.each()) {
+            if (!mesh.Loaded)
+                continue;
+
+            Entity entity(registry);
+            entity.ID = id;
+
+            RenderInstance& instance = Instances.emplace_back();
+            instance.MeshAsset = mesh.MeshAsset;
+            instance.Transform = entity.GetWorldTransform();
+            if (entity.HasComponent<MaterialComponent>()) {
+                MaterialComponent& material = entity.GetComponent<MaterialComponent>();
+                instance.HasMaterial = true;
+                instance.InheritFromModel = material.InheritFromModel;
+                instance.Albedo = material.Albedo;
+                instance.Normal = material.Normal;
+                instance.PBR = material.PBR;
+            }
+        }
+    }
+
+    // Lights
+    {
+        auto view = registry->view<TransformComponent, DirectionalLightComponent>();
+        for (auto [id, t, dir] : view.each()) {
+            Entity entity(registry);
+            entity.ID = id;
+
+            glm::vec3 position, rotation, scale;
+            Math::DecomposeTransform(entity.GetWorldTransform(), position, rotation, scale);
+
+            DirectionalLightComponent& light = DirectionalLights.emplace_back(dir);
+            light.Direction = Math::EulerToForward(rotation);
+        }
+    }
+    {
+        auto view = registry->view<TransformComponent, PointLightComponent>();
+        for (auto [id, t, point] : view.each()) {
+            Entity entity(registry);
+            entity.ID = id;
+
+            glm::vec3 position, rotation, scale;
+            Math::DecomposeTransform(entity.GetWorldTransform(), position, rotation, scale);
+
+            PointLightComponent& light = PointLights.emplace_back(point);
+            light.Position = position;
+        }
+    }
+    {
+        auto view = registry->view<TransformComponent, SpotLightComponent>();
+        for (auto [id, t, spot] : view.each()) {
+            Entity entity(registry);
+            entity.ID = id;
+
+            glm::vec3 position, rotation, scale;
+            Math::DecomposeTransform(entity.GetWorldTransform(), position, rotation, scale);
+
+            RenderSpotLight& light = SpotLights.emplace_back();
+            light.ID = id;
+            light.Name = entity.GetComponent<TagComponent>().Tag;
+            light.Light = spot;
+            light.Light.Position = position;
+            light.Light.Direction = Math::EulerToForward(rotation);
+            light.Light.ShadowMap = -1;
+        }
+    }
+}
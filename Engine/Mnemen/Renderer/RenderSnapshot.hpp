@@ -0,0 +1,94 @@
+//
+// > Notice: Amélie Heinrich @ 2025
+// > Create Time: 2025-03-04 09:12:31
+//
+
+#pragma once
+
+#include <World/Scene.hpp>
+#include <RHI/Texture.hpp>
+#include <RHI/View.hpp>
+
+/// @brief A line queued through the Debug pass.
+struct DebugLine
+{
+    glm::vec3 From; ///< The starting point of the line.
+    glm::vec3 To; ///< The ending point of the line.
+    glm::vec3 Color; ///< The color of the line.
+};
+
+/// @brief The main camera as seen by the renderer.
+struct RenderCamera
+{
+    float FOV = 90.0f; ///< Field of view, in degrees
+    float Near = 0.1f; ///< Near plane
+    float Far = 200.0f; ///< Far plane
+
+    glm::vec3 Position = glm::vec3(0.0f); ///< World position of the camera
+    glm::mat4 View = glm::mat4(1.0f); ///< View matrix
+    glm::mat4 Projection = glm::mat4(1.0f); ///< Projection matrix
+
+    bool HasVolume = false; ///< Whether the camera had a post process volume attached
+    PostProcessVolume Volume; ///< Copy of the post process settings
+};
+
+/// @brief A mesh instance to draw.
+struct RenderInstance
+{
+    Asset::Handle MeshAsset; ///< Keeps the mesh alive for as long as the snapshot references it
+    glm::mat4 Transform = glm::mat4(1.0f); ///< World transform of the instance
+
+    bool HasMaterial = false; ///< Whether the entity had a MaterialComponent
+    bool InheritFromModel = true; ///< Use the textures of the model instead of the ones below
+    Asset::Handle Albedo; ///< Albedo override
+    Asset::Handle Normal; ///< Normal override
+    Asset::Handle PBR; ///< PBR override
+};
+
+/// @brief The shadow map of a spot light and its views.
+struct SpotLightShadow
+{
+    Texture::Ref ShadowMap; ///< The depth texture
+
+    View::Ref SRV; ///< Sampled by the lighting passes
+    View::Ref DSV; ///< Rendered to by the shadow pass
+};
+
+/// @brief A spot light, with the information the shadow pass needs to track it across frames.
+struct RenderSpotLight
+{
+    entt::entity ID = entt::null; ///< The entity the light belongs to
+    String Name; ///< Tag of the entity, used for debug names
+    SpotLightComponent Light; ///< Light data, with world position and direction resolved
+    SpotLightShadow Shadow; ///< Shadow map of the light, allocated on the simulation thread by the passes' Extract()
+};
+
+/// @brief Everything the renderer needs to draw a frame, copied out of the ECS.
+///
+/// The snapshot is filled on the simulation thread by Extract() and is then only read by the
+/// render passes, so the scene can keep simulating the next frame while this one is recorded.
+/// Vectors are cleared but never shrunk, so after a few frames extraction stops allocating.
+struct RenderSnapshot
+{
+    bool HasCamera = false; ///< Whether the scene had a primary camera
+    RenderCamera Camera; ///< The main camera
+
+    Vector<RenderInstance> Instances; ///< Every loaded mesh in the scene
+    Vector<DirectionalLightComponent> DirectionalLights; ///< Directional lights, direction in world space
+    Vector<PointLightComponent> PointLights; ///< Point lights, position in world space
+    Vector<RenderSpotLight> SpotLights; ///< Spot lights, position and direction in world space
+    Vector<DebugLine> DebugLines; ///< Debug lines queued since the last extraction
+
+    ::Ref<Skybox> Skybox; ///< The skybox of the scene
+
+    /// @brief Copies the render data of a scene into the snapshot.
+    /// @param scene The scene to extract. Can be null, in which case the snapshot is just cleared.
+    void Extract(::Ref<Scene> scene);
+
+    /// @brief Empties the snapshot while keeping its memory around.
+    void Clear();
+
+    /// @brief Gets the main camera, to mirror Scene::GetMainCamera.
+    /// @return The main camera, or nullptr if the scene didn't have one.
+    const RenderCamera* GetMainCamera() const { return HasCamera ? &Camera : nullptr; }
+};
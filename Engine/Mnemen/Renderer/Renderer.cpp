@@ -23,8 +23,12 @@
 
 #include <Core/Logger.hpp>
 #include <Core/Profiler.hpp>
+#include <Core/Arena.hpp>
+#include <Core/Memory.hpp>
 
 #include <World/LightManager.hpp>
+#include <Asset/TextureStreamer.hpp>
+#include <Core/Application.hpp>
 
 #include <imgui.h>
 #include <FontAwesome/FontAwesome.hpp>
@@ -59,11 +63,77 @@ Renderer::~Renderer()
     mPasses.clear();
 }
 
-void Renderer::Render(const Frame& frame, ::Ref<Scene> scene)
+void Renderer::Extract(::Ref<Scene> scene)
+{
+    MemoryScope memoryScope(MemoryTag::Renderer);
+    mSnapshots[mExtractIndex].Extract(scene);
+    for (auto& pass : mPasses) {
+        pass->Extract(mSnapshots[mExtractIndex]);
+    }
+    RequestTextures(mSnapshots[mExtractIndex]);
+}
+
+void Renderer::RequestTextures(const RenderSnapshot& snapshot)
+{
+    PROFILE_FUNCTION();
+
+    const RenderCamera* camera = snapshot.GetMainCamera();
+    if (!camera)
+        return;
+    int width = 0;
+    int height = 0;
+    Application::Get()->GetWindow()->PollSize(width, height);
+
+    // Same walk and culling as the GBuffer, the textures it would bind are the ones requested
+    auto requestNode = [&](auto& self, MeshNode* node, const Mesh& model, const RenderInstance& instance) -> void {
+        if (!node)
+            return;
+
+        for (MeshPrimitive& primitive : node->Primitives) {
+            // Without texture coordinates every pixel samples the same texel, the smallest mips do
+            if (primitive.UVDensity <= 0.0f || !primitive.IsBoxInFrustum(instance.Transform, camera->View, camera->Projection))
+                continue;
+
+            float uvPerPixel = primitive.UVDensity / primitive.GetPixelsPerUnit(instance.Transform, camera->View, camera->Projection, float(height));
+            if (instance.HasMaterial && !instance.InheritFromModel) {
+                TextureStreamer::Request(instance.Albedo, uvPerPixel);
+                TextureStreamer::Request(instance.Normal, uvPerPixel);
+                TextureStreamer::Request(instance.PBR, uvPerPixel);
+            } else {
+                const MeshMaterial& material = model.Materials[primitive.MaterialIndex];
+                TextureStreamer::Request(material.Albedo, uvPerPixel);
+                TextureStreamer::Request(material.Normal, uvPerPixel);
+                TextureStreamer::Request(material.PBR, uvPerPixel);
+            }
+        }
+        for (MeshNode* child : node->Children) {
+            self(self, child, model, instance);
+        }
+    };
+    for (const RenderInstance& instance : snapshot.Instances) {
+        requestNode(requestNode, instance.MeshAsset->Mesh.Root, instance.MeshAsset->Mesh, instance);
+    }
+}
+
+void Renderer::Swap()
+{
+    mExtractIndex = (mExtractIndex + 1) % mSnapshots.size();
+}
+
+void Renderer::Render(const Frame& frame)
 {
     PROFILE_FUNCTION();
-    LightManager::Update(frame, scene);
+    MemoryScope memoryScope(MemoryTag::Renderer);
+
+    // Everything the passes put in the frame arena is only needed while recording this frame.
+    FrameArena::Begin(frame.FrameIndex);
+
+    RenderSnapshot& snapshot = mSnapshots[(mExtractIndex + 1) % mSnapshots.size()];
+    for (auto& pass : mPasses) {
+        pass->Prepare(frame, snapshot);
+    }
+    LightManager::Update(frame, snapshot);
     for (auto& pass : mPasses) {
-        pass->Render(frame, scene);
+        pass->Render(frame, snapshot);
     }
 }
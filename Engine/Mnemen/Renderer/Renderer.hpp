@@ -9,6 +9,7 @@
 #include <World/Scene.hpp>
 
 #include "RenderPass.hpp"
+#include "RenderSnapshot.hpp"
 #include "Passes/Debug.hpp"
 
 /// @brief A class responsible for managing and executing rendering passes.
@@ -35,15 +36,34 @@ public:
     /// Cleans up any resources used by the renderer, including render passes and RHI-related data.
     ~Renderer();
 
-    /// @brief Executes the rendering process for a given frame and scene.
+    /// @brief Copies the render data of the scene into the snapshot being built.
     /// 
-    /// This method renders the scene for the specified frame, invoking the appropriate render passes
-    /// in the correct order.
+    /// Runs on the simulation thread. The snapshot being rendered is never touched, so this is
+    /// safe to call while a previous frame is still being recorded.
+    /// 
+    /// @param scene The scene to extract.
+    void Extract(::Ref<Scene> scene);
+
+    /// @brief Hands the snapshot that was just extracted over to Render().
+    /// 
+    /// Must only be called once the previous Render() call has returned.
+    void Swap();
+
+    /// @brief Executes the rendering process for a given frame.
+    /// 
+    /// This method renders the last swapped snapshot for the specified frame, invoking the
+    /// appropriate render passes in the correct order.
     /// 
     /// @param frame The frame data that includes rendering parameters.
-    /// @param scene The scene to be rendered, which contains all the objects and data for rendering.
-    void Render(const Frame& frame, ::Ref<Scene> scene);
+    void Render(const Frame& frame);
 private:
+    /// @brief Tells the texture streamer how sharp each visible material needs its textures, from the camera of a snapshot.
+    /// @param snapshot The snapshot that was just extracted.
+    void RequestTextures(const RenderSnapshot& snapshot);
+
     Vector<RenderPass::Ref> mPasses; ///< A collection of render passes associated with the renderer.
+
+    Array<RenderSnapshot, 2> mSnapshots; ///< Double buffered render data: one extracted, one rendered.
+    UInt32 mExtractIndex = 0; ///< Index of the snapshot Extract() writes to.
 };
 
@@ -147,7 +147,10 @@ Ref<RenderPassResource> RendererTools::CreateSharedSampler(const String& name, S
     return sData.Resources[name];
 }
 
-Ref<RenderPassResource> RendererTools::Get(const String& name)
+Ref<RenderPassResource> RendererTools::Get(std::string_view name)
 {
-    return sData.Resources[name];
+    auto it = sData.Resources.find(name);
+    if (it == sData.Resources.end())
+        return nullptr;
+    return it->second;
 }
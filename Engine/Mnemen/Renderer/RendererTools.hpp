@@ -7,6 +7,8 @@
 
 #include <RHI/RHI.hpp>
 
+#include <string_view>
+
 /// @brief A ring buffer type for holding a fixed number of `Buffer::Ref` objects, used for frame management.
 /// 
 /// This is a typedef that creates a ring buffer with a size defined by `FRAMES_IN_FLIGHT`. It 
@@ -148,16 +150,24 @@ public:
     /// This method looks up a previously created resource by its name. It is useful for reusing 
     /// existing resources across different parts of the rendering pipeline.
     /// 
-    /// @param name The name of the resource to retrieve.
-    /// @return A reference to the requested render pass resource.
-    static Ref<RenderPassResource> Get(const String& name);
+    /// @param name The name of the resource to retrieve. Looked up without building a String, passes call this every frame.
+    /// @return A reference to the requested render pass resource, or nullptr if there is none.
+    static Ref<RenderPassResource> Get(std::string_view name);
 
 private:
+    /// @brief Hashes Strings and string views alike, so the resource map can be searched with either.
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+    };
+
     /// @brief A structure holding data for managing renderer tools, including the RHI and resources.
     struct RendererToolsData
     {
         RHI::Ref RHI;  ///< The rendering hardware interface used by the tools.
-        UnorderedMap<String, Ref<RenderPassResource>> Resources; ///< A map of resources by their name.
+        std::unordered_map<String, Ref<RenderPassResource>, NameHash, std::equal_to<>> Resources; ///< A map of resources by their name.
     };
 
     static RendererToolsData sData;  ///< Static data used by the `RendererTools` class.
@@ -8,6 +8,8 @@
 
 #include <World/Entity.hpp>
 #include <Input/Input.hpp>
+#include <Core/Profiler.hpp>
+#include <Core/Counters.hpp>
 
 void ScriptBinding::InitBindings(sol::state& state)
 {
@@ -19,6 +21,7 @@ void ScriptBinding::InitBindings(sol::state& state)
     InitKeycode(state);
     InitInput(state);
     InitEntity(state);
+    InitProfiler(state);
 
     // TODO: Assert, File, Logger, Random, Timer, Math, ImGui, and all the other components
 }
@@ -35,6 +38,26 @@ void ScriptBinding::InitEntity(sol::state& state)
     state["Entity"]["GetAudioSource"] = &LuaWrapper::LuaEntity::GetAudioSource;
 }
 
+void ScriptBinding::InitProfiler(sol::state& state)
+{
+    state.new_usertype<ProfilerStats>(
+        "ProfilerStats",
+        "Last", sol::readonly(&ProfilerStats::Last),
+        "Min", sol::readonly(&ProfilerStats::Min),
+        "Avg", sol::readonly(&ProfilerStats::Avg),
+        "Max", sol::readonly(&ProfilerStats::Max),
+        "P95", sol::readonly(&ProfilerStats::P95),
+        "P99", sol::readonly(&ProfilerStats::P99),
+        "SampleCount", sol::readonly(&ProfilerStats::SampleCount)
+    );
+
+    state["Profiler"] = state.create_table();
+    state["Profiler"]["GetScopeStats"] = &Profiler::GetScopeStats;
+    state["Profiler"]["GetFrameStats"] = &Profiler::GetFrameStats;
+    state["Profiler"]["ResetStats"] = &Profiler::ResetStats;
+    state["Profiler"]["GetCounter"] = [](const String& name) { return Counters::GetFrameValue(name); };
+}
+
 void ScriptBinding::InitVec(sol::state& state)
 {
     state.new_usertype<glm::vec2>(
@@ -21,4 +21,5 @@ private:
     static void InitTransform(sol::state& state);
     static void InitCameraComponent(sol::state& state);
     static void InitAudioSourceComponent(sol::state& state);
+    static void InitProfiler(sol::state& state);
 };
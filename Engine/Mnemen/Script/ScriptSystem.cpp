@@ -11,6 +11,7 @@
 
 #include <Core/Logger.hpp>
 #include <Core/Profiler.hpp>
+#include <Core/Memory.hpp>
 
 ScriptSystem::Data ScriptSystem::sData;
 
@@ -41,8 +42,19 @@ int ScriptSystem::PanicCallback(lua_State* L)
     return 0;
 }
 
+void* ScriptSystem::AllocateCallback(void* userData, void* ptr, size_t oldSize, size_t newSize)
+{
+    if (newSize == 0) {
+        Memory::Free(ptr);
+        return nullptr;
+    }
+    return Memory::Reallocate(ptr, newSize, MemoryTag::Script);
+}
+
 void ScriptSystem::Init()
 {
+    // Recreate the state with an allocator so the Lua heap is tracked under the Script tag.
+    sData.State = sol::state(sol::default_at_panic, &ScriptSystem::AllocateCallback);
     sData.State.open_libraries(sol::lib::base,
                                sol::lib::math,
                                sol::lib::os,
@@ -80,6 +92,7 @@ void ScriptSystem::Awake(Ref<Scene> scene)
 void ScriptSystem::Update(Ref<Scene> scene, float dt)
 {
     PROFILE_FUNCTION();
+    MemoryScope memoryScope(MemoryTag::Script);
 
     entt::registry* reg = scene->GetRegistry();
 
@@ -23,6 +23,7 @@ public:
 private:
     static void LogCallback(const sol::variadic_args& args);
     static int PanicCallback(lua_State* L);
+    static void* AllocateCallback(void* userData, void* ptr, size_t oldSize, size_t newSize);
 
     static struct Data {
         sol::state State;
@@ -6,7 +6,9 @@
 #include "Dialog.hpp"
 
 #include <Core/UTF.hpp>
+#include <Core/Logger.hpp>
 
+#if defined(_WIN32)
 #include <windows.h>
 #include <commdlg.h>
 #include <shlwapi.h>
@@ -16,6 +18,9 @@
 #include <algorithm>
 #include <shlobj.h>
 #include <atlbase.h>
+#endif
+
+#if defined(_WIN32)
 
 String BuildFilterString(const Vector<String>& extensions)
 {
@@ -164,3 +169,24 @@ String Dialog::OpenFolder()
 
     return folderPath;
 }
+#else
+// Native dialogs are only wired up on Windows, elsewhere every dialog behaves as if it was canceled
+
+String Dialog::Open(const Vector<String>& extensions)
+{
+    LOG_WARN("File dialogs aren't supported on this platform");
+    return "";
+}
+
+String Dialog::Save(const Vector<String>& extensions)
+{
+    LOG_WARN("File dialogs aren't supported on this platform");
+    return "";
+}
+
+String Dialog::OpenFolder()
+{
+    LOG_WARN("File dialogs aren't supported on this platform");
+    return "";
+}
+#endif
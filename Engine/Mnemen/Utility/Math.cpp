@@ -106,11 +106,11 @@ glm::vec3 Math::EulerToForward(glm::vec3 deg)
     return glm::normalize(glm::vec3(forward));
 }
 
-Vector<glm::vec4> Math::FrustumCorners(glm::mat4 view, glm::mat4 proj)
+Array<glm::vec4, 8> Math::FrustumCorners(glm::mat4 view, glm::mat4 proj)
 {
 	glm::mat4 inv = glm::inverse(proj * view);
 
-    Vector<glm::vec4> corners = {
+    Array<glm::vec4, 8> corners = {
         glm::vec4(-1.0f,  1.0f, 0.0f, 1.0f),
         glm::vec4( 1.0f,  1.0f, 0.0f, 1.0f),
         glm::vec4( 1.0f, -1.0f, 0.0f, 1.0f),
@@ -132,7 +132,7 @@ Vector<glm::vec4> Math::FrustumCorners(glm::mat4 view, glm::mat4 proj)
     return corners;
 }
 
-Vector<glm::vec4> Math::CascadeCorners(glm::mat4 view, float fov, float aspectRatio, float nearPlane, float farPlane)
+Array<glm::vec4, 8> Math::CascadeCorners(glm::mat4 view, float fov, float aspectRatio, float nearPlane, float farPlane)
 {
 	return FrustumCorners(view, glm::perspective(fov, aspectRatio, nearPlane, farPlane));
 }
@@ -66,8 +66,8 @@ public:
 
     static glm::vec3 EulerToForward(glm::vec3 deg);
 
-    static Vector<glm::vec4> FrustumCorners(glm::mat4 view, glm::mat4 proj);
-    static Vector<glm::vec4> CascadeCorners(glm::mat4 view, float fov, float aspectRatio, float nearPlane, float farPlane);
+    static Array<glm::vec4, 8> FrustumCorners(glm::mat4 view, glm::mat4 proj);
+    static Array<glm::vec4, 8> CascadeCorners(glm::mat4 view, float fov, float aspectRatio, float nearPlane, float farPlane);
 
     static Array<Plane, 6> GetFrustumPlanes(glm::mat4 view, glm::mat4 proj);
 };
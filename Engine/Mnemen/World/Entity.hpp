@@ -8,6 +8,7 @@
 #include <entt/entt.hpp>
 #include <Core/Common.hpp>
 #include <Core/Logger.hpp>
+#include <Core/Memory.hpp>
 
 #include <Asset/AssetManager.hpp>
 #include <Script/ScriptInstance.hpp>
@@ -58,6 +59,7 @@ struct Entity
         if (HasComponent<T>()) {
             LOG_WARN("da fuck");
         }
+        MemoryScope memoryScope(MemoryTag::ECS);
         return ParentRegistry->emplace<T>(ID, std::forward<Arguments>(args)...);
     }
 
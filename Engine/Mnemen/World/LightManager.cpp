@@ -7,7 +7,6 @@
 
 #include <Renderer/RendererTools.hpp>
 #include <Core/Profiler.hpp>
-#include <Utility/Math.hpp>
 
 LightManager::Data LightManager::sData;
 
@@ -23,11 +22,10 @@ void LightManager::Init(RHI::Ref rhi)
     sData.Data.SpotLightSRV = spot->Descriptor(ViewType::ShaderResource);
 }
 
-void LightManager::Update(const Frame& frame, Ref<Scene> scene)
+void LightManager::Update(const Frame& frame, const RenderSnapshot& snapshot)
 {
     PROFILE_FUNCTION();
 
-    auto registry = scene->GetRegistry();
     auto light = RendererTools::Get("LightBuffer");
     auto dir = RendererTools::Get("DirLightBuffer");
     auto point = RendererTools::Get("PointLightBuffer");
@@ -40,53 +38,30 @@ void LightManager::Update(const Frame& frame, Ref<Scene> scene)
     sData.Data.PointLightSRV = point->Descriptor(ViewType::ShaderResource, frame.FrameIndex);
     sData.Data.SpotLightSRV = spot->Descriptor(ViewType::ShaderResource, frame.FrameIndex);
 
+    // Positions and directions were resolved to world space when the snapshot was extracted
     {
-        auto view = registry->view<TransformComponent, DirectionalLightComponent>();
-        for (auto [id, t, dir] : view.each()) {
-            Entity entity(registry);
-            entity.ID = id;
-
-            glm::mat4 transform = entity.GetWorldTransform();
-            glm::vec3 t, r, s;
-            Math::DecomposeTransform(transform, t, r, s);
-            glm::vec3 forward = Math::EulerToForward(r);
-            
-            dir.Direction = forward;
-            sData.DirLights[sData.Data.DirLightCount] = dir;
+        for (const DirectionalLightComponent& light : snapshot.DirectionalLights) {
+            if (sData.Data.DirLightCount >= sData.DirLights.size())
+                break;
+            sData.DirLights[sData.Data.DirLightCount] = light;
             sData.Data.DirLightCount++;
         }
         dir->RBuffer[frame.FrameIndex]->CopyMapped(sData.DirLights.data(), sizeof(DirectionalLightComponent) * sData.Data.DirLightCount);
     }
     {
-        auto view = registry->view<TransformComponent, PointLightComponent>();
-        for (auto [id, t, dir] : view.each()) {
-            Entity entity(registry);
-            entity.ID = id;
-
-            glm::mat4 transform = entity.GetWorldTransform();
-            glm::vec3 t, r, s;
-            Math::DecomposeTransform(transform, t, r, s);
-            
-            dir.Position = t;
-            sData.PointLights[sData.Data.PointLightCount] = dir;
+        for (const PointLightComponent& light : snapshot.PointLights) {
+            if (sData.Data.PointLightCount >= sData.PointLights.size())
+                break;
+            sData.PointLights[sData.Data.PointLightCount] = light;
             sData.Data.PointLightCount++;
         }
         point->RBuffer[frame.FrameIndex]->CopyMapped(sData.PointLights.data(), sizeof(PointLightComponent) * sData.Data.PointLightCount);
     }
     {
-        auto view = registry->view<TransformComponent, SpotLightComponent>();
-        for (auto [id, t, dir] : view.each()) {
-            Entity entity(registry);
-            entity.ID = id;
-
-            glm::mat4 transform = entity.GetWorldTransform();
-            glm::vec3 t, r, s;
-            Math::DecomposeTransform(transform, t, r, s);
-            glm::vec3 forward = Math::EulerToForward(r);
-
-            dir.Position = t;
-            dir.Direction = forward;
-            sData.SpotLights[sData.Data.SpotLightCount] = dir;
+        for (const RenderSpotLight& light : snapshot.SpotLights) {
+            if (sData.Data.SpotLightCount >= sData.SpotLights.size())
+                break;
+            sData.SpotLights[sData.Data.SpotLightCount] = light.Light;
             sData.Data.SpotLightCount++;
         }
         spot->RBuffer[frame.FrameIndex]->CopyMapped(sData.SpotLights.data(), sizeof(SpotLightComponent) * sData.Data.SpotLightCount);
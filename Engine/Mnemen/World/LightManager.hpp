@@ -7,7 +7,7 @@
 
 #include <RHI/RHI.hpp>
 
-#include "Scene.hpp"
+#include <Renderer/RenderSnapshot.hpp>
 
 struct LightData
 {
@@ -24,7 +24,7 @@ class LightManager
 public:
     static void Init(RHI::Ref rhi);
     
-    static void Update(const Frame& frame, Ref<Scene> scene);
+    static void Update(const Frame& frame, const RenderSnapshot& snapshot);
 private:
     static struct Data {
         LightData Data;
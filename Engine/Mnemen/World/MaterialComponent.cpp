@@ -14,7 +14,7 @@ void MaterialComponent::LoadAlbedo(const String& string)
     }
 
     if (Albedo) AssetManager::GiveBack(Albedo->Path);
-    Albedo = AssetManager::Get(string, AssetType::Texture);
+    Albedo = AssetManager::GetAsync(string, AssetType::Texture);
 }
 
 void MaterialComponent::LoadNormal(const String& string)
@@ -24,7 +24,7 @@ void MaterialComponent::LoadNormal(const String& string)
     }
 
     if (Normal) AssetManager::GiveBack(Normal->Path);
-    Normal = AssetManager::Get(string, AssetType::Texture);
+    Normal = AssetManager::GetAsync(string, AssetType::Texture);
 }
 
 void MaterialComponent::LoadPBR(const String& string)
@@ -34,7 +34,7 @@ void MaterialComponent::LoadPBR(const String& string)
     }
 
     if (PBR) AssetManager::GiveBack(PBR->Path);
-    PBR = AssetManager::Get(string, AssetType::Texture);
+    PBR = AssetManager::GetAsync(string, AssetType::Texture);
 }
 
 void MaterialComponent::Free()
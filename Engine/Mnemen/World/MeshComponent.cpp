@@ -19,6 +19,6 @@ void MeshComponent::Init(const String& string)
         AssetManager::GiveBack(MeshAsset->Path);
     }
     MeshAsset.reset();
-    MeshAsset = AssetManager::Get(string, AssetType::Mesh);
+    MeshAsset = AssetManager::GetAsync(string, AssetType::Mesh); // Draws nothing until it's loaded
     Loaded = true;
 }
@@ -6,11 +6,19 @@
 #include "Scene.hpp"
 
 #include <Renderer/SkyboxCooker.hpp>
+#include <Core/JobSystem.hpp>
+#include <Core/Memory.hpp>
 
 Scene::Scene()
 {
     mSkybox = MakeRef<Skybox>();
     mSkybox->Path = "Assets/Skyboxes/Default.hdr";
+
+    // The first view of a component creates its storage. AI and audio build their views on workers while Update()
+    // builds its own on the main thread, so every storage the systems phase reads must exist before it starts.
+    mRegistry.storage<TransformComponent>();
+    mRegistry.storage<CameraComponent>();
+    mRegistry.storage<AudioSourceComponent>();
 }
 
 Scene::~Scene()
@@ -38,12 +46,15 @@ Scene::~Scene()
 
 void Scene::Update()
 {
+    MemoryScope memoryScope(MemoryTag::ECS);
+
     // Transform update
     {
-        auto view = mRegistry.view<TransformComponent>();
-        for (auto [entity, transform] : view.each()) {
-            transform.Update();
-        }
+        auto& storage = mRegistry.storage<TransformComponent>();
+        auto begin = storage.begin();
+        JobSystem::ParallelFor(static_cast<UInt32>(storage.size()), 256, [begin](UInt32 index) {
+            begin[index].Update();
+        });
     }
 
     // Camera Update (to sync camera with transformations)
@@ -59,26 +70,22 @@ CameraComponent* Scene::GetMainCamera()
 {
     // NOTE(amelie): This is professional grade spaghetti bullshit but lowkey iterating through entities is fast as hell. Love EnTT x
 
-    Vector<CameraComponent*> cameras;
+    // Only the highest priority camera matters, a single pass finds it without building and sorting a list every frame.
+    CameraComponent* bestCamera = nullptr;
     auto view = mRegistry.view<CameraComponent>();
     for (auto [entity, camera] : view.each()) {
-        cameras.push_back(&camera);
+        if (!bestCamera || camera.Primary > bestCamera->Primary)
+            bestCamera = &camera;
     }
 
-    std::sort(cameras.begin(), cameras.end(), [](CameraComponent* a, CameraComponent* b) {
-        return a->Primary > b->Primary;
-    });
-
-    if (!cameras.empty()) {
-        const auto& bestCamera = cameras.front();
-        if (bestCamera->Primary > 0)
-            return bestCamera;
-    }
+    if (bestCamera && bestCamera->Primary > 0)
+        return bestCamera;
     return nullptr;
 }
 
 Entity Scene::AddEntity(const String& name)
 {
+    MemoryScope memoryScope(MemoryTag::ECS);
     Entity newEntity(&mRegistry);
 
     newEntity.ID = mRegistry.create();
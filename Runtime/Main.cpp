@@ -5,7 +5,7 @@
 
 #include "Runtime.hpp"
 
-int main()
+int main(int argc, char *argv[])
 {
     ApplicationSpecs specs;
     specs.Width = 1920;
@@ -13,6 +13,22 @@ int main()
     specs.WindowTitle = "Game Demo";
     specs.ProjectPath = "TestGame.mpj";
     specs.CopyToBackBuffer = true;
+    specs.PipelinedRendering = true;
+
+    // --record <file> saves the session, --replay <file> plays it back with its frame times, --capture <file> traces the replay.
+    // --archive <file> reads cooked assets from an asset archive packed by the editor.
+    for (int i = 1; i + 1 < argc; i += 2) {
+        String option = argv[i];
+        if (option == "--record") {
+            specs.RecordPath = argv[i + 1];
+        } else if (option == "--replay") {
+            specs.ReplayPath = argv[i + 1];
+        } else if (option == "--capture") {
+            specs.ReplayCapturePath = argv[i + 1];
+        } else if (option == "--archive") {
+            specs.ArchivePath = argv[i + 1];
+        }
+    }
 
     Runtime runtime(specs);
     runtime.Run();
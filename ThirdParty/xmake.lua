@@ -22,8 +22,10 @@ target("ImGui")
               "ImGui/imgui_tables.cpp",
               "ImGui/imgui_widgets.cpp", 
               "ImGui/imgui.cpp", 
-              "ImGui/backends/imgui_impl_sdl3.cpp",
-              "ImGui/backends/imgui_impl_dx12.cpp")
+              "ImGui/backends/imgui_impl_sdl3.cpp")
+    if not is_config("rhi", "null") then
+        add_files("ImGui/backends/imgui_impl_dx12.cpp")
+    end
     add_headerfiles("ImGui/*.h")
     add_includedirs("imgui/")
 
@@ -5,6 +5,13 @@
 
 add_rules("mode.debug", "mode.release", "mode.releasedbg")
 
+option("rhi")
+    set_default("d3d12")
+    set_showmenu(true)
+    set_values("d3d12", "null")
+    set_description("Rendering backend. null records commands without ever touching a GPU, for headless CPU benchmarks.")
+option_end()
+
 includes("ThirdParty")
 
 target("Mnemen")
@@ -26,6 +33,30 @@ target("Mnemen")
              "Lua")
     
     add_files("Engine/**.cpp") -- Might need to change this for multi-platform or multi-API
+    if is_config("rhi", "null") then
+        add_defines("MNEMEN_RHI_NULL", { public = true })
+        remove_files("Engine/Mnemen/RHI/Buffer.cpp",
+                     "Engine/Mnemen/RHI/CommandBuffer.cpp",
+                     "Engine/Mnemen/RHI/ComputePipeline.cpp",
+                     "Engine/Mnemen/RHI/DescriptorHeap.cpp",
+                     "Engine/Mnemen/RHI/Device.cpp",
+                     "Engine/Mnemen/RHI/Fence.cpp",
+                     "Engine/Mnemen/RHI/GPUTimer.cpp",
+                     "Engine/Mnemen/RHI/GraphicsPipeline.cpp",
+                     "Engine/Mnemen/RHI/MeshPipeline.cpp",
+                     "Engine/Mnemen/RHI/Queue.cpp",
+                     "Engine/Mnemen/RHI/RHI.cpp",
+                     "Engine/Mnemen/RHI/RTPipeline.cpp",
+                     "Engine/Mnemen/RHI/Resource.cpp",
+                     "Engine/Mnemen/RHI/RootSignature.cpp",
+                     "Engine/Mnemen/RHI/Sampler.cpp",
+                     "Engine/Mnemen/RHI/Surface.cpp",
+                     "Engine/Mnemen/RHI/Utilities.cpp",
+                     "Engine/Mnemen/RHI/View.cpp",
+                     "Engine/Mnemen/Asset/Shader.cpp")
+    else
+        remove_files("Engine/Mnemen/RHI/Null/*.cpp")
+    end
     add_headerfiles("Engine/**.hpp")
     add_includedirs("Engine/Mnemen",
                     "ThirdParty/SDL3/include",
@@ -116,6 +147,7 @@ target("Editor")
                     "ThirdParty/DirectX/include",
                     "ThirdParty/",
                     "ThirdParty/nvtt/",
+                    "ThirdParty/meshopt/src",
                     "ThirdParty/Jolt",
                     "ThirdParty/miniaudio",
                     "ThirdParty/Recast/Recast/Include",
@@ -163,6 +195,7 @@ target("Runtime")
                     "ThirdParty/DirectX/include",
                     "ThirdParty/",
                     "ThirdParty/nvtt/",
+                    "ThirdParty/meshopt/src",
                     "ThirdParty/Jolt",
                     "ThirdParty/miniaudio",
                     "ThirdParty/Recast/Recast/Include",
@@ -209,6 +242,7 @@ target("Launcher")
                     "ThirdParty/DirectX/include",
                     "ThirdParty/",
                     "ThirdParty/nvtt/",
+                    "ThirdParty/meshopt/src",
                     "ThirdParty/Jolt",
                     "ThirdParty/miniaudio",
                     "ThirdParty/Recast/Recast/Include",
@@ -240,3 +274,51 @@ target("Launcher")
         set_optimize("fastest")
         set_strip("all")
     end
+
+target("Benchmarks")
+    set_kind("binary")
+    set_group("Engine")
+    set_languages("c++20")
+    set_rundir(".")
+    set_encodings("utf-8")
+
+    add_files("Benchmarks/*.cpp")
+    add_headerfiles("Benchmarks/**.hpp")
+    add_includedirs("Engine",
+                    "Engine/Mnemen",
+                    "Benchmarks",
+                    "ThirdParty/SDL3/include",
+                    "ThirdParty/spdlog/include",
+                    "ThirdParty/glm",
+                    "ThirdParty/ImGui/",
+                    "ThirdParty/DirectX/include",
+                    "ThirdParty/",
+                    "ThirdParty/nvtt/",
+                    "ThirdParty/meshopt/src",
+                    "ThirdParty/Jolt",
+                    "ThirdParty/miniaudio",
+                    "ThirdParty/Recast/Recast/Include",
+                    "ThirdParty/Recast/Detour/Include",
+                    "ThirdParty/Recast/DetourCrowd/Include",
+                    "ThirdParty/Recast/DetourTileCache/Include",
+                    "ThirdParty/Recast/DebugUtils/Include",
+                    "ThirdParty/JSON/single_include",
+                    "ThirdParty/Lua/src")
+    add_deps("Mnemen")
+    add_defines("GLM_ENABLE_EXPERIMENTAL", "WIN32_LEAN_AND_MEAN", "NOMINMAX", "JPH_DEBUG_RENDERER")
+
+    if is_mode("debug") then
+        set_symbols("debug")
+        set_optimize("none")
+        add_defines("BENCHMARKS_DEBUG")
+    end
+    if is_mode("release") then
+        set_symbols("hidden")
+        set_optimize("fastest")
+        set_strip("all")
+    end
+    if is_mode("releasedbg") then
+        set_symbols("debug")
+        set_optimize("fastest")
+        set_strip("all")
+    end